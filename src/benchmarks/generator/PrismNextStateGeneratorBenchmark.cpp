@@ -0,0 +1,60 @@
+#include "benchmarks/storm_benchmark.h"
+
+#include <deque>
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/prism/Program.h"
+
+namespace {
+
+    /*!
+     * Explores (a prefix of) the state space of the given program in breadth-first order and measures the time needed
+     * for loading and expanding the states, including the lookup of the successors in the state storage. This
+     * mirrors the inner loop of the explicit model builder without the construction of the matrix.
+     */
+    void PrismNextStateGeneratorExpand(benchmark::State& state, std::string const& file) {
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR + file);
+        storm::generator::NextStateGeneratorOptions options;
+        options.setBuildAllLabels();
+        uint64_t maximalNumberOfStates = state.range(0);
+
+        uint64_t numberOfExpandedStates = 0;
+        uint64_t numberOfTransitions = 0;
+        for (auto _ : state) {
+            state.PauseTiming();
+            storm::generator::PrismNextStateGenerator<double, uint32_t> generator(program, options);
+            storm::storage::BitVectorHashMap<uint32_t> stateStorage(generator.getStateSize());
+            std::deque<std::pair<storm::generator::CompressedState, uint32_t>> statesToExplore;
+            auto stateToIdCallback = [&stateStorage, &statesToExplore, maximalNumberOfStates] (storm::generator::CompressedState const& compressedState) -> uint32_t {
+                uint32_t newIndex = static_cast<uint32_t>(stateStorage.size());
+                std::pair<uint32_t, uint64_t> indexBucketPair = stateStorage.findOrAddAndGetBucket(compressedState, newIndex);
+                if (indexBucketPair.first == newIndex && newIndex < maximalNumberOfStates) {
+                    statesToExplore.emplace_back(compressedState, newIndex);
+                }
+                return indexBucketPair.first;
+            };
+            state.ResumeTiming();
+
+            generator.getInitialStates(stateToIdCallback);
+            while (!statesToExplore.empty()) {
+                generator.load(statesToExplore.front().first);
+                statesToExplore.pop_front();
+                storm::generator::StateBehavior<double, uint32_t> behavior = generator.expand(stateToIdCallback);
+                for (auto const& choice : behavior) {
+                    numberOfTransitions += choice.size();
+                }
+                ++numberOfExpandedStates;
+            }
+        }
+        state.SetItemsProcessed(numberOfExpandedStates);
+        state.counters["transitions"] = benchmark::Counter(static_cast<double>(numberOfTransitions), benchmark::Counter::kIsRate);
+    }
+    BENCHMARK_CAPTURE(PrismNextStateGeneratorExpand, crowds, "/dtmc/crowds-5-5.pm")->ArgNames({"states"})->Arg(100000)->Unit(benchmark::kMillisecond);
+    BENCHMARK_CAPTURE(PrismNextStateGeneratorExpand, brp, "/dtmc/brp-16-2.pm")->ArgNames({"states"})->Arg(100000)->Unit(benchmark::kMillisecond);
+    BENCHMARK_CAPTURE(PrismNextStateGeneratorExpand, csma, "/mdp/csma2-2.nm")->ArgNames({"states"})->Arg(100000)->Unit(benchmark::kMillisecond);
+    BENCHMARK_CAPTURE(PrismNextStateGeneratorExpand, firewire, "/mdp/firewire3-0.5.nm")->ArgNames({"states"})->Arg(100000)->Unit(benchmark::kMillisecond);
+    BENCHMARK_CAPTURE(PrismNextStateGeneratorExpand, wlan, "/mdp/wlan0-2-2.nm")->ArgNames({"states"})->Arg(100000)->Unit(benchmark::kMillisecond);
+
+}
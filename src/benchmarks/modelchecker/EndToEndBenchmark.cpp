@@ -0,0 +1,50 @@
+#include "benchmarks/storm_benchmark.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/api/verification.h"
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+
+    /*!
+     * Parses the given program, builds the model and checks the given property (for the initial states) with the
+     * sparse engine, i.e. it measures what a single call of Storm does. The result (the value for the initial
+     * state) is reported as a counter such that a change of the results is noticed as well.
+     */
+    void SparseEngine(benchmark::State& state, std::string const& file, std::string const& formula) {
+        storm::Environment env;
+        double value = 0.0;
+        uint64_t numberOfStates = 0;
+        for (auto _ : state) {
+            storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR + file);
+            auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formula, program));
+            auto model = storm::api::buildSparseModel<double>(program, formulas);
+            auto result = storm::api::verifyWithSparseEngine<double>(env, model, storm::api::createTask<double>(formulas.front(), true));
+            result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model->getInitialStates()));
+            value = result->asQuantitativeCheckResult<double>().getMin();
+            numberOfStates = model->getNumberOfStates();
+        }
+        state.counters["states"] = numberOfStates;
+        state.counters["result"] = value;
+    }
+
+    // DTMCs
+    BENCHMARK_CAPTURE(SparseEngine, crowds, "/dtmc/crowds-5-5.pm", "P=? [F \"observe0Greater1\"]")->Unit(benchmark::kMillisecond);
+    BENCHMARK_CAPTURE(SparseEngine, brp, "/dtmc/brp-16-2.pm", "P=? [F \"target\"]")->Unit(benchmark::kMillisecond);
+    BENCHMARK_CAPTURE(SparseEngine, leader_sync, "/dtmc/leader-3-5.pm", "R{\"num_rounds\"}=? [F \"elected\"]")->Unit(benchmark::kMillisecond);
+    BENCHMARK_CAPTURE(SparseEngine, nand, "/dtmc/nand-5-2.pm", "P=? [F \"target\"]")->Unit(benchmark::kMillisecond);
+
+    // MDPs
+    BENCHMARK_CAPTURE(SparseEngine, csma_probability, "/mdp/csma2-2.nm", "Pmin=? [F \"all_delivered\"]")->Unit(benchmark::kMillisecond);
+    BENCHMARK_CAPTURE(SparseEngine, csma_reward, "/mdp/csma2-2.nm", "R{\"time\"}max=? [F \"all_delivered\"]")->Unit(benchmark::kMillisecond);
+    BENCHMARK_CAPTURE(SparseEngine, leader_async, "/mdp/leader4.nm", "R{\"rounds\"}max=? [F \"elected\"]")->Unit(benchmark::kMillisecond);
+    BENCHMARK_CAPTURE(SparseEngine, coin, "/mdp/coin2-2.nm", "Pmin=? [F \"finished\" & \"all_coins_equal_1\"]")->Unit(benchmark::kMillisecond);
+    BENCHMARK_CAPTURE(SparseEngine, firewire, "/mdp/firewire3-0.5.nm", "Pmax=? [F \"elected\"]")->Unit(benchmark::kMillisecond);
+    BENCHMARK_CAPTURE(SparseEngine, wlan, "/mdp/wlan0-2-2.nm", "Pmax=? [F \"twoCollisions\"]")->Unit(benchmark::kMillisecond);
+
+}
@@ -0,0 +1,54 @@
+#include "benchmarks/storm_benchmark.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/bisimulation/DeterministicModelBisimulationDecomposition.h"
+#include "storm/storage/bisimulation/NondeterministicModelBisimulationDecomposition.h"
+
+namespace {
+
+    template<typename ModelType>
+    std::pair<std::shared_ptr<ModelType>, std::vector<std::shared_ptr<storm::logic::Formula const>>> buildModel(std::string const& file, std::string const& formulas) {
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR + file);
+        program = program.substituteConstantsFormulas();
+        auto formulaVector = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulas, program));
+        return std::make_pair(storm::api::buildSparseModel<double>(program, formulaVector)->template as<ModelType>(), formulaVector);
+    }
+
+    template<typename DecompositionType, typename ModelType>
+    void BisimulationRefinement(benchmark::State& state, std::string const& file, std::string const& formulas, storm::storage::BisimulationType type) {
+        auto modelFormulas = buildModel<ModelType>(file, formulas);
+        typename DecompositionType::Options options(*modelFormulas.first, modelFormulas.second);
+        options.setType(type);
+
+        uint64_t numberOfBlocks = 0;
+        for (auto _ : state) {
+            DecompositionType decomposition(*modelFormulas.first, options);
+            decomposition.computeBisimulationDecomposition();
+            numberOfBlocks = decomposition.getQuotient()->getNumberOfStates();
+        }
+        state.SetItemsProcessed(state.iterations() * modelFormulas.first->getNumberOfTransitions());
+        state.counters["states"] = modelFormulas.first->getNumberOfStates();
+        state.counters["blocks"] = numberOfBlocks;
+    }
+
+    void DtmcBisimulationRefinement(benchmark::State& state, std::string const& file, std::string const& formulas, storm::storage::BisimulationType type) {
+        BisimulationRefinement<storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>>, storm::models::sparse::Dtmc<double>>(state, file, formulas, type);
+    }
+    BENCHMARK_CAPTURE(DtmcBisimulationRefinement, crowds_strong, "/dtmc/crowds-5-5.pm", "P=? [F \"observe0Greater1\"]", storm::storage::BisimulationType::Strong)->Unit(benchmark::kMillisecond);
+    BENCHMARK_CAPTURE(DtmcBisimulationRefinement, crowds_weak, "/dtmc/crowds-5-5.pm", "P=? [F \"observe0Greater1\"]", storm::storage::BisimulationType::Weak)->Unit(benchmark::kMillisecond);
+    BENCHMARK_CAPTURE(DtmcBisimulationRefinement, brp_strong, "/dtmc/brp-16-2.pm", "P=? [F \"target\"]", storm::storage::BisimulationType::Strong)->Unit(benchmark::kMillisecond);
+    BENCHMARK_CAPTURE(DtmcBisimulationRefinement, nand_strong, "/dtmc/nand-5-2.pm", "P=? [F \"target\"]", storm::storage::BisimulationType::Strong)->Unit(benchmark::kMillisecond);
+
+    void MdpBisimulationRefinement(benchmark::State& state, std::string const& file, std::string const& formulas) {
+        BisimulationRefinement<storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<double>>, storm::models::sparse::Mdp<double>>(state, file, formulas, storm::storage::BisimulationType::Strong);
+    }
+    BENCHMARK_CAPTURE(MdpBisimulationRefinement, csma, "/mdp/csma2-2.nm", "Pmax=? [F \"all_delivered\"]")->Unit(benchmark::kMillisecond);
+    BENCHMARK_CAPTURE(MdpBisimulationRefinement, leader, "/mdp/leader4.nm", "Pmin=? [F \"elected\"]")->Unit(benchmark::kMillisecond);
+    BENCHMARK_CAPTURE(MdpBisimulationRefinement, coin, "/mdp/coin2-2.nm", "Pmin=? [F \"finished\" & \"all_coins_equal_1\"]")->Unit(benchmark::kMillisecond);
+
+}
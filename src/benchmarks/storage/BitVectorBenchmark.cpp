@@ -0,0 +1,122 @@
+#include "benchmarks/storm_benchmark.h"
+
+#include "storm/storage/BitVectorHashMap.h"
+
+namespace {
+
+    void BitVectorAnd(benchmark::State& state) {
+        storm::storage::BitVector first = storm::benchmark::createRandomBitVector(state.range(0), 0.5, 1);
+        storm::storage::BitVector second = storm::benchmark::createRandomBitVector(state.range(0), 0.5, 2);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(first & second);
+        }
+        state.SetBytesProcessed(state.iterations() * 2 * (state.range(0) / 8));
+    }
+    BENCHMARK(BitVectorAnd)->ArgNames({"bits"})->Arg(1 << 12)->Arg(1 << 20)->Arg(1 << 24);
+
+    void BitVectorOrAssign(benchmark::State& state) {
+        storm::storage::BitVector first = storm::benchmark::createRandomBitVector(state.range(0), 0.1, 1);
+        storm::storage::BitVector second = storm::benchmark::createRandomBitVector(state.range(0), 0.1, 2);
+        for (auto _ : state) {
+            first |= second;
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(state.iterations() * 2 * (state.range(0) / 8));
+    }
+    BENCHMARK(BitVectorOrAssign)->ArgNames({"bits"})->Arg(1 << 12)->Arg(1 << 20)->Arg(1 << 24);
+
+    void BitVectorComplement(benchmark::State& state) {
+        storm::storage::BitVector vector = storm::benchmark::createRandomBitVector(state.range(0), 0.5);
+        for (auto _ : state) {
+            vector.complement();
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(state.iterations() * (state.range(0) / 8));
+    }
+    BENCHMARK(BitVectorComplement)->ArgNames({"bits"})->Arg(1 << 12)->Arg(1 << 20)->Arg(1 << 24);
+
+    void BitVectorSubsetOf(benchmark::State& state) {
+        storm::storage::BitVector first = storm::benchmark::createRandomBitVector(state.range(0), 0.3);
+        storm::storage::BitVector second = first | storm::benchmark::createRandomBitVector(state.range(0), 0.3, 2);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(first.isSubsetOf(second));
+        }
+        state.SetBytesProcessed(state.iterations() * 2 * (state.range(0) / 8));
+    }
+    BENCHMARK(BitVectorSubsetOf)->ArgNames({"bits"})->Arg(1 << 12)->Arg(1 << 20)->Arg(1 << 24);
+
+    void BitVectorNumberOfSetBits(benchmark::State& state) {
+        storm::storage::BitVector vector = storm::benchmark::createRandomBitVector(state.range(0), 0.5);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(vector.getNumberOfSetBits());
+        }
+        state.SetBytesProcessed(state.iterations() * (state.range(0) / 8));
+    }
+    BENCHMARK(BitVectorNumberOfSetBits)->ArgNames({"bits"})->Arg(1 << 12)->Arg(1 << 20)->Arg(1 << 24);
+
+    void BitVectorIterateSetBits(benchmark::State& state) {
+        // The second argument is the percentage of set bits.
+        storm::storage::BitVector vector = storm::benchmark::createRandomBitVector(state.range(0), state.range(1) / 100.0);
+        for (auto _ : state) {
+            uint64_t sum = 0;
+            for (auto const& index : vector) {
+                sum += index;
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * vector.getNumberOfSetBits());
+    }
+    BENCHMARK(BitVectorIterateSetBits)->ArgNames({"bits", "percent"})->Args({1 << 20, 1})->Args({1 << 20, 50})->Args({1 << 20, 99});
+
+    void BitVectorGetSetIndices(benchmark::State& state) {
+        storm::storage::BitVector vector = storm::benchmark::createRandomBitVector(state.range(0), state.range(1) / 100.0);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(vector.getSetIndices());
+        }
+        state.SetItemsProcessed(state.iterations() * vector.getNumberOfSetBits());
+    }
+    BENCHMARK(BitVectorGetSetIndices)->ArgNames({"bits", "percent"})->Args({1 << 20, 1})->Args({1 << 20, 50})->Args({1 << 20, 99});
+
+    // Creates keys of the given size (in bits) that look like compressed states, i.e. they share most of their bits.
+    std::vector<storm::storage::BitVector> createKeys(uint64_t numberOfKeys, uint64_t bitsPerKey) {
+        std::mt19937_64 generator(42);
+        std::vector<storm::storage::BitVector> keys;
+        keys.reserve(numberOfKeys);
+        for (uint64_t key = 0; key < numberOfKeys; ++key) {
+            storm::storage::BitVector vector(bitsPerKey);
+            vector.setFromInt(0, std::min<uint64_t>(bitsPerKey, 64), generator());
+            keys.push_back(std::move(vector));
+        }
+        return keys;
+    }
+
+    void BitVectorHashMapFindOrAddInsert(benchmark::State& state) {
+        std::vector<storm::storage::BitVector> keys = createKeys(state.range(0), 128);
+        for (auto _ : state) {
+            storm::storage::BitVectorHashMap<uint32_t> map(128);
+            uint32_t index = 0;
+            for (auto const& key : keys) {
+                benchmark::DoNotOptimize(map.findOrAdd(key, index++));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * keys.size());
+    }
+    BENCHMARK(BitVectorHashMapFindOrAddInsert)->ArgNames({"keys"})->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
+
+    void BitVectorHashMapFindOrAddLookup(benchmark::State& state) {
+        std::vector<storm::storage::BitVector> keys = createKeys(state.range(0), 128);
+        storm::storage::BitVectorHashMap<uint32_t> map(128);
+        uint32_t index = 0;
+        for (auto const& key : keys) {
+            map.findOrAdd(key, index++);
+        }
+        for (auto _ : state) {
+            for (auto const& key : keys) {
+                benchmark::DoNotOptimize(map.findOrAdd(key, 0));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * keys.size());
+    }
+    BENCHMARK(BitVectorHashMapFindOrAddLookup)->ArgNames({"keys"})->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
+
+}
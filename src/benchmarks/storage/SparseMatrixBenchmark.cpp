@@ -0,0 +1,63 @@
+#include "benchmarks/storm_benchmark.h"
+
+#include "storm/solver/OptimizationDirection.h"
+
+namespace {
+
+    // A multiplication reads all entries, the row indications and the input vector and writes the result.
+    int64_t getBytesPerMultiplication(storm::storage::SparseMatrix<double> const& matrix) {
+        return matrix.getEntryCount() * sizeof(storm::storage::MatrixEntry<uint_fast64_t, double>) + (matrix.getRowCount() + 1) * sizeof(uint_fast64_t) + (matrix.getRowCount() + matrix.getColumnCount()) * sizeof(double);
+    }
+
+    void SparseMatrixMultiplyWithVector(benchmark::State& state) {
+        storm::storage::SparseMatrix<double> matrix = storm::benchmark::createRandomMatrix(state.range(0), 1, state.range(1));
+        std::vector<double> x(matrix.getColumnCount(), 0.5);
+        std::vector<double> result(matrix.getRowCount());
+        for (auto _ : state) {
+            matrix.multiplyWithVector(x, result);
+            benchmark::DoNotOptimize(result.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * matrix.getEntryCount());
+        state.SetBytesProcessed(state.iterations() * getBytesPerMultiplication(matrix));
+    }
+    BENCHMARK(SparseMatrixMultiplyWithVector)->ArgNames({"rows", "entries"})->Args({1 << 12, 4})->Args({1 << 16, 4})->Args({1 << 20, 4})->Args({1 << 16, 16})->Unit(benchmark::kMicrosecond);
+
+    void SparseMatrixMultiplyAndReduce(benchmark::State& state) {
+        storm::storage::SparseMatrix<double> matrix = storm::benchmark::createRandomMatrix(state.range(0), state.range(1), 4);
+        std::vector<double> x(matrix.getColumnCount(), 0.5);
+        std::vector<double> b(matrix.getRowCount(), 0.1);
+        std::vector<double> result(matrix.getRowGroupCount());
+        for (auto _ : state) {
+            matrix.multiplyAndReduce(storm::solver::OptimizationDirection::Maximize, matrix.getRowGroupIndices(), x, &b, result, nullptr);
+            benchmark::DoNotOptimize(result.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * matrix.getEntryCount());
+        state.SetBytesProcessed(state.iterations() * getBytesPerMultiplication(matrix));
+    }
+    BENCHMARK(SparseMatrixMultiplyAndReduce)->ArgNames({"groups", "choices"})->Args({1 << 12, 3})->Args({1 << 16, 3})->Args({1 << 20, 3})->Args({1 << 16, 16})->Unit(benchmark::kMicrosecond);
+
+    void SparseMatrixMultiplyAndReduceGaussSeidel(benchmark::State& state) {
+        storm::storage::SparseMatrix<double> matrix = storm::benchmark::createRandomMatrix(state.range(0), 3, 4);
+        std::vector<double> x(matrix.getColumnCount(), 0.5);
+        std::vector<double> b(matrix.getRowCount(), 0.1);
+        for (auto _ : state) {
+            matrix.multiplyAndReduceBackward(storm::solver::OptimizationDirection::Minimize, matrix.getRowGroupIndices(), x, &b, x, nullptr);
+            benchmark::DoNotOptimize(x.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * matrix.getEntryCount());
+    }
+    BENCHMARK(SparseMatrixMultiplyAndReduceGaussSeidel)->ArgNames({"groups"})->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
+
+    void SparseMatrixTranspose(benchmark::State& state) {
+        storm::storage::SparseMatrix<double> matrix = storm::benchmark::createRandomMatrix(state.range(0), 3, 4);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(matrix.transpose(true));
+        }
+        state.SetItemsProcessed(state.iterations() * matrix.getEntryCount());
+    }
+    BENCHMARK(SparseMatrixTranspose)->ArgNames({"groups"})->Arg(1 << 12)->Arg(1 << 16)->Unit(benchmark::kMicrosecond);
+
+}
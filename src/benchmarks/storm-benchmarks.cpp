@@ -0,0 +1,22 @@
+#include "benchmarks/storm_benchmark.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/utility/initialize.h"
+#include "storm-version-info/storm-version.h"
+
+int main(int argc, char** argv) {
+    storm::settings::initializeAll("Storm Benchmarks", "storm-benchmarks");
+    storm::utility::initializeLogger();
+    // Only errors are printed, such that the output of the benchmarks is not polluted.
+    storm::utility::setLogLevel(l3pp::LogLevel::ERR);
+
+    // Record the version in the output such that results of different versions can be told apart.
+    ::benchmark::AddCustomContext("storm_version", storm::StormVersion::shortVersionString());
+    ::benchmark::AddCustomContext("storm_git_revision", storm::StormVersion::gitRevisionHash);
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
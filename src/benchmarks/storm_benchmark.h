@@ -0,0 +1,60 @@
+#pragma once
+
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "storm-config.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace benchmark {
+
+        /*!
+         * Creates a matrix with the given number of row groups whose rows have (about) the given number of entries
+         * with random successors. The rows of each row group sum up to one. The same parameters always yield the
+         * same matrix, which keeps the results comparable across runs.
+         */
+        inline storm::storage::SparseMatrix<double> createRandomMatrix(uint64_t numberOfRowGroups, uint64_t rowsPerGroup, uint64_t entriesPerRow, uint64_t seed = 42) {
+            std::mt19937_64 generator(seed);
+            std::uniform_int_distribution<uint64_t> columnDistribution(0, numberOfRowGroups - 1);
+            storm::storage::SparseMatrixBuilder<double> builder(numberOfRowGroups * rowsPerGroup, numberOfRowGroups, numberOfRowGroups * rowsPerGroup * entriesPerRow, false, rowsPerGroup > 1, rowsPerGroup > 1 ? numberOfRowGroups : 0);
+            uint64_t row = 0;
+            std::vector<uint64_t> columns;
+            for (uint64_t group = 0; group < numberOfRowGroups; ++group) {
+                if (rowsPerGroup > 1) {
+                    builder.newRowGroup(row);
+                }
+                for (uint64_t choice = 0; choice < rowsPerGroup; ++choice, ++row) {
+                    columns.clear();
+                    for (uint64_t entry = 0; entry < entriesPerRow; ++entry) {
+                        columns.push_back(columnDistribution(generator));
+                    }
+                    std::sort(columns.begin(), columns.end());
+                    columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+                    for (auto const& column : columns) {
+                        builder.addNextValue(row, column, 1.0 / columns.size());
+                    }
+                }
+            }
+            return builder.build();
+        }
+
+        /*!
+         * Creates a bit vector of the given size in which (about) the given fraction of bits is set.
+         */
+        inline storm::storage::BitVector createRandomBitVector(uint64_t size, double fraction, uint64_t seed = 42) {
+            std::mt19937_64 generator(seed);
+            std::bernoulli_distribution distribution(fraction);
+            storm::storage::BitVector result(size);
+            for (uint64_t index = 0; index < size; ++index) {
+                if (distribution(generator)) {
+                    result.set(index);
+                }
+            }
+            return result;
+        }
+
+    }
+}
@@ -280,6 +280,12 @@ namespace storm {
             STORM_LOG_THROW(mpi.verificationValueType == ModelProcessingInformation::ValueType::FinitePrecision, storm::exceptions::NotSupportedException, "No exact numbers or parameters are supported in this build.");
             processInputWithValueType<double>(symbolicInput, mpi);
 #endif
+            
+            // Export the performance counters (if requested)
+            auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+            if (mpi.env.hasPerformanceCounters()) {
+                mpi.env.getPerformanceCounters()->exportToFile(ioSettings.getExportPerformanceCountersFilename(), ioSettings.getExportPerformanceCountersFormat());
+            }
         }
 
         void printTimeAndMemoryStatistics(uint64_t wallclockMilliseconds) {
@@ -10,6 +10,7 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/Engine.h"
+#include "storm/utility/PerformanceCounters.h"
 #include "storm/utility/AutomaticSettings.h"
 
 #include "storm/utility/initialize.h"
@@ -30,6 +31,8 @@
 #include "storm/exceptions/OptionParserException.h"
 
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpSolverSession.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
@@ -318,6 +321,11 @@ namespace storm {
                 }
             }
             
+            // Collect performance counters if they are to be exported.
+            if (ioSettings.isExportPerformanceCountersSet()) {
+                mpi.env.setPerformanceCounters(std::make_shared<storm::utility::PerformanceCounters>());
+            }
+            
             // Set the Dd library
             mpi.ddType = coreSettings.getDdLibraryType();
             if (mpi.ddType == storm::dd::DdType::CUDD && coreSettings.isDdLibraryTypeSetFromDefaultValue()) {
@@ -472,6 +480,8 @@ namespace storm {
                 storm::parser::DirectEncodingParserOptions options;
                 options.buildChoiceLabeling = buildSettings.isBuildChoiceLabelsSet();
                 result = storm::api::buildExplicitDRNModel<ValueType>(ioSettings.getExplicitDRNFilename(), options);
+            } else if (ioSettings.isExplicitBinarySet()) {
+                result = storm::api::buildExplicitBinaryModel<ValueType>(ioSettings.getExplicitBinaryFilename());
             } else {
                 STORM_LOG_THROW(ioSettings.isExplicitIMCASet(), storm::exceptions::InvalidSettingsException, "Unexpected explicit model input type.");
                 result = storm::api::buildExplicitIMCAModel<ValueType>(ioSettings.getExplicitIMCAFilename());
@@ -485,6 +495,7 @@ namespace storm {
 
             auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
             std::shared_ptr<storm::models::ModelBase> result;
+            storm::utility::PerformanceCounters::Scope scope(mpi.env.getPerformanceCounters(), "model building");
             if (input.model) {
                 auto builderType = storm::utility::getBuilderType(mpi.engine);
                 if (builderType == storm::builder::BuilderType::Dd) {
@@ -492,7 +503,7 @@ namespace storm {
                 } else if (builderType == storm::builder::BuilderType::Explicit || builderType == storm::builder::BuilderType::Jit) {
                     result = buildModelSparse<ValueType>(input, buildSettings, builderType == storm::builder::BuilderType::Jit);
                 }
-            } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitIMCASet()) {
+            } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitBinarySet() || ioSettings.isExplicitIMCASet()) {
                 STORM_LOG_THROW(mpi.engine == storm::utility::Engine::Sparse, storm::exceptions::InvalidSettingsException, "Can only use sparse engine with explicit input.");
                 result = buildModelExplicit<ValueType>(ioSettings, buildSettings);
             }
@@ -533,9 +544,10 @@ namespace storm {
             if (bisimulationSettings.isWeakBisimulationSet()) {
                 bisimType = storm::storage::BisimulationType::Weak;
             }
+            bool signatureRefinement = bisimulationSettings.getSparseRefinementMode() == storm::settings::modules::BisimulationSettings::SparseRefinementMode::Signature;
             
             STORM_LOG_INFO("Performing bisimulation minimization...");
-            return storm::api::performBisimulationMinimization<ValueType>(model, createFormulasToRespect(input.properties), bisimType);
+            return storm::api::performBisimulationMinimization<ValueType>(model, createFormulasToRespect(input.properties), bisimType, signatureRefinement);
         }
         
         template <typename ValueType>
@@ -552,6 +564,7 @@ namespace storm {
             }
             
             if (mpi.applyBisimulation) {
+                storm::utility::PerformanceCounters::Scope scope(mpi.env.getPerformanceCounters(), "bisimulation");
                 result.first = preprocessSparseModelBisimulation(result.first, input, bisimulationSettings);
                 result.second = true;
             }
@@ -578,6 +591,10 @@ namespace storm {
             if (ioSettings.isExportExplicitSet()) {
                 storm::api::exportSparseModelAsDrn(model, ioSettings.getExportExplicitFilename(), input.model ? input.model.get().getParameterNames() : std::vector<std::string>(), !ioSettings.isExplicitExportPlaceholdersDisabled());
             }
+            
+            if (ioSettings.isExportBinarySet()) {
+                storm::api::exportSparseModelAsBinary(model, ioSettings.getExportBinaryFilename());
+            }
 
             if (ioSettings.isExportDdSet()) {
                 STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exporting in drdd format is only supported for DDs.");
@@ -595,6 +612,10 @@ namespace storm {
             if (ioSettings.isExportExplicitSet()) {
                 STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exporting in drn format is only supported for sparse models.");
             }
+            
+            if (ioSettings.isExportBinarySet()) {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exporting in the binary format is only supported for sparse models.");
+            }
 
             if (ioSettings.isExportDdSet()) {
                 storm::api::exportSparseModelAsDrdd(model, ioSettings.getExportDdFilename());
@@ -657,6 +678,7 @@ namespace storm {
             std::unique_ptr<std::pair<std::shared_ptr<storm::models::Model<ExportValueType>>, bool>> result;
             auto symbolicModel = intermediateResult.first->template as<storm::models::symbolic::Model<DdType, ValueType>>();
             if (mpi.applyBisimulation) {
+                storm::utility::PerformanceCounters::Scope scope(mpi.env.getPerformanceCounters(), "bisimulation");
                 std::shared_ptr<storm::models::Model<ExportValueType>> newModel = preprocessDdModelBisimulation<DdType, ValueType, ExportValueType>(symbolicModel, input, bisimulationSettings, mpi);
                 result = std::make_unique<std::pair<std::shared_ptr<storm::models::Model<ExportValueType>>, bool>>(newModel, true);
             } else {
@@ -995,12 +1017,23 @@ namespace storm {
         void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
             auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
             auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
-            auto verificationCallback = [&sparseModel,&ioSettings,&mpi] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+            
+            // If requested, the properties share the data of the solvers.
+            std::shared_ptr<storm::modelchecker::helper::SparseMdpSolverSession<ValueType>> solverSession;
+            if (storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isReuseSolverSet() && sparseModel->isOfType(storm::models::ModelType::Mdp)) {
+                solverSession = std::make_shared<storm::modelchecker::helper::SparseMdpSolverSession<ValueType>>();
+            }
+            auto verificationCallback = [&sparseModel,&ioSettings,&mpi,&solverSession] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
                                             bool filterForInitialStates = states->isInitialFormula();
                                             auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
                                             if (ioSettings.isExportSchedulerSet()) {
                                                 task.setProduceSchedulers(true);
                                             }
+                                            if (solverSession) {
+                                                auto hint = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<ValueType>>();
+                                                hint->setSolverSession(solverSession);
+                                                task.setHint(hint);
+                                            }
                                             std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task);
                                             
                                             std::unique_ptr<storm::modelchecker::CheckResult> filter;
@@ -0,0 +1,158 @@
+#include "storm-parsers/parser/BinaryEncodingParser.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "storm-parsers/parser/MappedFile.h"
+
+#include "storm/io/BinaryEncodingExporter.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+    namespace parser {
+
+        namespace detail {
+            /*!
+             * Reads the sections of a mapped file in the binary format.
+             */
+            class BinaryEncodingReader {
+            public:
+                BinaryEncodingReader(char const* begin, char const* end) : current(begin), end(end) {
+                    // Intentionally left empty.
+                }
+
+                /*!
+                 * Retrieves a pointer to the next section that consists of the given number of elements.
+                 */
+                template<typename T>
+                T const* readArray(uint64_t size) {
+                    // Check the size before computing the number of bytes, as the latter may overflow for corrupted files.
+                    uint64_t remainingBytes = static_cast<uint64_t>(end - current);
+                    STORM_LOG_THROW(size <= remainingBytes / sizeof(T), storm::exceptions::WrongFormatException, "Unexpected end of file.");
+                    uint64_t numberOfBytes = size * sizeof(T);
+                    uint64_t paddedNumberOfBytes = (numberOfBytes + 7) / 8 * 8;
+                    STORM_LOG_THROW(remainingBytes >= paddedNumberOfBytes, storm::exceptions::WrongFormatException, "Unexpected end of file.");
+                    T const* result = reinterpret_cast<T const*>(current);
+                    current += paddedNumberOfBytes;
+                    return result;
+                }
+
+                template<typename T>
+                std::vector<T> readVector(uint64_t size) {
+                    T const* data = readArray<T>(size);
+                    return std::vector<T>(data, data + size);
+                }
+
+                uint64_t readWord() {
+                    return *readArray<uint64_t>(1);
+                }
+
+                std::string readString() {
+                    uint64_t size = readWord();
+                    char const* data = readArray<char>(size);
+                    return std::string(data, size);
+                }
+
+                storm::storage::BitVector readBitVector(uint64_t size) {
+                    uint64_t const* buckets = readArray<uint64_t>(size / 64 + (size % 64 != 0 ? 1 : 0));
+                    storm::storage::BitVector result(size);
+                    for (uint64_t index = 0; index < size; index += 64) {
+                        uint64_t numberOfBits = std::min<uint64_t>(64, size - index);
+                        result.setFromInt(index, numberOfBits, buckets[index / 64]);
+                    }
+                    return result;
+                }
+
+                bool isAtEnd() const {
+                    return current == end;
+                }
+
+            private:
+                char const* current;
+                char const* end;
+            };
+        }
+
+        std::shared_ptr<storm::models::sparse::Model<double>> BinaryEncodingParser::parseModel(std::string const& filename) {
+            typedef storm::exporter::BinaryEncodingHeader Header;
+            STORM_LOG_INFO("Reading from file " << filename);
+            MappedFile file(filename.c_str());
+            STORM_LOG_THROW(file.getDataSize() >= sizeof(Header), storm::exceptions::WrongFormatException, "The file " << filename << " is too small to contain a model in the binary format.");
+
+            Header header;
+            std::memcpy(&header, file.getData(), sizeof(Header));
+            STORM_LOG_THROW(header.magic == Header::MAGIC, storm::exceptions::WrongFormatException, "The file " << filename << " does not contain a model in the binary format (or was written on a machine with a different byte order).");
+            STORM_LOG_THROW(header.version == Header::VERSION, storm::exceptions::WrongFormatException, "Unsupported version " << header.version << " of the binary format.");
+            storm::models::ModelType type = static_cast<storm::models::ModelType>(header.modelType);
+            STORM_LOG_THROW(type == storm::models::ModelType::Dtmc || type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp, storm::exceptions::WrongFormatException, "Unsupported model type in the binary format.");
+            bool trivialRowGrouping = (header.flags & Header::FLAG_TRIVIAL_ROW_GROUPING) != 0;
+            STORM_LOG_THROW(!trivialRowGrouping || header.numberOfRows == header.numberOfStates, storm::exceptions::WrongFormatException, "Number of rows does not match the number of states.");
+            STORM_LOG_THROW(header.numberOfStates < std::numeric_limits<uint64_t>::max() && header.numberOfRows < std::numeric_limits<uint64_t>::max(), storm::exceptions::WrongFormatException, "Invalid number of states or rows.");
+
+            detail::BinaryEncodingReader reader(file.getData() + sizeof(Header), file.getDataEnd());
+
+            // Read the transition matrix.
+            std::vector<uint64_t> rowIndications = reader.readVector<uint64_t>(header.numberOfRows + 1);
+            STORM_LOG_THROW(rowIndications.front() == 0 && rowIndications.back() == header.numberOfEntries && std::is_sorted(rowIndications.begin(), rowIndications.end()), storm::exceptions::WrongFormatException, "Invalid row indications.");
+            boost::optional<std::vector<uint64_t>> rowGroupIndices;
+            if (!trivialRowGrouping) {
+                rowGroupIndices = reader.readVector<uint64_t>(header.numberOfStates + 1);
+                STORM_LOG_THROW(rowGroupIndices->front() == 0 && rowGroupIndices->back() == header.numberOfRows && std::is_sorted(rowGroupIndices->begin(), rowGroupIndices->end()), storm::exceptions::WrongFormatException, "Invalid row group indices.");
+            }
+            uint64_t const* columns = reader.readArray<uint64_t>(header.numberOfEntries);
+            double const* values = reader.readArray<double>(header.numberOfEntries);
+            std::vector<storm::storage::MatrixEntry<uint64_t, double>> columnsAndValues;
+            columnsAndValues.reserve(header.numberOfEntries);
+            for (uint64_t entry = 0; entry < header.numberOfEntries; ++entry) {
+                STORM_LOG_THROW(columns[entry] < header.numberOfStates, storm::exceptions::WrongFormatException, "Invalid column " << columns[entry] << ".");
+                columnsAndValues.emplace_back(columns[entry], values[entry]);
+            }
+
+            storm::storage::sparse::ModelComponents<double> components(storm::storage::SparseMatrix<double>(header.numberOfStates, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices)), storm::models::sparse::StateLabeling(header.numberOfStates));
+
+            // Read model type specific components.
+            if (header.flags & Header::FLAG_EXIT_RATES) {
+                components.exitRates = reader.readVector<double>(header.numberOfStates);
+            }
+            if (header.flags & Header::FLAG_MARKOVIAN_STATES) {
+                components.markovianStates = reader.readBitVector(header.numberOfStates);
+            }
+            if (header.flags & Header::FLAG_OBSERVATIONS) {
+                components.observabilityClasses = reader.readVector<uint32_t>(header.numberOfStates);
+            }
+            // We read rates for CTMCs.
+            components.rateTransitions = type == storm::models::ModelType::Ctmc;
+
+            // Read labels.
+            for (uint64_t label = 0; label < header.numberOfLabels; ++label) {
+                std::string name = reader.readString();
+                components.stateLabeling.addLabel(name, reader.readBitVector(header.numberOfStates));
+            }
+
+            // Read reward models.
+            for (uint64_t rewardModel = 0; rewardModel < header.numberOfRewardModels; ++rewardModel) {
+                std::string name = reader.readString();
+                uint64_t rewardFlags = reader.readWord();
+                boost::optional<std::vector<double>> stateRewards;
+                boost::optional<std::vector<double>> stateActionRewards;
+                if (rewardFlags & Header::REWARDS_STATE) {
+                    stateRewards = reader.readVector<double>(header.numberOfStates);
+                }
+                if (rewardFlags & Header::REWARDS_STATE_ACTION) {
+                    stateActionRewards = reader.readVector<double>(header.numberOfRows);
+                }
+                components.rewardModels.emplace(name, storm::models::sparse::StandardRewardModel<double>(std::move(stateRewards), std::move(stateActionRewards)));
+            }
+            STORM_LOG_THROW(reader.isAtEnd(), storm::exceptions::WrongFormatException, "Unexpected data at the end of file " << filename << ".");
+
+            return storm::utility::builder::buildModelFromComponents(type, std::move(components));
+        }
+
+    } // namespace parser
+} // namespace storm
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+    namespace parser {
+
+        /*!
+         * Parser for sparse models in the binary format written by storm::exporter::binaryExportSparseModel. The file
+         * is mapped to memory and the components of the model are copied in bulk from the mapped sections, i.e., no
+         * values need to be parsed.
+         */
+        class BinaryEncodingParser {
+        public:
+
+            /*!
+             * Loads a model in the binary format from a file and creates the model.
+             *
+             * @param filename The file to be loaded.
+             *
+             * @return A sparse model
+             */
+            static std::shared_ptr<storm::models::sparse::Model<double>> parseModel(std::string const& filename);
+        };
+
+    } // namespace parser
+} // namespace storm
@@ -2,6 +2,7 @@
 
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm-parsers/parser/BinaryEncodingParser.h"
 #include "storm-parsers/parser/ImcaMarkovAutomatonParser.h"
 
 #include "storm/storage/SymbolicModelDescription.h"
@@ -163,6 +164,16 @@ namespace storm {
             return storm::parser::DirectEncodingParser<ValueType>::parseModel(drnFile, options);
         }
         
+        template<typename ValueType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitBinaryModel(std::string const&) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact or parametric models with binary encoding are not supported.");
+        }
+        
+        template<>
+        inline std::shared_ptr<storm::models::sparse::Model<double>> buildExplicitBinaryModel(std::string const& binaryFile) {
+            return storm::parser::BinaryEncodingParser::parseModel(binaryFile);
+        }
+        
         template<typename ValueType>
         std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitIMCAModel(std::string const&) {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact models with direct encoding are not supported.");
@@ -3,6 +3,7 @@
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/io/DirectEncodingExporter.h"
+#include "storm/io/BinaryEncodingExporter.h"
 #include "storm/io/DDEncodingExporter.h"
 #include "storm/io/file.h"
 #include "storm/utility/macros.h"
@@ -32,6 +33,14 @@ namespace storm {
             storm::utility::closeFile(stream);
         }
 
+        template <typename ValueType>
+        void exportSparseModelAsBinary(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename) {
+            std::ofstream stream(filename, std::ios::out | std::ios::binary);
+            STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+            storm::exporter::binaryExportSparseModel(stream, model);
+            storm::utility::closeFile(stream);
+        }
+
         template<storm::dd::DdType Type, typename ValueType>
         void exportSparseModelAsDrdd(std::shared_ptr<storm::models::symbolic::Model<Type,ValueType>> const& model, std::string const& filename) {
             storm::exporter::explicitExportSymbolicModel(filename, model);
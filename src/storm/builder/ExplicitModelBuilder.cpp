@@ -1,6 +1,9 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <algorithm>
 #include <map>
+#include <type_traits>
+#include <unordered_map>
 
 
 #include "storm/builder/RewardModelBuilder.h"
@@ -9,6 +12,8 @@
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/OutOfRangeException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 #include "storm/generator/PrismNextStateGenerator.h"
 #include "storm/generator/JaniNextStateGenerator.h"
@@ -21,6 +26,7 @@
 
 #include "storm/settings/modules/BuildSettings.h"
 
+#include "storm/storage/ExternalSparseMatrixBuilder.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/Automaton.h"
@@ -31,6 +37,7 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/prism.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/SignalHandler.h"
 
@@ -46,23 +53,33 @@ namespace storm {
         }
 
         template <typename ValueType, typename RewardModelType, typename StateType>
-        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()) {
-            // Intentionally left empty.
+        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()), parallelExploration(storm::settings::getModule<storm::settings::modules::BuildSettings>().isParallelExplorationSet()) {
+            auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+            if (buildSettings.isMemoryBudgetSet()) {
+                memoryBudget = buildSettings.getMemoryBudget() * 1024 * 1024;
+            }
+            if (buildSettings.isExternalStorageDirectorySet()) {
+                externalStorageDirectory = buildSettings.getExternalStorageDirectory();
+            }
         }
 
         template <typename ValueType, typename RewardModelType, typename StateType>
-        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options) : generator(generator), options(options), stateStorage(generator->getStateSize()) {
+        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options) : generator(generator), options(options), stateStorage(generator->getStateSize()), statesToExploreBatchSize(0) {
             // Intentionally left empty.
         }
 
         template <typename ValueType, typename RewardModelType, typename StateType>
         ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(storm::prism::Program const& program, storm::generator::NextStateGeneratorOptions const& generatorOptions, Options const& builderOptions) : ExplicitModelBuilder(std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions), builderOptions) {
-            // Intentionally left empty.
+            if (this->options.parallelExploration) {
+                generatorFactory = [program, generatorOptions] () { return std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions); };
+            }
         }
 
         template <typename ValueType, typename RewardModelType, typename StateType>
         ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(storm::jani::Model const& model, storm::generator::NextStateGeneratorOptions const& generatorOptions, Options const& builderOptions) : ExplicitModelBuilder(std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions), builderOptions) {
-            // Intentionally left empty.
+            if (this->options.parallelExploration) {
+                generatorFactory = [model, generatorOptions] () { return std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions); };
+            }
         }
 
         template <typename ValueType, typename RewardModelType, typename StateType>
@@ -94,9 +111,7 @@ namespace storm {
             StateType newIndex = static_cast<StateType>(stateStorage.getNumberOfStates());
 
             // Check, if the state was already registered.
-            std::pair<StateType, std::size_t> actualIndexBucketPair = stateStorage.stateToId.findOrAddAndGetBucket(state, newIndex);
-
-            StateType actualIndex = actualIndexBucketPair.first;
+            StateType actualIndex = stateStorage.findOrAdd(state, newIndex);
 
             if (actualIndex == newIndex) {
                 if (options.explorationOrder == ExplorationOrder::Dfs) {
@@ -105,7 +120,11 @@ namespace storm {
                     // Reserve one slot for the new state in the remapping.
                     stateRemapping.get().push_back(storm::utility::zero<StateType>());
                 } else if (options.explorationOrder == ExplorationOrder::Bfs) {
-                    statesToExplore.emplace_back(state, actualIndex);
+                    if (externalStatesToExplore) {
+                        externalStatesToExplore->push(state, actualIndex);
+                    } else {
+                        statesToExplore.emplace_back(state, actualIndex);
+                    }
                 } else {
                     STORM_LOG_ASSERT(false, "Invalid exploration order.");
                 }
@@ -116,11 +135,23 @@ namespace storm {
 
         template <typename ValueType, typename RewardModelType, typename StateType>
         ExplicitStateLookup<StateType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::exportExplicitStateLookup() const {
+            STORM_LOG_THROW(!this->stateStorage.hasExternalStates(), storm::exceptions::NotSupportedException, "Cannot export the state lookup as states were moved to external storage.");
             return ExplicitStateLookup<StateType>(this->generator->getVariableInformation(), this->stateStorage.stateToId);
         }
 
         template <typename ValueType, typename RewardModelType, typename StateType>
-        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+        bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::hasStatesToExplore() {
+            if (statesToExplore.empty() && externalStatesToExplore) {
+                while (statesToExplore.size() < statesToExploreBatchSize && !externalStatesToExplore->empty()) {
+                    statesToExplore.push_back(externalStatesToExplore->pop());
+                }
+            }
+            return !statesToExplore.empty();
+        }
+
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        template <typename MatrixBuilderType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(MatrixBuilderType& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
 
             // Initialize building state valuations (if necessary)
             if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
@@ -141,6 +172,19 @@ namespace storm {
             this->stateStorage.initialStateIndices = generator->getInitialStates(stateToIdCallback);
             STORM_LOG_THROW(!this->stateStorage.initialStateIndices.empty(), storm::exceptions::WrongFormatException, "The model does not have a single initial state.");
 
+            bool useParallelExploration = options.parallelExploration;
+            if (useParallelExploration) {
+                STORM_LOG_WARN_COND(options.explorationOrder == ExplorationOrder::Bfs, "Parallel exploration requires breadth-first exploration order. Falling back to sequential exploration.");
+                STORM_LOG_WARN_COND(generatorFactory, "Parallel exploration requires the builder to be constructed from a PRISM program or JANI model. Falling back to sequential exploration.");
+                STORM_LOG_WARN_COND(!generator->getOptions().isAddOverlappingGuardLabelSet(), "Parallel exploration does not support the label for overlapping guards. Falling back to sequential exploration.");
+                useParallelExploration = options.explorationOrder == ExplorationOrder::Bfs && generatorFactory && !generator->getOptions().isAddOverlappingGuardLabelSet();
+            }
+            if (useParallelExploration) {
+                // As the exploration is breadth-first, the state indices need not be remapped afterwards.
+                exploreStatesInParallel(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+                return;
+            }
+
             // Now explore the current state until there is no more reachable state.
             uint_fast64_t currentRowGroup = 0;
             uint_fast64_t currentRow = 0;
@@ -151,7 +195,7 @@ namespace storm {
             uint64_t numberOfExploredStatesSinceLastMessage = 0;
 
             // Perform a search through the model.
-            while (!statesToExplore.empty()) {
+            while (hasStatesToExplore()) {
                 // Get the first state in the queue.
                 CompressedState currentState = statesToExplore.front().first;
                 StateType currentIndex = statesToExplore.front().second;
@@ -172,101 +216,7 @@ namespace storm {
                     generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
                 }
                 storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
-
-                // If there is no behavior, we might have to introduce a self-loop.
-                if (behavior.empty()) {
-                    if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
-                        // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
-                        if (behavior.wasExpanded()) {
-                            this->stateStorage.deadlockStateIndices.push_back(currentIndex);
-                        }
-
-                        if (!generator->isDeterministicModel()) {
-                            transitionMatrixBuilder.newRowGroup(currentRow);
-                        }
-
-                        transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
-
-                        for (auto& rewardModelBuilder : rewardModelBuilders) {
-                            if (rewardModelBuilder.hasStateRewards()) {
-                                rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
-                            }
-
-                            if (rewardModelBuilder.hasStateActionRewards()) {
-                                rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
-                            }
-                        }
-                        
-                        // This state shall be Markovian (to not introduce Zeno behavior)
-                        if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
-                            stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
-                        }
-                        // Other state-based information does not need to be treated, in particular:
-                        // * StateValuations have already been set above
-                        // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
-
-                        ++currentRow;
-                        ++currentRowGroup;
-                    } else {
-                        STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << generator->stateToString(currentState) << "). For fixing these, please provide the appropriate option.");
-                    }
-                } else {
-                    // Add the state rewards to the corresponding reward models.
-                    auto stateRewardIt = behavior.getStateRewards().begin();
-                    for (auto& rewardModelBuilder : rewardModelBuilders) {
-                        if (rewardModelBuilder.hasStateRewards()) {
-                            rewardModelBuilder.addStateReward(*stateRewardIt);
-                        }
-                        ++stateRewardIt;
-                    }
-
-                    // If the model is nondeterministic, we need to open a row group.
-                    if (!generator->isDeterministicModel()) {
-                        transitionMatrixBuilder.newRowGroup(currentRow);
-                    }
-
-                    // Now add all choices.
-                    bool firstChoiceOfState = true;
-                    for (auto const& choice : behavior) {
-
-                        // add the generated choice information
-                        if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
-                            for (auto const& label : choice.getLabels()) {
-                                stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
-                            }
-                        }
-                        if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
-                            stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
-                        }
-                        if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
-                            STORM_LOG_ASSERT(firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup), "There is a state where different players have an enabled choice."); // Should have been detected in generator, already
-                            if (firstChoiceOfState) {
-                                stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
-                            }
-                        }
-                        if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() &&  choice.isMarkovian()) {
-                            stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
-                        }
-
-                        // Add the probabilistic behavior to the matrix.
-                        for (auto const& stateProbabilityPair : choice) {
-                            transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
-                        }
-
-                        // Add the rewards to the reward models.
-                        auto choiceRewardIt = choice.getRewards().begin();
-                        for (auto& rewardModelBuilder : rewardModelBuilders) {
-                            if (rewardModelBuilder.hasStateActionRewards()) {
-                                rewardModelBuilder.addStateActionReward(*choiceRewardIt);
-                            }
-                            ++choiceRewardIt;
-                        }
-                        ++currentRow;
-                        firstChoiceOfState = false;
-                    }
-
-                    ++currentRowGroup;
-                }
+                addStateBehavior(currentState, currentIndex, behavior, nullptr, 0, currentRow, currentRowGroup, transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
 
                 ++numberOfExploredStates;
                 if (generator->getOptions().isShowProgressSet()) {
@@ -319,6 +269,235 @@ namespace storm {
             }
         }
 
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        template <typename MatrixBuilderType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::exploreStatesInParallel(MatrixBuilderType& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+            typedef std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> GeneratorPointer;
+
+            // The result of expanding a single state.
+            struct ExpandedState {
+                storm::generator::StateBehavior<ValueType, StateType> behavior;
+
+                // The successors that were not known before the current level was started (in the order in which the
+                // generator requested their indices).
+                std::vector<CompressedState> newSuccessors;
+            };
+
+            // Create one generator per worker on the calling thread, as their construction is not thread-safe. Each
+            // level is then split into one slot per generator and every slot is only ever expanded by the task that
+            // owns it, so no generator is shared or created within the parallel region.
+            std::vector<GeneratorPointer> generators = {generator};
+            for (uint64_t thread = 1; thread < storm::utility::parallel::getNumberOfThreads(); ++thread) {
+                generators.push_back(generatorFactory());
+            }
+            uint64_t const numberOfSlots = generators.size();
+            STORM_LOG_DEBUG("Exploring the state space with " << numberOfSlots << " generators.");
+
+            uint_fast64_t currentRowGroup = 0;
+            uint_fast64_t currentRow = 0;
+
+            auto timeOfStart = std::chrono::high_resolution_clock::now();
+            auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
+            uint64_t numberOfExploredStates = 0;
+            uint64_t numberOfExploredStatesSinceLastMessage = 0;
+
+            std::vector<std::pair<CompressedState, StateType>> currentLevel;
+            std::vector<ExpandedState> expandedStates;
+            std::vector<StateType> newStateIndices;
+            while (hasStatesToExplore()) {
+                currentLevel.assign(std::make_move_iterator(statesToExplore.begin()), std::make_move_iterator(statesToExplore.end()));
+                statesToExplore.clear();
+                expandedStates.clear();
+                expandedStates.resize(currentLevel.size());
+
+                // While the level is expanded, the state storage is only read. Successors that are not yet contained
+                // in it receive placeholder indices starting from the current number of states.
+                StateType firstPlaceholderIndex = static_cast<StateType>(stateStorage.getNumberOfStates());
+                uint64_t const statesPerSlot = (currentLevel.size() + numberOfSlots - 1) / numberOfSlots;
+                storm::utility::parallel::parallelFor(0, numberOfSlots, 1, [&] (auto const& slotRange) {
+                    for (uint64_t slot = slotRange.begin(); slot < slotRange.end(); ++slot) {
+                        GeneratorPointer const& localGenerator = generators[slot];
+                        uint64_t const slotBegin = std::min<uint64_t>(slot * statesPerSlot, currentLevel.size());
+                        uint64_t const slotEnd = std::min<uint64_t>(slotBegin + statesPerSlot, currentLevel.size());
+
+                        ExpandedState* currentExpandedState = nullptr;
+                        std::unordered_map<CompressedState, StateType> placeholderIndices;
+                        std::function<StateType (CompressedState const&)> stateToIdCallback = [&] (CompressedState const& state) -> StateType {
+                            if (stateStorage.contains(state)) {
+                                return stateStorage.getValue(state);
+                            }
+                            auto placeholderIt = placeholderIndices.find(state);
+                            if (placeholderIt != placeholderIndices.end()) {
+                                return placeholderIt->second;
+                            }
+                            STORM_LOG_THROW(currentExpandedState->newSuccessors.size() < std::numeric_limits<StateType>::max() - firstPlaceholderIndex, storm::exceptions::OutOfRangeException, "Too many states for the chosen state index type.");
+                            StateType placeholderIndex = firstPlaceholderIndex + static_cast<StateType>(currentExpandedState->newSuccessors.size());
+                            placeholderIndices.emplace(state, placeholderIndex);
+                            currentExpandedState->newSuccessors.push_back(state);
+                            return placeholderIndex;
+                        };
+
+                        for (uint64_t levelIndex = slotBegin; levelIndex < slotEnd; ++levelIndex) {
+                            currentExpandedState = &expandedStates[levelIndex];
+                            placeholderIndices.clear();
+                            localGenerator->load(currentLevel[levelIndex].first);
+                            currentExpandedState->behavior = localGenerator->expand(stateToIdCallback);
+                        }
+                    }
+                });
+
+                // Now assign the indices of the new states and add the behaviors in the order of the level.
+                for (uint64_t levelIndex = 0; levelIndex < currentLevel.size(); ++levelIndex) {
+                    CompressedState const& currentState = currentLevel[levelIndex].first;
+                    StateType currentIndex = currentLevel[levelIndex].second;
+                    STORM_LOG_ASSERT(currentIndex == currentRowGroup, "Unexpected index of state in breadth-first exploration.");
+                    ExpandedState& expandedState = expandedStates[levelIndex];
+
+                    newStateIndices.clear();
+                    for (auto const& successor : expandedState.newSuccessors) {
+                        newStateIndices.push_back(getOrAddStateIndex(successor));
+                    }
+
+                    if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+                        generator->load(currentState);
+                        generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
+                    }
+                    addStateBehavior(currentState, currentIndex, expandedState.behavior, &newStateIndices, firstPlaceholderIndex, currentRow, currentRowGroup, transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+
+                    // Release the memory of the behavior as early as possible.
+                    expandedState = ExpandedState();
+                }
+
+                numberOfExploredStates += currentLevel.size();
+                if (generator->getOptions().isShowProgressSet()) {
+                    numberOfExploredStatesSinceLastMessage += currentLevel.size();
+
+                    auto now = std::chrono::high_resolution_clock::now();
+                    auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
+                    if (static_cast<uint64_t>(durationSinceLastMessage) >= generator->getOptions().getShowProgressDelay()) {
+                        auto statesPerSecond = numberOfExploredStatesSinceLastMessage / std::max<decltype(durationSinceLastMessage)>(durationSinceLastMessage, 1);
+                        auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfStart).count();
+                        std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds (currently " << statesPerSecond << " states per second)." << std::endl;
+                        timeOfLastMessage = std::chrono::high_resolution_clock::now();
+                        numberOfExploredStatesSinceLastMessage = 0;
+                    }
+                }
+
+                if (storm::utility::resources::isTerminate()) {
+                    auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
+                    std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds before abort." << std::endl;
+                    STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
+                }
+            }
+        }
+
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        template <typename MatrixBuilderType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addStateBehavior(CompressedState const& state, StateType const& stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior, std::vector<StateType> const* newStateIndices, StateType const& firstPlaceholderIndex, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup, MatrixBuilderType& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+            // If there is no behavior, we might have to introduce a self-loop.
+            if (behavior.empty()) {
+                if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
+                    // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
+                    if (behavior.wasExpanded()) {
+                        this->stateStorage.deadlockStateIndices.push_back(stateIndex);
+                    }
+
+                    if (!generator->isDeterministicModel()) {
+                        transitionMatrixBuilder.newRowGroup(currentRow);
+                    }
+
+                    transitionMatrixBuilder.addNextValue(currentRow, stateIndex, storm::utility::one<ValueType>());
+
+                    for (auto& rewardModelBuilder : rewardModelBuilders) {
+                        if (rewardModelBuilder.hasStateRewards()) {
+                            rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+                        }
+
+                        if (rewardModelBuilder.hasStateActionRewards()) {
+                            rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                        }
+                    }
+                    
+                    // This state shall be Markovian (to not introduce Zeno behavior)
+                    if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
+                        stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+                    }
+                    // Other state-based information does not need to be treated, in particular:
+                    // * StateValuations have already been set by the caller
+                    // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
+
+                    ++currentRow;
+                    ++currentRowGroup;
+                } else {
+                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << generator->stateToString(state) << "). For fixing these, please provide the appropriate option.");
+                }
+            } else {
+                // Add the state rewards to the corresponding reward models.
+                auto stateRewardIt = behavior.getStateRewards().begin();
+                for (auto& rewardModelBuilder : rewardModelBuilders) {
+                    if (rewardModelBuilder.hasStateRewards()) {
+                        rewardModelBuilder.addStateReward(*stateRewardIt);
+                    }
+                    ++stateRewardIt;
+                }
+
+                // If the model is nondeterministic, we need to open a row group.
+                if (!generator->isDeterministicModel()) {
+                    transitionMatrixBuilder.newRowGroup(currentRow);
+                }
+
+                // Now add all choices.
+                bool firstChoiceOfState = true;
+                for (auto const& choice : behavior) {
+
+                    // add the generated choice information
+                    if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
+                        for (auto const& label : choice.getLabels()) {
+                            stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
+                        }
+                    }
+                    if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
+                        stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
+                    }
+                    if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
+                        STORM_LOG_ASSERT(firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup), "There is a state where different players have an enabled choice."); // Should have been detected in generator, already
+                        if (firstChoiceOfState) {
+                            stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
+                        }
+                    }
+                    if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() &&  choice.isMarkovian()) {
+                        stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+                    }
+
+                    // Add the probabilistic behavior to the matrix. If the successors are given by placeholders, the
+                    // entries of the row may be added out of order, which is fixed by the matrix builder.
+                    if (newStateIndices) {
+                        for (auto const& stateProbabilityPair : choice) {
+                            StateType column = stateProbabilityPair.first < firstPlaceholderIndex ? stateProbabilityPair.first : (*newStateIndices)[stateProbabilityPair.first - firstPlaceholderIndex];
+                            transitionMatrixBuilder.addNextValue(currentRow, column, stateProbabilityPair.second);
+                        }
+                    } else {
+                        for (auto const& stateProbabilityPair : choice) {
+                            transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                        }
+                    }
+
+                    // Add the rewards to the reward models.
+                    auto choiceRewardIt = choice.getRewards().begin();
+                    for (auto& rewardModelBuilder : rewardModelBuilders) {
+                        if (rewardModelBuilder.hasStateActionRewards()) {
+                            rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+                        }
+                        ++choiceRewardIt;
+                    }
+                    ++currentRow;
+                    firstChoiceOfState = false;
+                }
+
+                ++currentRowGroup;
+            }
+        }
+
         template <typename ValueType, typename RewardModelType, typename StateType>
         storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildModelComponents() {
 
@@ -327,7 +506,6 @@ namespace storm {
             bool deterministicModel = generator->isDeterministicModel();
 
             // Prepare the component builders
-            storm::storage::SparseMatrixBuilder<ValueType> transitionMatrixBuilder(0, 0, 0, false, !deterministicModel, 0);
             std::vector<RewardModelBuilder<typename RewardModelType::ValueType>> rewardModelBuilders;
             for (uint64_t i = 0; i < generator->getNumberOfRewardModels(); ++i) {
                 rewardModelBuilders.emplace_back(generator->getRewardModelInformation(i));
@@ -339,10 +517,38 @@ namespace storm {
             stateAndChoiceInformationBuilder.setBuildMarkovianStates(generator->getModelType() == storm::generator::ModelType::MA);
             stateAndChoiceInformationBuilder.setBuildStateValuations(generator->getOptions().isBuildStateValuationsSet());
 
-            buildMatrices(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+            bool useExternalStorage = static_cast<bool>(options.memoryBudget);
+            if (useExternalStorage) {
+                STORM_LOG_WARN_COND(options.explorationOrder == ExplorationOrder::Bfs, "Exploration with a memory budget requires breadth-first exploration order. Ignoring the memory budget.");
+                STORM_LOG_WARN_COND((std::is_same<ValueType, double>::value), "Exploration with a memory budget is only supported for double precision values. Ignoring the memory budget.");
+                useExternalStorage = options.explorationOrder == ExplorationOrder::Bfs && std::is_same<ValueType, double>::value;
+            }
+
+            storm::storage::SparseMatrix<ValueType> transitionMatrix;
+            if (useExternalStorage) {
+                // Half of the budget is used for the states that are kept in memory (plus a Bloom filter of an eighth
+                // of the budget). The states to explore are held in batches of 1/16 of the budget (plus the buffers
+                // of the external queue of the same size) and the matrix entries are buffered in chunks of 1/16 of the
+                // budget. The remaining memory accounts for the reward models and state information.
+                uint64_t budget = options.memoryBudget.get();
+                uint64_t bytesPerState = generator->getStateSize() / 8 + sizeof(StateType);
+                stateStorage.enableExternalStorage(budget / 2, options.externalStorageDirectory);
+                statesToExploreBatchSize = std::max<uint64_t>(budget / 16 / bytesPerState, 1);
+                externalStatesToExplore = std::make_unique<storm::storage::ExternalBitVectorQueue<StateType>>(generator->getStateSize(), statesToExploreBatchSize, options.externalStorageDirectory);
+                STORM_LOG_INFO("Exploring the state space with a memory budget of " << budget << " bytes.");
+
+                storm::storage::ExternalSparseMatrixBuilder<ValueType> transitionMatrixBuilder(!deterministicModel, std::max<uint64_t>(budget / 16 / sizeof(storm::storage::MatrixEntry<uint_fast64_t, ValueType>), 1), options.externalStorageDirectory);
+                buildMatrices(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+                externalStatesToExplore.reset();
+                transitionMatrix = transitionMatrixBuilder.build(0, transitionMatrixBuilder.getCurrentRowGroupCount());
+            } else {
+                storm::storage::SparseMatrixBuilder<ValueType> transitionMatrixBuilder(0, 0, 0, false, !deterministicModel, 0);
+                buildMatrices(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+                transitionMatrix = transitionMatrixBuilder.build(0, transitionMatrixBuilder.getCurrentRowGroupCount());
+            }
             
             // Initialize the model components with the obtained information.
-            storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents(transitionMatrixBuilder.build(0, transitionMatrixBuilder.getCurrentRowGroupCount()), buildStateLabeling(), std::unordered_map<std::string, RewardModelType>(), !generator->isDiscreteTimeModel());
+            storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents(std::move(transitionMatrix), buildStateLabeling(), std::unordered_map<std::string, RewardModelType>(), !generator->isDiscreteTimeModel());
 
             uint_fast64_t numStates = modelComponents.transitionMatrix.getColumnCount();
             uint_fast64_t numChoices = modelComponents.transitionMatrix.getRowCount();
@@ -375,10 +581,10 @@ namespace storm {
             if (generator->isPartiallyObservable()) {
                 std::vector<uint32_t> classes(stateStorage.getNumberOfStates());
                 std::unordered_map<uint32_t, std::vector<std::pair<std::vector<std::string>, uint32_t>>> observationActions;
-                for (auto const& bitVectorIndexPair : stateStorage.stateToId) {
-                    uint32_t varObservation = generator->observabilityClass(bitVectorIndexPair.first);
-                    classes[bitVectorIndexPair.second] = varObservation;
-                }
+                stateStorage.forEachState([&] (CompressedState const& state, StateType const& index) {
+                    uint32_t varObservation = generator->observabilityClass(state);
+                    classes[index] = varObservation;
+                });
 
                 modelComponents.observabilityClasses = classes;
                 if(generator->getOptions().isBuildObservationValuationsSet()) {
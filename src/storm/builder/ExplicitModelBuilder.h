@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 #include <deque>
+#include <functional>
 #include <cstdint>
 #include <boost/functional/hash.hpp>
 #include <boost/container/flat_map.hpp>
@@ -21,6 +22,7 @@
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/sparse/ModelComponents.h"
 #include "storm/storage/sparse/StateStorage.h"
+#include "storm/storage/ExternalBitVectorQueue.h"
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/utility/prism.h"
@@ -72,6 +74,17 @@ namespace storm {
                 
                 // The order in which to explore the model.
                 ExplorationOrder explorationOrder;
+
+                // A flag indicating whether the state space is to be explored by multiple threads.
+                bool parallelExploration;
+
+                // If set, the number of bytes of memory that the data structures used during the exploration may
+                // occupy. Whenever the states or the transitions exceed this budget, they are moved to temporary files.
+                boost::optional<uint64_t> memoryBudget;
+
+                // The directory in which the temporary files are created (if empty, the default directory for
+                // temporary files is used).
+                std::string externalStorageDirectory;
             };
             
             /*!
@@ -125,11 +138,50 @@ namespace storm {
             /*!
              * Builds the transition matrix and the transition reward matrix based for the given program.
              *
+             * @param transitionMatrixBuilder The builder of the transition matrix (either a SparseMatrixBuilder or, if
+             * the exploration is performed with a memory budget, an ExternalSparseMatrixBuilder).
+             * @param rewardModelBuilders The builders for the selected reward models.
+             * @param stateAndChoiceInformationBuilder The builder for the requested information of the individual states and choices
+             */
+            template<typename MatrixBuilderType>
+            void buildMatrices(MatrixBuilderType& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
+
+            /*!
+             * Explores the state space breadth-first and level by level. The states of a level are expanded in
+             * parallel, where each thread uses its own generator and successors that were not known before the level
+             * was started are assigned placeholder indices. These are then resolved in the order of the level, which
+             * yields the same numbering of the states as the sequential breadth-first exploration.
+             *
              * @param transitionMatrixBuilder The builder of the transition matrix.
              * @param rewardModelBuilders The builders for the selected reward models.
              * @param stateAndChoiceInformationBuilder The builder for the requested information of the individual states and choices
              */
-            void buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
+            template<typename MatrixBuilderType>
+            void exploreStatesInParallel(MatrixBuilderType& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
+
+            /*!
+             * Adds the given behavior of the given state to the builders, i.e., opens a new row group and adds one row
+             * per choice (or a self-loop if the state is a deadlock state).
+             *
+             * @param state The state whose behavior is added.
+             * @param stateIndex The index of the state.
+             * @param behavior The behavior of the state.
+             * @param newStateIndices If given, all columns that are at least the given first placeholder index are
+             * placeholders for the state indices stored at the corresponding position of this vector.
+             * @param firstPlaceholderIndex The smallest placeholder index (only relevant if new state indices are given).
+             * @param currentRow The next row of the transition matrix (which is updated accordingly).
+             * @param currentRowGroup The next row group of the transition matrix (which is updated accordingly).
+             */
+            template<typename MatrixBuilderType>
+            void addStateBehavior(CompressedState const& state, StateType const& stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior, std::vector<StateType> const* newStateIndices, StateType const& firstPlaceholderIndex, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup, MatrixBuilderType& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
+
+            /*!
+             * Checks whether there are states left to explore. If the states to explore are kept in external storage,
+             * this moves the next batch of them to the in-memory queue of states to explore.
+             *
+             * @return True iff there are states left to explore.
+             */
+            bool hasStatesToExplore();
 
             /*!
              * Explores the state space of the given program and returns the components of the model as a result.
@@ -148,6 +200,10 @@ namespace storm {
             /// The generator to use for the building process.
             std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
 
+            /// A function that creates further generators for the same input. This is only set if the state space is
+            /// to be explored in parallel and the builder was constructed from a PRISM program or JANI model.
+            std::function<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>()> generatorFactory;
+
             /// The options to be used for the building process.
             Options options;
 
@@ -157,6 +213,13 @@ namespace storm {
             /// A set of states that still need to be explored.
             std::deque<std::pair<CompressedState, StateType>> statesToExplore;
 
+            /// If the exploration is performed out of core, the states that still need to be explored and do not fit into
+            /// statesToExplore.
+            std::unique_ptr<storm::storage::ExternalBitVectorQueue<StateType>> externalStatesToExplore;
+
+            /// The number of states that are moved from the external storage to statesToExplore at once.
+            uint64_t statesToExploreBatchSize;
+
             /// An optional mapping from state indices to the row groups in which they actually reside. This needs to be
             /// built in case the exploration order is not BFS.
             boost::optional<std::vector<uint_fast64_t>> stateRemapping;
@@ -1,6 +1,9 @@
 #include "storm/builder/jit/ExplicitJitJaniModelBuilder.h"
 
 #include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <iterator>
 #include <cstdio>
 #include <chrono>
 #include <errno.h>
@@ -37,6 +40,7 @@
 
 #include "storm/utility/OsDetection.h"
 #include "storm-config.h"
+#include "storm-version-info/storm-version.h"
 
 namespace storm {
     namespace builder {
@@ -53,6 +57,20 @@ namespace storm {
 #ifdef WINDOWS
             static const std::string DYLIB_EXTENSION = ".dll";
 #endif
+            
+            /*!
+             * Computes the key of a cache entry with the given content (the 64 bit FNV-1a hash in hexadecimal).
+             */
+            static std::string computeCacheKey(std::string const& content) {
+                uint64_t hash = 14695981039346656037ull;
+                for (char character : content) {
+                    hash ^= static_cast<unsigned char>(character);
+                    hash *= 1099511628211ull;
+                }
+                std::stringstream keyStream;
+                keyStream << std::hex << std::setw(16) << std::setfill('0') << hash;
+                return keyStream.str();
+            }
       
             template <typename ValueType, typename RewardModelType>
             storm::jani::ModelFeatures ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::getSupportedJaniFeatures() {
@@ -82,7 +100,7 @@ namespace storm {
             }
             
             template <typename ValueType, typename RewardModelType>
-            ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::ExplicitJitJaniModelBuilder(storm::jani::Model const& model, storm::builder::BuilderOptions const& options) : options(options), model(model.substituteConstantsFunctions()), modelComponentsBuilder(model.getModelType()) {
+            ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::ExplicitJitJaniModelBuilder(storm::jani::Model const& model, storm::builder::BuilderOptions const& options) : options(options), modelComponentsBuilder(model.getModelType()) {
                 
                 // Load all options from the settings module.
                 storm::settings::modules::JitBuilderSettings const& settings = storm::settings::getModule<storm::settings::modules::JitBuilderSettings>();
@@ -137,6 +155,11 @@ namespace storm {
                 gmpIncludeDirectory = "";
 #endif
                 sparseppIncludeDirectory = STORM_BUILD_DIR "/include/resources/3rdparty/sparsepp/";
+                if (settings.isCacheDirectorySet()) {
+                    cacheDirectory = settings.getCacheDirectory();
+                }
+                
+                this->model = substituteConstantsFunctions(model);
                 
                 // Register all transient variables as transient.
                 for (auto const& variable : this->model.getGlobalVariables().getTransientVariables()) {
@@ -195,6 +218,94 @@ namespace storm {
                 // storm::jani::JsonExporter::toStream(this->model, std::vector<std::shared_ptr<storm::logic::Formula const>>(), std::cout, false);
             }
             
+            template <typename ValueType, typename RewardModelType>
+            storm::jani::Model ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::substituteConstantsFunctions(storm::jani::Model const& model) {
+                // Constants only become runtime constants if the compiled builder is reused. We restrict this to
+                // double models, because only then the values can be passed to the shared library easily.
+                if (!cacheDirectory || !std::is_same<double, ValueType>::value) {
+                    return model.substituteConstantsFunctions();
+                }
+                
+                // Determine the values of all defined real-valued constants.
+                std::map<storm::expressions::Variable, storm::expressions::Expression> candidates;
+                for (auto const& constant : model.substituteConstants().getConstants()) {
+                    if (constant.isDefined() && constant.isRealConstant() && constant.getExpression().getVariables().empty()) {
+                        candidates.emplace(constant.getExpressionVariable(), constant.getExpression());
+                    }
+                }
+                if (candidates.empty()) {
+                    return model.substituteConstantsFunctions();
+                }
+                
+                auto substituteAllBut = [&model] (std::map<storm::expressions::Variable, storm::expressions::Expression> const& keptConstants) {
+                    storm::jani::Model result(model);
+                    for (auto& constant : result.getConstants()) {
+                        if (keptConstants.count(constant.getExpressionVariable()) > 0) {
+                            constant = storm::jani::Constant(constant.getName(), constant.getExpressionVariable(), storm::expressions::Expression(), constant.hasConstraint() ? constant.getConstraintExpression() : storm::expressions::Expression());
+                        }
+                    }
+                    return result.substituteConstantsFunctions();
+                };
+                
+                // Keep the candidates as undefined constants and find out which of them occur in expressions that we
+                // evaluate when generating the source code, i.e. variable bounds, initial values and definitions of
+                // other constants. These are substituted as usual.
+                storm::jani::Model candidateModel = substituteAllBut(candidates);
+                std::set<storm::expressions::Variable> staticVariables;
+                auto collectVariables = [&staticVariables] (storm::expressions::Expression const& expression) {
+                    if (expression.isInitialized()) {
+                        std::set<storm::expressions::Variable> variables = expression.getVariables();
+                        staticVariables.insert(variables.begin(), variables.end());
+                    }
+                };
+                std::vector<std::reference_wrapper<storm::jani::Automaton const>> automata(candidateModel.getAutomata().begin(), candidateModel.getAutomata().end());
+                for (auto const& expression : candidateModel.getAllRangeExpressions(automata)) {
+                    collectVariables(expression);
+                }
+                collectVariables(candidateModel.getInitialStatesRestriction());
+                for (auto const& variable : candidateModel.getGlobalVariables()) {
+                    if (variable.hasInitExpression()) {
+                        collectVariables(variable.getInitExpression());
+                    }
+                }
+                for (auto const& automaton : candidateModel.getAutomata()) {
+                    collectVariables(automaton.getInitialStatesRestriction());
+                    for (auto const& variable : automaton.getVariables()) {
+                        if (variable.hasInitExpression()) {
+                            collectVariables(variable.getInitExpression());
+                        }
+                    }
+                }
+                for (auto const& constant : candidateModel.getConstants()) {
+                    if (constant.isDefined()) {
+                        collectVariables(constant.getExpression());
+                    }
+                }
+                
+                std::map<storm::expressions::Variable, storm::expressions::Expression> keptConstants;
+                for (auto const& candidate : candidates) {
+                    if (staticVariables.count(candidate.first) == 0) {
+                        keptConstants.insert(candidate);
+                        runtimeConstants.push_back(candidate.first);
+                        runtimeConstantValues.push_back(candidate.second.evaluateAsDouble());
+                    }
+                }
+                
+                storm::jani::Model result = keptConstants.size() == candidates.size() ? std::move(candidateModel) : substituteAllBut(keptConstants);
+                
+                // Define the runtime constants again (without substituting them), such that the model does not appear
+                // to contain undefined constants.
+                for (auto& constant : result.getConstants()) {
+                    auto constantIt = keptConstants.find(constant.getExpressionVariable());
+                    if (constantIt != keptConstants.end()) {
+                        constant.define(constantIt->second);
+                    }
+                }
+                STORM_LOG_TRACE("Treating " << runtimeConstants.size() << " constant(s) as runtime constants.");
+                
+                return result;
+            }
+            
             template <typename ValueType, typename RewardModelType>
             boost::optional<std::string> ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::execute(std::string command) {
                 auto start = std::chrono::high_resolution_clock::now();
@@ -524,20 +635,41 @@ namespace storm {
                 }
                 STORM_LOG_TRACE("Successfully created source code for model generation: " << source);
                 
-                // (2) Write the source code to a temporary file.
-                boost::filesystem::path temporarySourceFile = writeToTemporaryFile(source);
-                
-                // (3) Compile the source code to a shared library.
-                boost::filesystem::path dynamicLibraryPath = compileToSharedLibrary(temporarySourceFile);
-                STORM_LOG_TRACE("Successfully compiled shared library.");
-                
-                // (4) Remove the source code of the shared library we just compiled.
-                boost::filesystem::remove(temporarySourceFile);
+                // (2) Look up the shared library in the cache (if any).
+                boost::filesystem::path dynamicLibraryPath;
+                bool isCachedLibrary = false;
+                std::string cacheEntryContent;
+                std::string cacheKey;
+                if (cacheDirectory) {
+                    cacheEntryContent = getCacheEntryContent(source);
+                    cacheKey = computeCacheKey(cacheEntryContent);
+                    boost::optional<boost::filesystem::path> cachedLibraryPath = retrieveFromCache(cacheKey, cacheEntryContent);
+                    if (cachedLibraryPath) {
+                        STORM_LOG_INFO("Reusing shared library " << cachedLibraryPath.get() << " from the cache.");
+                        dynamicLibraryPath = cachedLibraryPath.get();
+                        isCachedLibrary = true;
+                    }
+                }
+                
+                if (!isCachedLibrary) {
+                    // (3) Write the source code to a temporary file.
+                    boost::filesystem::path temporarySourceFile = writeToTemporaryFile(source);
+                    
+                    // (4) Compile the source code to a shared library.
+                    dynamicLibraryPath = compileToSharedLibrary(temporarySourceFile);
+                    STORM_LOG_TRACE("Successfully compiled shared library.");
+                    
+                    // (5) Remove the source code of the shared library we just compiled and store the library in the cache.
+                    boost::filesystem::remove(temporarySourceFile);
+                    if (cacheDirectory) {
+                        storeInCache(cacheKey, cacheEntryContent, dynamicLibraryPath);
+                    }
+                }
                 
-                // (5) Create the builder from the shared library.
+                // (6) Create the builder from the shared library.
                 createBuilder(dynamicLibraryPath);
                 
-                // (6) Execute the build function of the builder in the shared library and build the actual model.
+                // (7) Execute the build function of the builder in the shared library and build the actual model.
                 auto start = std::chrono::high_resolution_clock::now();
                 
                 std::shared_ptr<storm::models::sparse::Model<ValueType, storm::models::sparse::StandardRewardModel<ValueType>>> sparseModel(nullptr);
@@ -553,8 +685,10 @@ namespace storm {
                 auto end = std::chrono::high_resolution_clock::now();
                 STORM_LOG_TRACE("Building model took " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
                 
-                // (7) Delete the shared library.
-                boost::filesystem::remove(dynamicLibraryPath);
+                // (8) Delete the shared library (unless it is kept in the cache).
+                if (!isCachedLibrary) {
+                    boost::filesystem::remove(dynamicLibraryPath);
+                }
                 
                 STORM_LOG_THROW(!error, storm::exceptions::WrongFormatException, "Model building failed. Reason: " << error.get());
                 
@@ -610,6 +744,7 @@ namespace storm {
                 if (std::is_same<storm::RationalFunction, ValueType>::value) {
                     generateParameters(modelData);
                 }
+                generateRuntimeConstants(modelData);
                 
                 // Generate non-trivial model-information.
                 generateVariables(modelData);
@@ -1661,6 +1796,19 @@ namespace storm {
                 }
                 modelData["parameters"] = cpptempl::make_data(parameters);
             }
+            
+            template <typename ValueType, typename RewardModelType>
+            void ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::generateRuntimeConstants(cpptempl::data_map& modelData) {
+                cpptempl::data_list constants;
+                for (auto const& variable : runtimeConstants) {
+                    // Runtime constants are global variables of the shared library, so we do not register a prefix.
+                    variableToName[variable] = variable.getName() + JIT_VARIABLE_EXTENSION;
+                    cpptempl::data_map constant;
+                    constant["name"] = variableToName[variable];
+                    constants.push_back(constant);
+                }
+                modelData["runtime_constants"] = cpptempl::make_data(constants);
+            }
 
             template <typename ValueType, typename RewardModelType>
             std::string const& ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::getVariableName(storm::expressions::Variable const& variable) const {
@@ -1973,6 +2121,16 @@ namespace storm {
                             }
                             {% endif %}
                             
+                            {% if double %}
+                            {% for constant in runtime_constants %}static double {$constant.name};
+                            {% endfor %}
+                            
+                            void initialize_constants(std::vector<double> const& values) {
+                                {% for constant in runtime_constants %}{$constant.name} = values[{$loop.index} - 1];
+                                {% endfor %}
+                            }
+                            {% endif %}
+                            
                             // Non-synchronizing edges.
                             {% for edge in nonsynch_edges %}static bool edge_enabled_{$edge.name}(StateType const& in, TransientVariables const& transientIn) {
                                 if ({$edge.guard}) {
@@ -2517,6 +2675,9 @@ namespace storm {
                             {% if parametric %}
                             BOOST_DLL_ALIAS(storm::builder::jit::initialize_parameters, initialize_parameters)
                             {% endif %}
+                            {% if double %}
+                            BOOST_DLL_ALIAS(storm::builder::jit::initialize_constants, initialize_constants)
+                            {% endif %}
                         }
                     }
                 }
@@ -2590,6 +2751,77 @@ namespace storm {
                     std::vector<storm::RationalFunction> parameters = getParameters<ValueType>(this->model, cache);
                     initializeParametersFunction(parameters);
                 }
+                
+                if (std::is_same<double, ValueType>::value) {
+                    typedef void (InitializeConstantsFunctionType)(std::vector<double> const&);
+                    typedef boost::function<InitializeConstantsFunctionType> ImportInitializeConstantsFunctionType;
+                    
+                    ImportInitializeConstantsFunctionType initializeConstantsFunction = boost::dll::import_alias<InitializeConstantsFunctionType>(dynamicLibraryPath, "initialize_constants");
+                    initializeConstantsFunction(runtimeConstantValues);
+                }
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            std::string ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::getCacheEntryContent(std::string const& source) const {
+                std::stringstream contentStream;
+                // The generated code includes the headers of Storm, so entries of other versions of Storm must not be reused.
+                // For builds from modified sources, the revision is not sufficient and we add the build time.
+                contentStream << "// Storm " << storm::StormVersion::shortVersionString() << " " << storm::StormVersion::gitRevisionHash;
+                if (storm::StormVersion::dirty != storm::StormVersion::DirtyState::Clean) {
+                    contentStream << " built " << __DATE__ << " " << __TIME__;
+                }
+                contentStream << std::endl;
+                contentStream << "// " << compiler << " " << compilerFlags;
+                for (std::string const& dir : {stormIncludeDirectory, sparseppIncludeDirectory, boostIncludeDirectory, carlIncludeDirectory, clnIncludeDirectory, gmpIncludeDirectory}) {
+                    if (dir != "") {
+                        contentStream << " -I" << dir;
+                    }
+                }
+                contentStream << std::endl << source;
+                return contentStream.str();
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            boost::optional<boost::filesystem::path> ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::retrieveFromCache(std::string const& key, std::string const& content) const {
+                boost::filesystem::path contentFile = boost::filesystem::path(cacheDirectory.get()) / (key + ".cpp");
+                boost::filesystem::path dynamicLibraryPath = boost::filesystem::path(cacheDirectory.get()) / (key + DYLIB_EXTENSION);
+                
+                boost::system::error_code errorCode;
+                if (!boost::filesystem::exists(contentFile, errorCode) || !boost::filesystem::exists(dynamicLibraryPath, errorCode)) {
+                    return boost::none;
+                }
+                
+                std::ifstream in(contentFile.native());
+                std::string cachedContent((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+                if (cachedContent != content) {
+                    STORM_LOG_WARN("Cache entry " << key << " does not match the source code of the model builder and is ignored.");
+                    return boost::none;
+                }
+                return boost::filesystem::absolute(dynamicLibraryPath);
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            void ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::storeInCache(std::string const& key, std::string const& content, boost::filesystem::path const& dynamicLibraryPath) const {
+                boost::filesystem::path directory(cacheDirectory.get());
+                try {
+                    boost::filesystem::create_directories(directory);
+                    
+                    // Write both files under temporary names first and then rename them, such that concurrent runs never
+                    // see partially written entries. The library is moved last, because it marks the entry as complete.
+                    boost::filesystem::path temporaryContentFile = directory / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%.tmp");
+                    {
+                        std::ofstream out(temporaryContentFile.native());
+                        out << content;
+                    }
+                    boost::filesystem::rename(temporaryContentFile, directory / (key + ".cpp"));
+                    
+                    boost::filesystem::path temporaryLibraryFile = directory / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%.tmp");
+                    boost::filesystem::copy_file(dynamicLibraryPath, temporaryLibraryFile);
+                    boost::filesystem::rename(temporaryLibraryFile, directory / (key + DYLIB_EXTENSION));
+                    STORM_LOG_TRACE("Stored shared library in the cache under key " << key << ".");
+                } catch (boost::filesystem::filesystem_error const& e) {
+                    STORM_LOG_WARN("Unable to store the shared library in the cache directory " << directory << ": " << e.what());
+                }
             }
             
             template class ExplicitJitJaniModelBuilder<double, storm::models::sparse::StandardRewardModel<double>>;
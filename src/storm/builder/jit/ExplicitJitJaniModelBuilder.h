@@ -93,6 +93,14 @@ namespace storm {
                  */
                 static boost::optional<std::string> execute(std::string command);
                 
+                /*!
+                 * Substitutes the constants and functions in the given model. If the builder is to be cached, defined
+                 * real-valued constants that are only used in expressions evaluated during the exploration are kept as
+                 * (undefined) constants and recorded as runtime constants, such that the generated source code does
+                 * not depend on their values.
+                 */
+                storm::jani::Model substituteConstantsFunctions(storm::jani::Model const& model);
+                
                 /*!
                  * Writes the given content to a temporary file. The temporary file is created to have the provided suffix.
                  */
@@ -116,6 +124,7 @@ namespace storm {
                 void generateLabels(cpptempl::data_map& modelData);
                 void generateTerminalExpressions(cpptempl::data_map& modelData);
                 void generateParameters(cpptempl::data_map& modelData);
+                void generateRuntimeConstants(cpptempl::data_map& modelData);
                 
                 // Functions related to the generation of edge data.
                 void generateEdges(cpptempl::data_map& modelData);
@@ -158,6 +167,24 @@ namespace storm {
                  */
                 void createBuilder(boost::filesystem::path const& dynamicLibraryPath);
 
+                /*!
+                 * Retrieves the content of the cache entry for the given source code, i.e. the source code prefixed
+                 * by the compiler invocation. The cache is addressed by the hash of this content.
+                 */
+                std::string getCacheEntryContent(std::string const& source) const;
+                
+                /*!
+                 * Retrieves the shared library with the given key from the cache (if any). A library is only reused if
+                 * the content of the cache entry matches the given content.
+                 */
+                boost::optional<boost::filesystem::path> retrieveFromCache(std::string const& key, std::string const& content) const;
+                
+                /*!
+                 * Stores a copy of the given shared library (and the content of the entry) in the cache. Failing to do
+                 * so only raises a warning.
+                 */
+                void storeInCache(std::string const& key, std::string const& content, boost::filesystem::path const& dynamicLibraryPath) const;
+
                 /// The options to use for model building.
                 storm::builder::BuilderOptions options;
                 
@@ -213,6 +240,14 @@ namespace storm {
                 /// The include directory for gmp
                 std::string gmpIncludeDirectory;
                 
+                /// The directory in which compiled shared libraries are cached (if any).
+                boost::optional<std::string> cacheDirectory;
+                
+                /// The constants that are set when loading the shared library rather than compiled into it together
+                /// with their values.
+                std::vector<storm::expressions::Variable> runtimeConstants;
+                std::vector<double> runtimeConstantValues;
+                
                 /// A cache that is used by carl.
                 std::shared_ptr<storm::RawPolynomialCache> cache;
             };
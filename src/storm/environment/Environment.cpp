@@ -2,6 +2,7 @@
 #include "storm/environment/SubEnvironment.h"
 #include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/utility/PerformanceCounters.h"
 
 namespace storm {
 
@@ -14,12 +15,13 @@ namespace storm {
         // Intentionally left empty.
     }
     
-    Environment::Environment(Environment const& other) : internalEnv(other.internalEnv) {
+    Environment::Environment(Environment const& other) : internalEnv(other.internalEnv), performanceCounters(other.performanceCounters) {
         // Intentionally left empty.
     }
     
     Environment& Environment::operator=(Environment const& other) {
         internalEnv = other.internalEnv;
+        performanceCounters = other.performanceCounters;
         return *this;
     }
     
@@ -38,4 +40,16 @@ namespace storm {
     ModelCheckerEnvironment const& Environment::modelchecker() const {
         return internalEnv.get().modelcheckerEnvironment.get();
     }
+    
+    storm::utility::PerformanceCounters* Environment::getPerformanceCounters() const {
+        return performanceCounters.get();
+    }
+    
+    bool Environment::hasPerformanceCounters() const {
+        return static_cast<bool>(performanceCounters);
+    }
+    
+    void Environment::setPerformanceCounters(std::shared_ptr<storm::utility::PerformanceCounters> const& counters) {
+        performanceCounters = counters;
+    }
 }
\ No newline at end of file
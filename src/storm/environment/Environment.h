@@ -1,9 +1,15 @@
 #pragma once
 
+#include <memory>
+
 #include "storm/environment/SubEnvironment.h"
 
 namespace storm {
     
+    namespace utility {
+        class PerformanceCounters;
+    }
+    
     // Forward declare sub-environments
     class SolverEnvironment;
     class ModelCheckerEnvironment;
@@ -27,9 +33,18 @@ namespace storm {
         ModelCheckerEnvironment& modelchecker();
         ModelCheckerEnvironment const& modelchecker() const;
         
+        /*!
+         * Retrieves the performance counters into which the computations report (or nullptr if none are set).
+         * Copies of this environment report into the same counters.
+         */
+        storm::utility::PerformanceCounters* getPerformanceCounters() const;
+        bool hasPerformanceCounters() const;
+        void setPerformanceCounters(std::shared_ptr<storm::utility::PerformanceCounters> const& counters);
+        
     private:
     
         SubEnvironment<InternalEnvironment> internalEnv;
+        std::shared_ptr<storm::utility::PerformanceCounters> performanceCounters;
     };
 }
 
@@ -37,6 +37,7 @@ namespace storm {
         if (multiobjectiveSettings.isMaxStepsSet()) {
             maxSteps = multiobjectiveSettings.getMaxSteps();
         }
+        parallelRefinementSteps = multiobjectiveSettings.getNumberOfParallelRefinementSteps();
         if (multiobjectiveSettings.hasSchedulerRestriction()) {
             schedulerRestriction = multiobjectiveSettings.getSchedulerRestriction();
         }
@@ -136,6 +137,15 @@ namespace storm {
         maxSteps = boost::none;
     }
     
+    uint64_t const& MultiObjectiveModelCheckerEnvironment::getNumberOfParallelRefinementSteps() const {
+        return parallelRefinementSteps;
+    }
+    
+    void MultiObjectiveModelCheckerEnvironment::setNumberOfParallelRefinementSteps(uint64_t const& value) {
+        STORM_LOG_THROW(value > 0, storm::exceptions::IllegalArgumentException, "At least one refinement step has to be performed at a time.");
+        parallelRefinementSteps = value;
+    }
+    
     bool MultiObjectiveModelCheckerEnvironment::isSchedulerRestrictionSet() const {
         return schedulerRestriction.is_initialized();
     }
@@ -53,6 +53,9 @@ namespace storm {
         void setMaxSteps(uint64_t const& value);
         void unsetMaxSteps();
         
+        uint64_t const& getNumberOfParallelRefinementSteps() const;
+        void setNumberOfParallelRefinementSteps(uint64_t const& value);
+        
         bool isSchedulerRestrictionSet() const;
         storm::storage::SchedulerClass const& getSchedulerRestriction() const;
         void setSchedulerRestriction(storm::storage::SchedulerClass const& value);
@@ -68,6 +71,7 @@ namespace storm {
         PrecisionType precisionType;
         EncodingType encodingType;
         boost::optional<uint64_t> maxSteps;
+        uint64_t parallelRefinementSteps;
         boost::optional<storm::storage::SchedulerClass> schedulerRestriction;
         bool printResults;
     };
@@ -22,6 +22,7 @@ namespace storm {
         STORM_LOG_ASSERT(considerRelativeTerminationCriterion || minMaxSettings.getConvergenceCriterion() == storm::settings::modules::MinMaxEquationSolverSettings::ConvergenceCriterion::Absolute, "Unknown convergence criterion");
         multiplicationStyle = minMaxSettings.getValueIterationMultiplicationStyle();
         symmetricUpdates = minMaxSettings.isForceIntervalIterationSymmetricUpdatesSet();
+        mixedPrecision = minMaxSettings.isMixedPrecisionSet();
     }
 
     MinMaxSolverEnvironment::~MinMaxSolverEnvironment() {
@@ -81,4 +82,12 @@ namespace storm {
         symmetricUpdates = value;
     }
     
+    bool MinMaxSolverEnvironment::isMixedPrecisionSet() const {
+        return mixedPrecision;
+    }
+    
+    void MinMaxSolverEnvironment::setMixedPrecision(bool value) {
+        mixedPrecision = value;
+    }
+    
 }
@@ -2,6 +2,7 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/MultiplierSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
@@ -11,6 +12,9 @@ namespace storm {
         auto const& multiplierSettings = storm::settings::getModule<storm::settings::modules::MultiplierSettings>();
         type = multiplierSettings.getMultiplierType();
         typeSetFromDefault = multiplierSettings.isMultiplierTypeSetFromDefaultValue();
+        structureOfArrays = multiplierSettings.isStructureOfArraysSet();
+        compressedMatrix = multiplierSettings.isCompressedMatrixSet();
+        parallel = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
     }
     
     MultiplierEnvironment::~MultiplierEnvironment() {
@@ -30,4 +34,28 @@ namespace storm {
         typeSetFromDefault = isSetFromDefault;
     }
     
+    bool MultiplierEnvironment::isStructureOfArraysSet() const {
+        return structureOfArrays;
+    }
+    
+    void MultiplierEnvironment::setStructureOfArrays(bool value) {
+        structureOfArrays = value;
+    }
+    
+    bool MultiplierEnvironment::isCompressedMatrixSet() const {
+        return compressedMatrix;
+    }
+    
+    void MultiplierEnvironment::setCompressedMatrix(bool value) {
+        compressedMatrix = value;
+    }
+    
+    bool MultiplierEnvironment::isParallelSet() const {
+        return parallel;
+    }
+    
+    void MultiplierEnvironment::setParallel(bool value) {
+        parallel = value;
+    }
+    
 }
@@ -15,9 +15,21 @@ namespace storm {
         bool const& isTypeSetFromDefault() const;
         void setType(storm::solver::MultiplierType value, bool isSetFromDefault = false);
         
+        bool isStructureOfArraysSet() const;
+        void setStructureOfArrays(bool value);
+        
+        bool isCompressedMatrixSet() const;
+        void setCompressedMatrix(bool value);
+        
+        bool isParallelSet() const;
+        void setParallel(bool value);
+        
     private:
         storm::solver::MultiplierType type;
         bool typeSetFromDefault;
+        bool structureOfArrays;
+        bool compressedMatrix;
+        bool parallel;
     };
 }
 
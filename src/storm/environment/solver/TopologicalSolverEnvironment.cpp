@@ -15,6 +15,8 @@ namespace storm {
         
         underlyingMinMaxMethod = topologicalSettings.getUnderlyingMinMaxMethod();
         underlyingMinMaxMethodSetFromDefault = topologicalSettings.isUnderlyingMinMaxMethodSetFromDefaultValue();
+        
+        parallel = topologicalSettings.isParallelSet();
     }
 
     TopologicalSolverEnvironment::~TopologicalSolverEnvironment() {
@@ -49,6 +51,14 @@ namespace storm {
         underlyingMinMaxMethod = value;
     }
     
+    bool TopologicalSolverEnvironment::isParallelSet() const {
+        return parallel;
+    }
+    
+    void TopologicalSolverEnvironment::setParallel(bool value) {
+        parallel = value;
+    }
+    
 
 
 }
@@ -0,0 +1,346 @@
+#include "storm/generator/BytecodeExpression.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expressions.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace generator {
+
+        BytecodeExpression::BytecodeExpression(std::vector<Instruction>&& instructions, uint32_t numberOfRegisters, uint32_t resultRegister, ValueKind resultKind) : instructions(std::move(instructions)), registers(std::max<uint32_t>(numberOfRegisters, 1)), resultRegister(resultRegister), resultKind(resultKind) {
+            // Intentionally left empty.
+        }
+
+        boost::optional<BytecodeExpression> BytecodeExpression::compile(storm::expressions::Expression const& expression, VariableInformation const& variableInformation) {
+            return BytecodeExpressionCompiler(variableInformation).compile(expression);
+        }
+
+        bool BytecodeExpression::evaluateAsBool(CompressedState const& state) const {
+            STORM_LOG_ASSERT(resultKind == ValueKind::Boolean, "Expression does not evaluate to a boolean value.");
+            return execute(state).integer != 0;
+        }
+
+        int64_t BytecodeExpression::evaluateAsInt(CompressedState const& state) const {
+            Value result = execute(state);
+            return resultKind == ValueKind::Double ? static_cast<int64_t>(result.rational) : result.integer;
+        }
+
+        double BytecodeExpression::evaluateAsDouble(CompressedState const& state) const {
+            Value result = execute(state);
+            return resultKind == ValueKind::Double ? result.rational : static_cast<double>(result.integer);
+        }
+
+        BytecodeExpression::ValueKind BytecodeExpression::getResultKind() const {
+            return resultKind;
+        }
+
+        uint64_t BytecodeExpression::getNumberOfInstructions() const {
+            return instructions.size();
+        }
+
+        BytecodeExpression::Value BytecodeExpression::execute(CompressedState const& state) const {
+            Value* r = registers.data();
+            uint64_t programCounter = 0;
+            uint64_t const numberOfInstructions = instructions.size();
+            while (programCounter < numberOfInstructions) {
+                Instruction const& instruction = instructions[programCounter];
+                ++programCounter;
+                switch (instruction.opcode) {
+                    case Opcode::LoadConstant: r[instruction.target] = instruction.immediate; break;
+                    case Opcode::LoadBoolean: r[instruction.target].integer = state.get(instruction.first) ? 1 : 0; break;
+                    case Opcode::LoadInteger: r[instruction.target].integer = static_cast<int64_t>(state.getAsInt(instruction.first, instruction.second)) + instruction.immediate.integer; break;
+                    case Opcode::IntegerToDouble: r[instruction.target].rational = static_cast<double>(r[instruction.first].integer); break;
+                    case Opcode::Move: r[instruction.target] = r[instruction.first]; break;
+                    case Opcode::Jump: programCounter = instruction.second; break;
+                    case Opcode::JumpIfFalse: if (r[instruction.first].integer == 0) { programCounter = instruction.second; } break;
+                    case Opcode::JumpIfTrue: if (r[instruction.first].integer != 0) { programCounter = instruction.second; } break;
+                    case Opcode::Not: r[instruction.target].integer = r[instruction.first].integer == 0 ? 1 : 0; break;
+                    case Opcode::AddInteger: r[instruction.target].integer = r[instruction.first].integer + r[instruction.second].integer; break;
+                    case Opcode::SubtractInteger: r[instruction.target].integer = r[instruction.first].integer - r[instruction.second].integer; break;
+                    case Opcode::MultiplyInteger: r[instruction.target].integer = r[instruction.first].integer * r[instruction.second].integer; break;
+                    case Opcode::ModuloInteger:
+                        STORM_LOG_THROW(r[instruction.second].integer != 0, storm::exceptions::InvalidArgumentException, "Modulo by zero.");
+                        r[instruction.target].integer = r[instruction.first].integer % r[instruction.second].integer;
+                        break;
+                    case Opcode::MinimumInteger: r[instruction.target].integer = std::min(r[instruction.first].integer, r[instruction.second].integer); break;
+                    case Opcode::MaximumInteger: r[instruction.target].integer = std::max(r[instruction.first].integer, r[instruction.second].integer); break;
+                    case Opcode::NegateInteger: r[instruction.target].integer = -r[instruction.first].integer; break;
+                    case Opcode::AddDouble: r[instruction.target].rational = r[instruction.first].rational + r[instruction.second].rational; break;
+                    case Opcode::SubtractDouble: r[instruction.target].rational = r[instruction.first].rational - r[instruction.second].rational; break;
+                    case Opcode::MultiplyDouble: r[instruction.target].rational = r[instruction.first].rational * r[instruction.second].rational; break;
+                    case Opcode::DivideDouble: r[instruction.target].rational = r[instruction.first].rational / r[instruction.second].rational; break;
+                    case Opcode::PowerDouble: r[instruction.target].rational = std::pow(r[instruction.first].rational, r[instruction.second].rational); break;
+                    case Opcode::ModuloDouble: r[instruction.target].rational = std::fmod(r[instruction.first].rational, r[instruction.second].rational); break;
+                    case Opcode::MinimumDouble: r[instruction.target].rational = std::min(r[instruction.first].rational, r[instruction.second].rational); break;
+                    case Opcode::MaximumDouble: r[instruction.target].rational = std::max(r[instruction.first].rational, r[instruction.second].rational); break;
+                    case Opcode::NegateDouble: r[instruction.target].rational = -r[instruction.first].rational; break;
+                    case Opcode::FloorDouble: r[instruction.target].integer = static_cast<int64_t>(std::floor(r[instruction.first].rational)); break;
+                    case Opcode::CeilDouble: r[instruction.target].integer = static_cast<int64_t>(std::ceil(r[instruction.first].rational)); break;
+                    case Opcode::EqualInteger: r[instruction.target].integer = r[instruction.first].integer == r[instruction.second].integer ? 1 : 0; break;
+                    case Opcode::NotEqualInteger: r[instruction.target].integer = r[instruction.first].integer != r[instruction.second].integer ? 1 : 0; break;
+                    case Opcode::LessInteger: r[instruction.target].integer = r[instruction.first].integer < r[instruction.second].integer ? 1 : 0; break;
+                    case Opcode::LessOrEqualInteger: r[instruction.target].integer = r[instruction.first].integer <= r[instruction.second].integer ? 1 : 0; break;
+                    case Opcode::EqualDouble: r[instruction.target].integer = r[instruction.first].rational == r[instruction.second].rational ? 1 : 0; break;
+                    case Opcode::NotEqualDouble: r[instruction.target].integer = r[instruction.first].rational != r[instruction.second].rational ? 1 : 0; break;
+                    case Opcode::LessDouble: r[instruction.target].integer = r[instruction.first].rational < r[instruction.second].rational ? 1 : 0; break;
+                    case Opcode::LessOrEqualDouble: r[instruction.target].integer = r[instruction.first].rational <= r[instruction.second].rational ? 1 : 0; break;
+                }
+            }
+            return r[resultRegister];
+        }
+
+        BytecodeExpressionCompiler::BytecodeExpressionCompiler(VariableInformation const& variableInformation) : numberOfRegisters(0), unsupported(false) {
+            BytecodeExpression::Instruction load;
+            load.target = 0;
+            for (auto const& locationVariable : variableInformation.locationVariables) {
+                load.opcode = locationVariable.bitWidth == 0 ? BytecodeExpression::Opcode::LoadConstant : BytecodeExpression::Opcode::LoadInteger;
+                load.first = locationVariable.bitOffset;
+                load.second = locationVariable.bitWidth;
+                load.immediate.integer = 0;
+                variableToLoadInstruction.emplace(locationVariable.variable, load);
+            }
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                load.opcode = BytecodeExpression::Opcode::LoadBoolean;
+                load.first = booleanVariable.bitOffset;
+                load.second = 1;
+                load.immediate.integer = 0;
+                variableToLoadInstruction.emplace(booleanVariable.variable, load);
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                load.opcode = BytecodeExpression::Opcode::LoadInteger;
+                load.first = integerVariable.bitOffset;
+                load.second = integerVariable.bitWidth;
+                load.immediate.integer = integerVariable.lowerBound;
+                variableToLoadInstruction.emplace(integerVariable.variable, load);
+            }
+        }
+
+        boost::optional<BytecodeExpression> BytecodeExpressionCompiler::compile(storm::expressions::Expression const& expression) {
+            instructions.clear();
+            numberOfRegisters = 0;
+            unsupported = false;
+
+            Operand result = compileOperand(expression.getBaseExpression());
+            if (unsupported) {
+                return boost::none;
+            }
+            return BytecodeExpression(std::move(instructions), numberOfRegisters, result.reg, result.kind);
+        }
+
+        BytecodeExpressionCompiler::Operand BytecodeExpressionCompiler::compileOperand(storm::expressions::BaseExpression const& expression) {
+            return boost::any_cast<Operand>(expression.accept(*this, boost::none));
+        }
+
+        uint32_t BytecodeExpressionCompiler::newRegister() {
+            return numberOfRegisters++;
+        }
+
+        BytecodeExpressionCompiler::Operand BytecodeExpressionCompiler::emit(BytecodeExpression::Opcode opcode, BytecodeExpression::ValueKind kind, uint32_t first, uint32_t second) {
+            BytecodeExpression::Instruction instruction;
+            instruction.opcode = opcode;
+            instruction.target = newRegister();
+            instruction.first = first;
+            instruction.second = second;
+            instruction.immediate.integer = 0;
+            instructions.push_back(instruction);
+            return {instruction.target, kind};
+        }
+
+        uint64_t BytecodeExpressionCompiler::emitJump(BytecodeExpression::Opcode opcode, uint32_t condition) {
+            BytecodeExpression::Instruction instruction;
+            instruction.opcode = opcode;
+            instruction.target = 0;
+            instruction.first = condition;
+            instruction.second = 0;
+            instruction.immediate.integer = 0;
+            instructions.push_back(instruction);
+            return instructions.size() - 1;
+        }
+
+        void BytecodeExpressionCompiler::emitMove(BytecodeExpression::Opcode opcode, uint32_t target, uint32_t source) {
+            BytecodeExpression::Instruction instruction;
+            instruction.opcode = opcode;
+            instruction.target = target;
+            instruction.first = source;
+            instruction.second = 0;
+            instruction.immediate.integer = 0;
+            instructions.push_back(instruction);
+        }
+
+        BytecodeExpressionCompiler::Operand BytecodeExpressionCompiler::toDouble(Operand const& operand) {
+            if (operand.kind == BytecodeExpression::ValueKind::Double) {
+                return operand;
+            }
+            return emit(BytecodeExpression::Opcode::IntegerToDouble, BytecodeExpression::ValueKind::Double, operand.reg);
+        }
+
+        boost::any BytecodeExpressionCompiler::visit(storm::expressions::IfThenElseExpression const& expression, boost::any const&) {
+            Operand condition = compileOperand(*expression.getCondition());
+            uint32_t result = newRegister();
+            uint64_t jumpToElse = emitJump(BytecodeExpression::Opcode::JumpIfFalse, condition.reg);
+
+            Operand thenOperand = compileOperand(*expression.getThenExpression());
+            uint64_t thenMove = instructions.size();
+            emitMove(BytecodeExpression::Opcode::Move, result, thenOperand.reg);
+            uint64_t jumpToEnd = emitJump(BytecodeExpression::Opcode::Jump);
+
+            instructions[jumpToElse].second = instructions.size();
+            Operand elseOperand = compileOperand(*expression.getElseExpression());
+
+            // If the branches yield values of different kinds, both are converted to doubles.
+            BytecodeExpression::ValueKind kind = thenOperand.kind;
+            if (thenOperand.kind != elseOperand.kind) {
+                kind = BytecodeExpression::ValueKind::Double;
+                if (thenOperand.kind != BytecodeExpression::ValueKind::Double) {
+                    instructions[thenMove].opcode = BytecodeExpression::Opcode::IntegerToDouble;
+                }
+            }
+            emitMove(kind != elseOperand.kind ? BytecodeExpression::Opcode::IntegerToDouble : BytecodeExpression::Opcode::Move, result, elseOperand.reg);
+            instructions[jumpToEnd].second = instructions.size();
+            return Operand({result, kind});
+        }
+
+        boost::any BytecodeExpressionCompiler::visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const&) {
+            typedef storm::expressions::BinaryBooleanFunctionExpression::OperatorType OperatorType;
+
+            Operand first = compileOperand(*expression.getFirstOperand());
+            switch (expression.getOperatorType()) {
+                case OperatorType::And:
+                case OperatorType::Or:
+                case OperatorType::Implies: {
+                    // Evaluate the second operand only if the first one does not determine the result.
+                    if (expression.getOperatorType() == OperatorType::Implies) {
+                        first = emit(BytecodeExpression::Opcode::Not, BytecodeExpression::ValueKind::Boolean, first.reg);
+                    }
+                    uint32_t result = newRegister();
+                    emitMove(BytecodeExpression::Opcode::Move, result, first.reg);
+                    uint64_t jumpToEnd = emitJump(expression.getOperatorType() == OperatorType::And ? BytecodeExpression::Opcode::JumpIfFalse : BytecodeExpression::Opcode::JumpIfTrue, first.reg);
+                    Operand second = compileOperand(*expression.getSecondOperand());
+                    emitMove(BytecodeExpression::Opcode::Move, result, second.reg);
+                    instructions[jumpToEnd].second = instructions.size();
+                    return Operand({result, BytecodeExpression::ValueKind::Boolean});
+                }
+                case OperatorType::Xor: {
+                    Operand second = compileOperand(*expression.getSecondOperand());
+                    return emit(BytecodeExpression::Opcode::NotEqualInteger, BytecodeExpression::ValueKind::Boolean, first.reg, second.reg);
+                }
+                case OperatorType::Iff: {
+                    Operand second = compileOperand(*expression.getSecondOperand());
+                    return emit(BytecodeExpression::Opcode::EqualInteger, BytecodeExpression::ValueKind::Boolean, first.reg, second.reg);
+                }
+            }
+            unsupported = true;
+            return first;
+        }
+
+        boost::any BytecodeExpressionCompiler::visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const&) {
+            typedef storm::expressions::BinaryNumericalFunctionExpression::OperatorType OperatorType;
+
+            Operand first = compileOperand(*expression.getFirstOperand());
+            Operand second = compileOperand(*expression.getSecondOperand());
+
+            // Divisions and powers are carried out on doubles (also for integer operands) just like the evaluators do.
+            bool useDouble = first.kind == BytecodeExpression::ValueKind::Double || second.kind == BytecodeExpression::ValueKind::Double || expression.getOperatorType() == OperatorType::Divide || expression.getOperatorType() == OperatorType::Power;
+            if (useDouble) {
+                first = toDouble(first);
+                second = toDouble(second);
+            }
+
+            BytecodeExpression::Opcode opcode;
+            switch (expression.getOperatorType()) {
+                case OperatorType::Plus: opcode = useDouble ? BytecodeExpression::Opcode::AddDouble : BytecodeExpression::Opcode::AddInteger; break;
+                case OperatorType::Minus: opcode = useDouble ? BytecodeExpression::Opcode::SubtractDouble : BytecodeExpression::Opcode::SubtractInteger; break;
+                case OperatorType::Times: opcode = useDouble ? BytecodeExpression::Opcode::MultiplyDouble : BytecodeExpression::Opcode::MultiplyInteger; break;
+                case OperatorType::Divide: opcode = BytecodeExpression::Opcode::DivideDouble; break;
+                case OperatorType::Min: opcode = useDouble ? BytecodeExpression::Opcode::MinimumDouble : BytecodeExpression::Opcode::MinimumInteger; break;
+                case OperatorType::Max: opcode = useDouble ? BytecodeExpression::Opcode::MaximumDouble : BytecodeExpression::Opcode::MaximumInteger; break;
+                case OperatorType::Power: opcode = BytecodeExpression::Opcode::PowerDouble; break;
+                case OperatorType::Modulo: opcode = useDouble ? BytecodeExpression::Opcode::ModuloDouble : BytecodeExpression::Opcode::ModuloInteger; break;
+                default:
+                    unsupported = true;
+                    return first;
+            }
+            return emit(opcode, useDouble ? BytecodeExpression::ValueKind::Double : BytecodeExpression::ValueKind::Integer, first.reg, second.reg);
+        }
+
+        boost::any BytecodeExpressionCompiler::visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const&) {
+            typedef storm::expressions::BinaryRelationExpression::RelationType RelationType;
+
+            Operand first = compileOperand(*expression.getFirstOperand());
+            Operand second = compileOperand(*expression.getSecondOperand());
+            bool useDouble = first.kind == BytecodeExpression::ValueKind::Double || second.kind == BytecodeExpression::ValueKind::Double;
+            if (useDouble) {
+                first = toDouble(first);
+                second = toDouble(second);
+            }
+
+            // Greater (or equal) is expressed via less (or equal) with swapped operands.
+            switch (expression.getRelationType()) {
+                case RelationType::Equal: return emit(useDouble ? BytecodeExpression::Opcode::EqualDouble : BytecodeExpression::Opcode::EqualInteger, BytecodeExpression::ValueKind::Boolean, first.reg, second.reg);
+                case RelationType::NotEqual: return emit(useDouble ? BytecodeExpression::Opcode::NotEqualDouble : BytecodeExpression::Opcode::NotEqualInteger, BytecodeExpression::ValueKind::Boolean, first.reg, second.reg);
+                case RelationType::Less: return emit(useDouble ? BytecodeExpression::Opcode::LessDouble : BytecodeExpression::Opcode::LessInteger, BytecodeExpression::ValueKind::Boolean, first.reg, second.reg);
+                case RelationType::LessOrEqual: return emit(useDouble ? BytecodeExpression::Opcode::LessOrEqualDouble : BytecodeExpression::Opcode::LessOrEqualInteger, BytecodeExpression::ValueKind::Boolean, first.reg, second.reg);
+                case RelationType::Greater: return emit(useDouble ? BytecodeExpression::Opcode::LessDouble : BytecodeExpression::Opcode::LessInteger, BytecodeExpression::ValueKind::Boolean, second.reg, first.reg);
+                case RelationType::GreaterOrEqual: return emit(useDouble ? BytecodeExpression::Opcode::LessOrEqualDouble : BytecodeExpression::Opcode::LessOrEqualInteger, BytecodeExpression::ValueKind::Boolean, second.reg, first.reg);
+            }
+            unsupported = true;
+            return first;
+        }
+
+        boost::any BytecodeExpressionCompiler::visit(storm::expressions::VariableExpression const& expression, boost::any const&) {
+            auto loadIt = variableToLoadInstruction.find(expression.getVariable());
+            if (loadIt == variableToLoadInstruction.end()) {
+                // The variable is not stored in the state, so we cannot compile the expression.
+                unsupported = true;
+                return Operand({0, BytecodeExpression::ValueKind::Integer});
+            }
+            BytecodeExpression::Instruction load = loadIt->second;
+            load.target = newRegister();
+            instructions.push_back(load);
+            return Operand({load.target, load.opcode == BytecodeExpression::Opcode::LoadBoolean ? BytecodeExpression::ValueKind::Boolean : BytecodeExpression::ValueKind::Integer});
+        }
+
+        boost::any BytecodeExpressionCompiler::visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const&) {
+            Operand operand = compileOperand(*expression.getOperand());
+            return emit(BytecodeExpression::Opcode::Not, BytecodeExpression::ValueKind::Boolean, operand.reg);
+        }
+
+        boost::any BytecodeExpressionCompiler::visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const&) {
+            typedef storm::expressions::UnaryNumericalFunctionExpression::OperatorType OperatorType;
+
+            Operand operand = compileOperand(*expression.getOperand());
+            bool isDouble = operand.kind == BytecodeExpression::ValueKind::Double;
+            switch (expression.getOperatorType()) {
+                case OperatorType::Minus: return emit(isDouble ? BytecodeExpression::Opcode::NegateDouble : BytecodeExpression::Opcode::NegateInteger, operand.kind, operand.reg);
+                case OperatorType::Floor: return isDouble ? emit(BytecodeExpression::Opcode::FloorDouble, BytecodeExpression::ValueKind::Integer, operand.reg) : operand;
+                case OperatorType::Ceil: return isDouble ? emit(BytecodeExpression::Opcode::CeilDouble, BytecodeExpression::ValueKind::Integer, operand.reg) : operand;
+            }
+            unsupported = true;
+            return operand;
+        }
+
+        boost::any BytecodeExpressionCompiler::visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const&) {
+            Operand result = emit(BytecodeExpression::Opcode::LoadConstant, BytecodeExpression::ValueKind::Boolean);
+            instructions.back().immediate.integer = expression.getValue() ? 1 : 0;
+            return result;
+        }
+
+        boost::any BytecodeExpressionCompiler::visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const&) {
+            Operand result = emit(BytecodeExpression::Opcode::LoadConstant, BytecodeExpression::ValueKind::Integer);
+            instructions.back().immediate.integer = expression.getValue();
+            return result;
+        }
+
+        boost::any BytecodeExpressionCompiler::visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const&) {
+            Operand result = emit(BytecodeExpression::Opcode::LoadConstant, BytecodeExpression::ValueKind::Double);
+            instructions.back().immediate.rational = expression.getValueAsDouble();
+            return result;
+        }
+
+    }
+}
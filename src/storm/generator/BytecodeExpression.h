@@ -0,0 +1,157 @@
+#ifndef STORM_GENERATOR_BYTECODEEXPRESSION_H_
+#define STORM_GENERATOR_BYTECODEEXPRESSION_H_
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace generator {
+
+        struct VariableInformation;
+
+        /*!
+         * An expression that was compiled to a small register-based bytecode. The values of boolean and integer
+         * variables are read directly from the bits of a compressed state, so (contrary to the expression evaluators)
+         * the state does not need to be unpacked before the expression can be evaluated.
+         *
+         * Integer arithmetic is carried out on 64 bit integers and rational arithmetic on doubles. Like the
+         * evaluators, divisions and powers are always carried out on doubles and the result is truncated if the
+         * expression is evaluated as an integer.
+         *
+         * Note that evaluating the expression uses internal scratch registers and is therefore not thread-safe.
+         */
+        class BytecodeExpression {
+        public:
+            enum class Opcode : uint8_t {
+                LoadConstant, LoadBoolean, LoadInteger, IntegerToDouble, Move, Jump, JumpIfFalse, JumpIfTrue,
+                Not, AddInteger, SubtractInteger, MultiplyInteger, ModuloInteger, MinimumInteger, MaximumInteger, NegateInteger,
+                AddDouble, SubtractDouble, MultiplyDouble, DivideDouble, PowerDouble, ModuloDouble, MinimumDouble, MaximumDouble, NegateDouble, FloorDouble, CeilDouble,
+                EqualInteger, NotEqualInteger, LessInteger, LessOrEqualInteger, EqualDouble, NotEqualDouble, LessDouble, LessOrEqualDouble
+            };
+
+            // The type of the values stored in the registers. Boolean values are stored as integers zero and one.
+            enum class ValueKind {Boolean, Integer, Double};
+
+            union Value {
+                int64_t integer;
+                double rational;
+            };
+
+            /*!
+             * A single instruction. Unless stated otherwise, the instruction combines the registers first and second
+             * and writes the result to the register target. Loads read the bits [first, first + second) of the state
+             * and offset the value by immediate.integer, jumps continue at the instruction with index second.
+             */
+            struct Instruction {
+                Opcode opcode;
+                uint32_t target;
+                uint32_t first;
+                uint32_t second;
+                Value immediate;
+            };
+
+            BytecodeExpression(std::vector<Instruction>&& instructions, uint32_t numberOfRegisters, uint32_t resultRegister, ValueKind resultKind);
+
+            /*!
+             * Compiles the given expression to bytecode that reads the variables from states laid out according to the
+             * given variable information.
+             *
+             * @return The compiled expression or none if the expression contains variables that are not stored in the
+             * state (e.g. parameters) or is of a type that is not supported.
+             */
+            static boost::optional<BytecodeExpression> compile(storm::expressions::Expression const& expression, VariableInformation const& variableInformation);
+
+            bool evaluateAsBool(CompressedState const& state) const;
+            int64_t evaluateAsInt(CompressedState const& state) const;
+            double evaluateAsDouble(CompressedState const& state) const;
+
+            /*!
+             * Retrieves the kind of value the expression evaluates to.
+             */
+            ValueKind getResultKind() const;
+
+            /*!
+             * Retrieves the number of instructions of the expression.
+             */
+            uint64_t getNumberOfInstructions() const;
+
+        private:
+            /*!
+             * Runs the instructions on the given state and returns the value of the result register.
+             */
+            Value execute(CompressedState const& state) const;
+
+            // The instructions of the expression.
+            std::vector<Instruction> instructions;
+
+            // The scratch registers used during the evaluation.
+            mutable std::vector<Value> registers;
+
+            // The register that holds the result after the execution.
+            uint32_t resultRegister;
+
+            // The kind of the value in the result register.
+            ValueKind resultKind;
+        };
+
+        /*!
+         * A visitor that translates expressions to bytecode.
+         */
+        class BytecodeExpressionCompiler : public storm::expressions::ExpressionVisitor {
+        public:
+            BytecodeExpressionCompiler(VariableInformation const& variableInformation);
+
+            /*!
+             * Compiles the given expression.
+             *
+             * @return The compiled expression or none if it could not be compiled.
+             */
+            boost::optional<BytecodeExpression> compile(storm::expressions::Expression const& expression);
+
+            virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const& data) override;
+
+        private:
+            // A register holding a value of the given kind.
+            struct Operand {
+                uint32_t reg;
+                BytecodeExpression::ValueKind kind;
+            };
+
+            Operand compileOperand(storm::expressions::BaseExpression const& expression);
+            Operand emit(BytecodeExpression::Opcode opcode, BytecodeExpression::ValueKind kind, uint32_t first = 0, uint32_t second = 0);
+            uint64_t emitJump(BytecodeExpression::Opcode opcode, uint32_t condition = 0);
+            void emitMove(BytecodeExpression::Opcode opcode, uint32_t target, uint32_t source);
+            uint32_t newRegister();
+            Operand toDouble(Operand const& operand);
+
+            // For each variable stored in the state, the instruction that loads its value.
+            std::unordered_map<storm::expressions::Variable, BytecodeExpression::Instruction> variableToLoadInstruction;
+
+            std::vector<BytecodeExpression::Instruction> instructions;
+            uint32_t numberOfRegisters;
+
+            // Set if the expression uses a feature that cannot be compiled.
+            bool unsupported;
+        };
+
+    }
+}
+
+#endif /* STORM_GENERATOR_BYTECODEEXPRESSION_H_ */
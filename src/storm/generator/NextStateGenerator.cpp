@@ -18,7 +18,7 @@ namespace storm {
     namespace generator {
                     
         template<typename ValueType, typename StateType>
-        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, VariableInformation const& variableInformation, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(variableInformation), evaluator(nullptr), state(nullptr) {
+        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, VariableInformation const& variableInformation, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(variableInformation), evaluator(nullptr), state(nullptr), unpackStateOnLoad(true), loadedStateUnpacked(false) {
             if(variableInformation.hasOutOfBoundsBit()) {
                 outOfBoundsState = createOutOfBoundsState(variableInformation);
             }
@@ -28,7 +28,7 @@ namespace storm {
         }
         
         template<typename ValueType, typename StateType>
-        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), state(nullptr) {
+        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), state(nullptr), unpackStateOnLoad(true), loadedStateUnpacked(false) {
             if(variableInformation.hasOutOfBoundsBit()) {
                 outOfBoundsState = createOutOfBoundsState(variableInformation);
             }
@@ -83,11 +83,23 @@ namespace storm {
         
         template<typename ValueType, typename StateType>
         void NextStateGenerator<ValueType, StateType>::load(CompressedState const& state) {
-            // Since almost all subsequent operations are based on the evaluator, we load the state into it now.
-            unpackStateIntoEvaluator(state, variableInformation, *evaluator);
-            
-            // Also, we need to store a pointer to the state itself, because we need to be able to access it when expanding it.
+            // We need to store a pointer to the state itself, because we need to be able to access it when expanding it.
             this->state = &state;
+
+            // Since almost all subsequent operations are typically based on the evaluator, we load the state into it now.
+            loadedStateUnpacked = false;
+            if (unpackStateOnLoad) {
+                unpackLoadedStateIntoEvaluator();
+            }
+        }
+
+        template<typename ValueType, typename StateType>
+        void NextStateGenerator<ValueType, StateType>::unpackLoadedStateIntoEvaluator() const {
+            if (!loadedStateUnpacked) {
+                STORM_LOG_ASSERT(state != nullptr, "No state was loaded.");
+                unpackStateIntoEvaluator(*state, variableInformation, *evaluator);
+                loadedStateUnpacked = true;
+            }
         }
         
         template<typename ValueType, typename StateType>
@@ -95,6 +107,7 @@ namespace storm {
             if (expression.isTrue()) {
                 return true;
             }
+            unpackLoadedStateIntoEvaluator();
             return evaluator->asBool(expression);
         }
 
@@ -166,18 +179,18 @@ namespace storm {
                 result.addLabel(label.first);
             }
             
-            auto const& states = stateStorage.stateToId;
-            for (auto const& stateIndexPair : states) {
-                unpackStateIntoEvaluator(stateIndexPair.first, variableInformation, *this->evaluator);
-                unpackTransientVariableValuesIntoEvaluator(stateIndexPair.first, *this->evaluator);
+            loadedStateUnpacked = false;
+            stateStorage.forEachState([&] (CompressedState const& state, StateType const& stateIndex) {
+                unpackStateIntoEvaluator(state, variableInformation, *this->evaluator);
+                unpackTransientVariableValuesIntoEvaluator(state, *this->evaluator);
                 
                 for (auto const& label : labelsAndExpressions) {
                     // Add label to state, if the corresponding expression is true.
                     if (evaluator->asBool(label.second)) {
-                        result.addLabelToState(label.first, stateIndexPair.second);
+                        result.addLabelToState(label.first, stateIndex);
                     }
                 }
-            }
+            });
             
             if (!result.containsLabel("init")) {
                 // Also label the initial state with the special label "init".
@@ -201,10 +214,10 @@ namespace storm {
                 }
             }
 
-            if (this->options.isAddOutOfBoundsStateSet() && stateStorage.stateToId.contains(outOfBoundsState)) {
+            if (this->options.isAddOutOfBoundsStateSet() && stateStorage.contains(outOfBoundsState)) {
                 STORM_LOG_THROW(!result.containsLabel("out_of_bounds"),storm::exceptions::WrongFormatException, "Label 'out_of_bounds' is reserved when adding out of bounds states.");
                 result.addLabel("out_of_bounds");
-                result.addLabelToState("out_of_bounds", stateStorage.stateToId.getValue(outOfBoundsState));
+                result.addLabelToState("out_of_bounds", stateStorage.getValue(outOfBoundsState));
             }
             
             return result;
@@ -114,6 +114,11 @@ namespace storm {
 
             void postprocess(StateBehavior<ValueType, StateType>& result);
 
+            /*!
+             * Unpacks the currently loaded state into the evaluator unless this already happened since it was loaded.
+             */
+            void unpackLoadedStateIntoEvaluator() const;
+
             /// The options to be used for next-state generation.
             NextStateGeneratorOptions options;
 
@@ -132,6 +137,13 @@ namespace storm {
             /// The currently loaded state.
             CompressedState const* state;
 
+            /// Whether loading a state immediately unpacks it into the evaluator. Generators that evaluate most
+            /// expressions directly on the compressed state can disable this and unpack states on demand.
+            bool unpackStateOnLoad;
+
+            /// Whether the currently loaded state was already unpacked into the evaluator.
+            mutable bool loadedStateUnpacked;
+
             /// A comparator used to compare constants.
             storm::utility::ConstantsComparator<ValueType> comparator;
 
@@ -1,11 +1,15 @@
 #include "storm/generator/PrismNextStateGenerator.h"
 
+#include <algorithm>
+
 #include <boost/container/flat_map.hpp>
 #include <boost/any.hpp>
 
 #include "storm/models/sparse/StateLabeling.h"
 
 #include "storm/storage/expressions/SimpleValuation.h"
+#include "storm/storage/expressions/OperatorType.h"
+#include "storm/storage/expressions/VariableExpression.h"
 #include "storm/storage/sparse/PrismChoiceOrigins.h"
 
 #include "storm/builder/jit/Distribution.h"
@@ -27,7 +31,7 @@ namespace storm {
         }
 
         template<typename ValueType, typename StateType>
-        PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options, bool) : NextStateGenerator<ValueType, StateType>(program.getManager(), options), program(program), rewardModels(), hasStateActionRewards(false) {
+        PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options, bool) : NextStateGenerator<ValueType, StateType>(program.getManager(), options), program(program), rewardModels(), hasStateActionRewards(false), currentExpansion(0), hasCompiledUpdates(false) {
             STORM_LOG_TRACE("Creating next-state generator for PRISM program: " << program);
             STORM_LOG_THROW(!this->program.specifiesSystemComposition(), storm::exceptions::WrongFormatException, "The explicit next-state generator currently does not support custom system compositions.");
 
@@ -38,6 +42,13 @@ namespace storm {
             // Create a proper evalator.
             this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(program.getManager());
 
+            // Precompute which commands share the variables read by their guards and how the updates change the state.
+            // As guards, updates and likelihoods are (if possible) evaluated directly on the compressed states, states
+            // are only unpacked into the evaluator when needed.
+            bytecodeCompiler = std::make_unique<BytecodeExpressionCompiler>(this->variableInformation);
+            buildGuardIndexAndUpdateCache();
+            this->unpackStateOnLoad = false;
+
             if (this->options.isBuildAllRewardModelsSet()) {
                 for (auto const& rewardModel : this->program.getRewardModels()) {
                     rewardModels.push_back(rewardModel);
@@ -87,6 +98,212 @@ namespace storm {
             }
         }
 
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::buildGuardIndexAndUpdateCache() {
+            for (uint64_t index = 0; index < this->variableInformation.booleanVariables.size(); ++index) {
+                variableToInformationIndex.emplace(this->variableInformation.booleanVariables[index].variable, std::make_pair(true, index));
+            }
+            for (uint64_t index = 0; index < this->variableInformation.integerVariables.size(); ++index) {
+                variableToInformationIndex.emplace(this->variableInformation.integerVariables[index].variable, std::make_pair(false, index));
+            }
+
+            // Group the commands by the parts of the state that are read by their guards. Variables that are not part of
+            // the state (e.g. parameters) are constant and can therefore be ignored.
+            std::map<std::vector<std::pair<uint64_t, uint64_t>>, uint64_t> readRangesToGroup;
+            std::vector<uint64_t> groupSizes;
+            uint64_t numberOfCompiledGuards = 0;
+            commandToGuardGroup.resize(program.getNumberOfModules());
+            compiledGuards.resize(program.getNumberOfModules());
+            for (uint_fast64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                storm::prism::Module const& module = program.getModule(moduleIndex);
+                commandToGuardGroup[moduleIndex].reserve(module.getNumberOfCommands());
+                compiledGuards[moduleIndex].reserve(module.getNumberOfCommands());
+                for (auto const& command : module.getCommands()) {
+                    compiledGuards[moduleIndex].push_back(bytecodeCompiler->compile(command.getGuardExpression()));
+                    if (compiledGuards[moduleIndex].back()) {
+                        ++numberOfCompiledGuards;
+                    }
+
+                    std::vector<std::pair<uint64_t, uint64_t>> readRanges;
+                    for (auto const& variable : command.getGuardExpression().getVariables()) {
+                        auto informationIt = variableToInformationIndex.find(variable);
+                        if (informationIt == variableToInformationIndex.end()) {
+                            continue;
+                        }
+                        if (informationIt->second.first) {
+                            readRanges.emplace_back(this->variableInformation.booleanVariables[informationIt->second.second].bitOffset, 1);
+                        } else {
+                            auto const& integerVariable = this->variableInformation.integerVariables[informationIt->second.second];
+                            readRanges.emplace_back(integerVariable.bitOffset, integerVariable.bitWidth);
+                        }
+                    }
+
+                    // Merge adjacent ranges as long as they can still be read as one integer.
+                    std::sort(readRanges.begin(), readRanges.end());
+                    std::vector<std::pair<uint64_t, uint64_t>> mergedRanges;
+                    for (auto const& range : readRanges) {
+                        if (!mergedRanges.empty() && mergedRanges.back().first + mergedRanges.back().second == range.first && mergedRanges.back().second + range.second <= 64) {
+                            mergedRanges.back().second += range.second;
+                        } else {
+                            mergedRanges.push_back(range);
+                        }
+                    }
+
+                    auto groupIt = readRangesToGroup.emplace(std::move(mergedRanges), groupSizes.size()).first;
+                    if (groupIt->second == groupSizes.size()) {
+                        groupSizes.push_back(0);
+                    }
+                    commandToGuardGroup[moduleIndex].emplace_back(groupIt->second, groupSizes[groupIt->second]++);
+                }
+            }
+
+            guardGroups.resize(groupSizes.size());
+            for (auto const& rangesGroupPair : readRangesToGroup) {
+                GuardGroup& group = guardGroups[rangesGroupPair.second];
+                group.readRanges = rangesGroupPair.first;
+                group.cachedValues.resize(group.readRanges.size());
+                group.evaluatedGuards = storm::storage::BitVector(groupSizes[rangesGroupPair.second]);
+                group.enabledGuards = storm::storage::BitVector(groupSizes[rangesGroupPair.second]);
+                group.lastExpansion = 0;
+                group.hasCachedValues = false;
+            }
+            STORM_LOG_DEBUG("Partitioned " << program.getNumberOfCommands() << " commands into " << guardGroups.size() << " guard groups, " << numberOfCompiledGuards << " guards were compiled to bytecode.");
+
+            // Compile the updates of all commands, provided that the global update indices identify them uniquely.
+            storm::storage::BitVector seenUpdateIndices;
+            hasCompiledUpdates = true;
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    for (auto const& update : command.getUpdates()) {
+                        uint64_t updateIndex = update.getGlobalIndex();
+                        if (updateIndex >= compiledUpdates.size()) {
+                            compiledUpdates.resize(updateIndex + 1);
+                            seenUpdateIndices.resize(updateIndex + 1);
+                        }
+                        if (seenUpdateIndices.get(updateIndex)) {
+                            hasCompiledUpdates = false;
+                            break;
+                        }
+                        seenUpdateIndices.set(updateIndex);
+                        compiledUpdates[updateIndex] = compileUpdate(update);
+                    }
+                }
+            }
+            if (!hasCompiledUpdates) {
+                STORM_LOG_DEBUG("Global update indices are not unique, updates are compiled on the fly.");
+                compiledUpdates.clear();
+            }
+        }
+
+        template<typename ValueType, typename StateType>
+        typename PrismNextStateGenerator<ValueType, StateType>::CompiledUpdate PrismNextStateGenerator<ValueType, StateType>::compileUpdate(storm::prism::Update const& update) {
+            CompiledUpdate result;
+            // Probabilities are only computed in double precision if this is the value type.
+            if (std::is_same<ValueType, double>::value) {
+                result.likelihood = bytecodeCompiler->compile(update.getLikelihoodExpression());
+            }
+
+            result.assignments.reserve(update.getNumberOfAssignments());
+            for (auto const& assignment : update.getAssignments()) {
+                auto informationIt = variableToInformationIndex.find(assignment.getVariable());
+                STORM_LOG_THROW(informationIt != variableToInformationIndex.end(), storm::exceptions::WrongFormatException, "The update " << update << " assigns to the unknown variable '" << assignment.getVariableName() << "'.");
+
+                CompiledAssignment compiledAssignment;
+                compiledAssignment.kind = CompiledAssignment::Kind::Evaluate;
+                compiledAssignment.assignment = &assignment;
+                compiledAssignment.isBoolean = informationIt->second.first;
+                compiledAssignment.value = 0;
+                storm::expressions::Expression const& expression = assignment.getExpression();
+                if (compiledAssignment.isBoolean) {
+                    auto const& booleanVariable = this->variableInformation.booleanVariables[informationIt->second.second];
+                    compiledAssignment.bitOffset = booleanVariable.bitOffset;
+                    compiledAssignment.bitWidth = 1;
+                    compiledAssignment.lowerBound = 0;
+                    compiledAssignment.upperBound = 1;
+                    compiledAssignment.forceOutOfBoundsCheck = false;
+                    if (!expression.containsVariables()) {
+                        compiledAssignment.kind = CompiledAssignment::Kind::Constant;
+                        compiledAssignment.value = expression.evaluateAsBool() ? 1 : 0;
+                    }
+                } else {
+                    auto const& integerVariable = this->variableInformation.integerVariables[informationIt->second.second];
+                    compiledAssignment.bitOffset = integerVariable.bitOffset;
+                    compiledAssignment.bitWidth = integerVariable.bitWidth;
+                    compiledAssignment.lowerBound = integerVariable.lowerBound;
+                    compiledAssignment.upperBound = integerVariable.upperBound;
+                    compiledAssignment.forceOutOfBoundsCheck = integerVariable.forceOutOfBoundsCheck;
+                    if (!expression.containsVariables()) {
+                        compiledAssignment.kind = CompiledAssignment::Kind::Constant;
+                        compiledAssignment.value = expression.evaluateAsInt();
+                    } else if (expression.isFunctionApplication() && expression.getArity() == 2 && (expression.getOperator() == storm::expressions::OperatorType::Plus || expression.getOperator() == storm::expressions::OperatorType::Minus)) {
+                        // Detect increments and decrements of the assigned variable by a constant.
+                        storm::expressions::Expression first = expression.getOperand(0);
+                        storm::expressions::Expression second = expression.getOperand(1);
+                        bool isMinus = expression.getOperator() == storm::expressions::OperatorType::Minus;
+                        if (!isMinus && second.isVariable() && !first.containsVariables()) {
+                            std::swap(first, second);
+                        }
+                        if (first.isVariable() && first.getBaseExpression().asVariableExpression().getVariable() == assignment.getVariable() && !second.containsVariables() && second.hasIntegerType()) {
+                            compiledAssignment.kind = CompiledAssignment::Kind::Increment;
+                            compiledAssignment.value = isMinus ? -second.evaluateAsInt() : second.evaluateAsInt();
+                        }
+                    }
+                }
+                if (compiledAssignment.kind == CompiledAssignment::Kind::Evaluate) {
+                    compiledAssignment.bytecode = bytecodeCompiler->compile(expression);
+                }
+                result.assignments.push_back(std::move(compiledAssignment));
+            }
+            return result;
+        }
+
+        template<typename ValueType, typename StateType>
+        ValueType PrismNextStateGenerator<ValueType, StateType>::evaluateLikelihood(storm::prism::Update const& update) {
+            if (hasCompiledUpdates) {
+                auto const& likelihood = compiledUpdates[update.getGlobalIndex()].likelihood;
+                if (likelihood) {
+                    return storm::utility::convertNumber<ValueType>(likelihood->evaluateAsDouble(*this->state));
+                }
+            }
+            this->unpackLoadedStateIntoEvaluator();
+            return this->evaluator->asRational(update.getLikelihoodExpression());
+        }
+
+        template<typename ValueType, typename StateType>
+        bool PrismNextStateGenerator<ValueType, StateType>::isCommandEnabled(uint_fast64_t moduleIndex, uint_fast64_t commandIndex) {
+            auto const& groupAndPosition = commandToGuardGroup[moduleIndex][commandIndex];
+            GuardGroup& group = guardGroups[groupAndPosition.first];
+
+            // Compare the relevant parts of the state with the ones the cached values were computed for (once per expansion).
+            if (group.lastExpansion != currentExpansion) {
+                group.lastExpansion = currentExpansion;
+                bool unchanged = group.hasCachedValues;
+                for (uint64_t rangeIndex = 0; rangeIndex < group.readRanges.size(); ++rangeIndex) {
+                    uint64_t value = this->state->getAsInt(group.readRanges[rangeIndex].first, group.readRanges[rangeIndex].second);
+                    if (value != group.cachedValues[rangeIndex]) {
+                        group.cachedValues[rangeIndex] = value;
+                        unchanged = false;
+                    }
+                }
+                if (!unchanged) {
+                    group.evaluatedGuards.clear();
+                    group.hasCachedValues = true;
+                }
+            }
+
+            if (!group.evaluatedGuards.get(groupAndPosition.second)) {
+                group.evaluatedGuards.set(groupAndPosition.second);
+                auto const& compiledGuard = compiledGuards[moduleIndex][commandIndex];
+                if (compiledGuard) {
+                    group.enabledGuards.set(groupAndPosition.second, compiledGuard->evaluateAsBool(*this->state));
+                } else {
+                    this->unpackLoadedStateIntoEvaluator();
+                    group.enabledGuards.set(groupAndPosition.second, this->evaluator->asBool(program.getModule(moduleIndex).getCommand(commandIndex).getGuardExpression()));
+                }
+            }
+            return group.enabledGuards.get(groupAndPosition.second);
+        }
+
         template<typename ValueType, typename StateType>
         bool PrismNextStateGenerator<ValueType, StateType>::canHandle(storm::prism::Program const& program) {
             // We can handle all valid prism programs (except for PTAs)
@@ -272,6 +489,7 @@ namespace storm {
             for (auto const& rewardModel : rewardModels) {
                 ValueType stateRewardValue = storm::utility::zero<ValueType>();
                 if (rewardModel.get().hasStateRewards()) {
+                    this->unpackLoadedStateIntoEvaluator();
                     for (auto const& stateReward : rewardModel.get().getStateRewards()) {
                         if (this->evaluator->asBool(stateReward.getStatePredicateExpression())) {
                             stateRewardValue += ValueType(this->evaluator->asRational(stateReward.getRewardValueExpression()));
@@ -283,6 +501,7 @@ namespace storm {
 
             // If a terminal expression was set and we must not expand this state, return now.
             if (!this->terminalStates.empty()) {
+                this->unpackLoadedStateIntoEvaluator();
                 for (auto const& expressionBool : this->terminalStates) {
                     if (this->evaluator->asBool(expressionBool.first) == expressionBool.second) {
                         return result;
@@ -290,8 +509,9 @@ namespace storm {
                 }
             }
 
-            // Get all choices for the state.
+            // Get all choices for the state. Cached guard values need to be checked against the new state.
             result.setExpanded();
+            ++currentExpansion;
 
             std::vector<Choice<ValueType>> allChoices;
             if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
@@ -355,6 +575,7 @@ namespace storm {
                 for (auto const& rewardModel : rewardModels) {
                     ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
                     if (rewardModel.get().hasStateActionRewards()) {
+                        this->unpackLoadedStateIntoEvaluator();
                         for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
                             for (auto const& choice : allChoices) {
                                 if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
@@ -401,52 +622,63 @@ namespace storm {
         CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState const& state, storm::prism::Update const& update) {
             CompressedState newState(state);
 
-            // NOTE: the following process assumes that the assignments of the update are ordered in such a way that the
-            // assignments to boolean variables precede the assignments to all integer variables and that within the
-            // types, the assignments to variables are ordered (in ascending order) by the expression variables.
-            // This is guaranteed for PRISM models, by sorting the assignments as soon as an update is created.
+            CompiledUpdate uncompiledUpdate;
+            if (!hasCompiledUpdates) {
+                uncompiledUpdate = compileUpdate(update);
+            }
+            std::vector<CompiledAssignment> const& assignments = hasCompiledUpdates ? compiledUpdates[update.getGlobalIndex()].assignments : uncompiledUpdate.assignments;
 
-            auto assignmentIt = update.getAssignments().begin();
-            auto assignmentIte = update.getAssignments().end();
+            // Carry out all assignments. Constants, increments and compiled expressions are evaluated on the currently
+            // loaded compressed state, all other assignments are evaluated by the evaluator.
+            for (auto const& assignment : assignments) {
+                if (assignment.kind == CompiledAssignment::Kind::Evaluate && !assignment.bytecode) {
+                    this->unpackLoadedStateIntoEvaluator();
+                }
 
-            // Iterate over all boolean assignments and carry them out.
-            auto boolIt = this->variableInformation.booleanVariables.begin();
-            for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasBooleanType(); ++assignmentIt) {
-                while (assignmentIt->getVariable() != boolIt->variable) {
-                    ++boolIt;
+                if (assignment.isBoolean) {
+                    bool assignedValue;
+                    if (assignment.kind == CompiledAssignment::Kind::Constant) {
+                        assignedValue = assignment.value != 0;
+                    } else if (assignment.bytecode) {
+                        assignedValue = assignment.bytecode->evaluateAsBool(*this->state);
+                    } else {
+                        assignedValue = this->evaluator->asBool(assignment.assignment->getExpression());
+                    }
+                    newState.set(assignment.bitOffset, assignedValue);
+                    continue;
                 }
-                newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getExpression()));
-            }
 
-            // Iterate over all integer assignments and carry them out.
-            auto integerIt = this->variableInformation.integerVariables.begin();
-            for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasIntegerType(); ++assignmentIt) {
-                while (assignmentIt->getVariable() != integerIt->variable) {
-                    ++integerIt;
+                int_fast64_t assignedValue;
+                switch (assignment.kind) {
+                    case CompiledAssignment::Kind::Constant:
+                        assignedValue = assignment.value;
+                        break;
+                    case CompiledAssignment::Kind::Increment:
+                        assignedValue = static_cast<int_fast64_t>(this->state->getAsInt(assignment.bitOffset, assignment.bitWidth)) + assignment.lowerBound + assignment.value;
+                        break;
+                    default:
+                        assignedValue = assignment.bytecode ? assignment.bytecode->evaluateAsInt(*this->state) : this->evaluator->asInt(assignment.assignment->getExpression());
                 }
-                int_fast64_t assignedValue = this->evaluator->asInt(assignmentIt->getExpression());
                 if (this->options.isAddOutOfBoundsStateSet()) {
-                    if (assignedValue < integerIt->lowerBound || assignedValue > integerIt->upperBound) {
+                    if (assignedValue < assignment.lowerBound || assignedValue > assignment.upperBound) {
                         return this->outOfBoundsState;
                     }
-                } else if (integerIt->forceOutOfBoundsCheck || this->options.isExplorationChecksSet()) {
-                    STORM_LOG_THROW(assignedValue >= integerIt->lowerBound, storm::exceptions::WrongFormatException, "The update " << update << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '" << assignmentIt->getVariableName() << "'.");
-                    STORM_LOG_THROW(assignedValue <= integerIt->upperBound, storm::exceptions::WrongFormatException, "The update " << update << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '" << assignmentIt->getVariableName() << "'.");
+                } else if (assignment.forceOutOfBoundsCheck || this->options.isExplorationChecksSet()) {
+                    STORM_LOG_THROW(assignedValue >= assignment.lowerBound, storm::exceptions::WrongFormatException, "The update " << update << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '" << assignment.assignment->getVariableName() << "'.");
+                    STORM_LOG_THROW(assignedValue <= assignment.upperBound, storm::exceptions::WrongFormatException, "The update " << update << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '" << assignment.assignment->getVariableName() << "'.");
                 }
-                newState.setFromInt(integerIt->bitOffset, integerIt->bitWidth, assignedValue - integerIt->lowerBound);
-                STORM_LOG_ASSERT(static_cast<int_fast64_t>(newState.getAsInt(integerIt->bitOffset, integerIt->bitWidth)) + integerIt->lowerBound == assignedValue, "Writing to the bit vector bucket failed (read " << newState.getAsInt(integerIt->bitOffset, integerIt->bitWidth) << " but wrote " << assignedValue << ").");
+                newState.setFromInt(assignment.bitOffset, assignment.bitWidth, assignedValue - assignment.lowerBound);
+                STORM_LOG_ASSERT(static_cast<int_fast64_t>(newState.getAsInt(assignment.bitOffset, assignment.bitWidth)) + assignment.lowerBound == assignedValue, "Writing to the bit vector bucket failed (read " << newState.getAsInt(assignment.bitOffset, assignment.bitWidth) << " but wrote " << assignedValue << ").");
             }
 
-            // Check that we processed all assignments.
-            STORM_LOG_ASSERT(assignmentIt == assignmentIte, "Not all assignments were consumed.");
-
             return newState;
         }
 
         struct ActiveCommandData {
-            ActiveCommandData(storm::prism::Module const* modulePtr, std::set<uint_fast64_t> const* commandIndicesPtr, typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt) : modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
+            ActiveCommandData(uint_fast64_t moduleIndex, storm::prism::Module const* modulePtr, std::set<uint_fast64_t> const* commandIndicesPtr, typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt) : moduleIndex(moduleIndex), modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
                 // Intentionally left empty
             }
+            uint_fast64_t moduleIndex;
             storm::prism::Module const* modulePtr;
             std::set<uint_fast64_t> const* commandIndicesPtr;
             typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt;
@@ -488,10 +720,10 @@ namespace storm {
                             continue;
                         }
                     }
-                    if (this->evaluator->asBool(command.getGuardExpression())) {
+                    if (isCommandEnabled(i, *commandIndexIt)) {
                         // Found the first enabled command for this module.
                         hasOneEnabledCommand = true;
-                        activeCommands.emplace_back(&module, &commandIndices, commandIndexIt);
+                        activeCommands.emplace_back(i, &module, &commandIndices, commandIndexIt);
                         break;
                     }
                 }
@@ -522,7 +754,7 @@ namespace storm {
                             continue;
                         }
                     }
-                    if (this->evaluator->asBool(command.getGuardExpression())) {
+                    if (isCommandEnabled(activeCommand.moduleIndex, *commandIndexIt)) {
                         commands.push_back(command);
                     }
                 }
@@ -557,7 +789,7 @@ namespace storm {
                     }
 
                     // Skip the command, if it is not enabled.
-                    if (!this->evaluator->asBool(command.getGuardExpression())) {
+                    if (!isCommandEnabled(i, j)) {
                         continue;
                     }
 
@@ -575,7 +807,7 @@ namespace storm {
                     for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
                         storm::prism::Update const& update = command.getUpdate(k);
 
-                        ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
+                        ValueType probability = evaluateLikelihood(update);
                         if (probability != storm::utility::zero<ValueType>()) {
                             // Obtain target state index and add it to the list of known states. If it has not yet been
                             // seen, we also add it to the set of states that have yet to be explored.
@@ -593,6 +825,7 @@ namespace storm {
                     for (auto const& rewardModel : rewardModels) {
                         ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
                         if (rewardModel.get().hasStateActionRewards()) {
+                            this->unpackLoadedStateIntoEvaluator();
                             for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
                                 if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
                                     stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
@@ -632,7 +865,7 @@ namespace storm {
                 storm::prism::Command const& command = *iteratorList[position];
                 for (uint_fast64_t j = 0; j < command.getNumberOfUpdates(); ++j) {
                     storm::prism::Update const& update = command.getUpdate(j);
-                    generateSynchronizedDistribution(applyUpdate(state, update), probability * this->evaluator->asRational(update.getLikelihoodExpression()), position + 1, iteratorList, distribution, stateToIdCallback);
+                    generateSynchronizedDistribution(applyUpdate(state, update), probability * evaluateLikelihood(update), position + 1, iteratorList, distribution, stateToIdCallback);
                 }
             }
         }
@@ -707,6 +940,7 @@ namespace storm {
                         for (auto const& rewardModel : rewardModels) {
                             ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
                             if (rewardModel.get().hasStateActionRewards()) {
+                                this->unpackLoadedStateIntoEvaluator();
                                 for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
                                     if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
                                         stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
@@ -764,6 +998,7 @@ namespace storm {
         storm::storage::BitVector PrismNextStateGenerator<ValueType, StateType>::evaluateObservationLabels(CompressedState const& state) const {
             // TODO consider to avoid reloading by computing these bitvectors in an earlier build stage
             unpackStateIntoEvaluator(state, this->variableInformation, *this->evaluator);
+            this->loadedStateUnpacked = false;
 
             storm::storage::BitVector result(program.getNumberOfObservationLabels() * 64);
             for (uint64_t i = 0; i < program.getNumberOfObservationLabels(); ++i) {
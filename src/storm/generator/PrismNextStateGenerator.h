@@ -2,6 +2,9 @@
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/BytecodeExpression.h"
+
+#include <unordered_map>
 
 #include "storm/storage/prism/Program.h"
 #include "storm/storage/BoostTypes.h"
@@ -58,6 +61,82 @@ namespace storm {
              */
             PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options, bool flag);
             
+            // A group of commands whose guards read exactly the same parts of the compressed state.
+            struct GuardGroup {
+                // The (bit offset, bit width) pairs of the parts of the state that are read by the guards.
+                std::vector<std::pair<uint64_t, uint64_t>> readRanges;
+
+                // The values of these parts in the state for which the cached guard values are valid.
+                std::vector<uint64_t> cachedValues;
+
+                // Which guards of the group were already evaluated for the cached values and what they evaluated to.
+                storm::storage::BitVector evaluatedGuards;
+                storm::storage::BitVector enabledGuards;
+
+                // The expansion in which the cached values were last compared to the current state.
+                uint64_t lastExpansion;
+
+                // Whether the cached values were set at all.
+                bool hasCachedValues;
+            };
+
+            // An assignment of an update that is (if possible) carried out directly on the compressed state.
+            struct CompiledAssignment {
+                enum class Kind {Evaluate, Constant, Increment};
+
+                Kind kind;
+                storm::prism::Assignment const* assignment;
+                bool isBoolean;
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+                int64_t lowerBound;
+                int64_t upperBound;
+                bool forceOutOfBoundsCheck;
+
+                // The assigned value (for constant assignments) or the value that is added (for increments).
+                int64_t value;
+
+                // If set, the assigned expression is evaluated on the compressed state rather than by the evaluator.
+                boost::optional<BytecodeExpression> bytecode;
+            };
+
+            // The compiled form of an update.
+            struct CompiledUpdate {
+                std::vector<CompiledAssignment> assignments;
+
+                // If set, the likelihood is evaluated on the compressed state rather than by the evaluator.
+                boost::optional<BytecodeExpression> likelihood;
+            };
+
+            /*!
+             * Partitions the commands of the program by the parts of the state that their guards read and compiles the
+             * updates of all commands. This is done once upon construction.
+             */
+            void buildGuardIndexAndUpdateCache();
+
+            /*!
+             * Compiles the given update. Assignments of constants and assignments of the form x'=x+c (or x'=x-c) are
+             * carried out on the compressed state without consulting the evaluator. All other assigned expressions and
+             * (for double precision) the likelihood are compiled to bytecode if possible.
+             */
+            CompiledUpdate compileUpdate(storm::prism::Update const& update);
+
+            /*!
+             * Evaluates the likelihood of the given update in the currently loaded state.
+             */
+            ValueType evaluateLikelihood(storm::prism::Update const& update);
+
+            /*!
+             * Retrieves whether the guard of the given command is satisfied in the currently loaded state. Guards are
+             * evaluated lazily and their values are reused as long as the parts of the state read by the guards of the
+             * command's group are unchanged.
+             *
+             * @param moduleIndex The index of the module of the command.
+             * @param commandIndex The index of the command within its module.
+             * @return True iff the command is enabled.
+             */
+            bool isCommandEnabled(uint_fast64_t moduleIndex, uint_fast64_t commandIndex);
+
             /*!
              * Applies an update to the state currently loaded into the evaluator and applies the resulting values to
              * the given compressed state.
@@ -125,6 +204,29 @@ namespace storm {
             // Mappings from module/action indices to the programs players
             std::vector<storm::storage::PlayerIndex> moduleIndexToPlayerIndexMap;
             std::map<uint_fast64_t, storm::storage::PlayerIndex> actionIndexToPlayerIndexMap;
+
+            // Maps the boolean (first component true) and integer variables to their index in the variable information.
+            std::unordered_map<storm::expressions::Variable, std::pair<bool, uint64_t>> variableToInformationIndex;
+
+            // The groups of commands whose guards read the same parts of the state.
+            std::vector<GuardGroup> guardGroups;
+
+            // For each module and command, the index of the guard group and the position of the command in the group.
+            std::vector<std::vector<std::pair<uint64_t, uint64_t>>> commandToGuardGroup;
+
+            // A counter of the expansions that is used to compare the guard groups at most once per expansion.
+            uint64_t currentExpansion;
+
+            // The compiler that translates expressions to bytecode operating on the compressed states.
+            std::unique_ptr<BytecodeExpressionCompiler> bytecodeCompiler;
+
+            // For each module and command, the guard compiled to bytecode (if this was possible).
+            std::vector<std::vector<boost::optional<BytecodeExpression>>> compiledGuards;
+
+            // The compiled updates indexed by the global index of the updates. If the global indices are not unique,
+            // updates are compiled on the fly instead.
+            std::vector<CompiledUpdate> compiledUpdates;
+            bool hasCompiledUpdates;
         };
 
     }
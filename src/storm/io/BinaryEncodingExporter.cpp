@@ -0,0 +1,162 @@
+#include "storm/io/BinaryEncodingExporter.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
+
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+    namespace exporter {
+
+        const uint64_t BinaryEncodingHeader::MAGIC;
+        const uint64_t BinaryEncodingHeader::VERSION;
+        const uint64_t BinaryEncodingHeader::FLAG_TRIVIAL_ROW_GROUPING;
+        const uint64_t BinaryEncodingHeader::FLAG_EXIT_RATES;
+        const uint64_t BinaryEncodingHeader::FLAG_MARKOVIAN_STATES;
+        const uint64_t BinaryEncodingHeader::FLAG_OBSERVATIONS;
+        const uint64_t BinaryEncodingHeader::REWARDS_STATE;
+        const uint64_t BinaryEncodingHeader::REWARDS_STATE_ACTION;
+
+        namespace detail {
+            void writePadding(std::ostream& os, uint64_t numberOfBytes) {
+                static char const zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+                if (numberOfBytes % 8 != 0) {
+                    os.write(zeros, 8 - numberOfBytes % 8);
+                }
+            }
+
+            void writeWord(std::ostream& os, uint64_t value) {
+                os.write(reinterpret_cast<char const*>(&value), sizeof(value));
+            }
+
+            template<typename T>
+            void writeArray(std::ostream& os, std::vector<T> const& values) {
+                os.write(reinterpret_cast<char const*>(values.data()), values.size() * sizeof(T));
+                writePadding(os, values.size() * sizeof(T));
+            }
+
+            void writeString(std::ostream& os, std::string const& value) {
+                writeWord(os, value.size());
+                os.write(value.data(), value.size());
+                writePadding(os, value.size());
+            }
+
+            void writeBitVector(std::ostream& os, storm::storage::BitVector const& bitVector) {
+                for (uint64_t index = 0; index < bitVector.size(); index += 64) {
+                    uint64_t numberOfBits = std::min<uint64_t>(64, bitVector.size() - index);
+                    writeWord(os, bitVector.getAsInt(index, numberOfBits));
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void binaryExportSparseModel(std::ostream&, std::shared_ptr<storm::models::sparse::Model<ValueType>>) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The binary format only supports models with double precision values.");
+        }
+
+        template<>
+        void binaryExportSparseModel<double>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> sparseModel) {
+            storm::models::ModelType type = sparseModel->getType();
+            STORM_LOG_THROW(type == storm::models::ModelType::Dtmc || type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp, storm::exceptions::NotSupportedException, "The binary format does not support models of type " << type << ".");
+            STORM_LOG_WARN_COND(!sparseModel->hasChoiceLabeling(), "Choice labels are not exported to the binary format.");
+            STORM_LOG_WARN_COND(!sparseModel->hasStateValuations(), "State valuations are not exported to the binary format.");
+
+            storm::storage::SparseMatrix<double> const& matrix = sparseModel->getTransitionMatrix();
+
+            // Notice that for CTMCs we write the rate matrix instead of probabilities.
+            std::vector<double> const* exitRates = nullptr;
+            storm::storage::BitVector const* markovianStates = nullptr;
+            std::vector<uint32_t> const* observations = nullptr;
+            if (type == storm::models::ModelType::Ctmc) {
+                exitRates = &sparseModel->template as<storm::models::sparse::Ctmc<double>>()->getExitRateVector();
+            } else if (type == storm::models::ModelType::MarkovAutomaton) {
+                exitRates = &sparseModel->template as<storm::models::sparse::MarkovAutomaton<double>>()->getExitRates();
+                markovianStates = &sparseModel->template as<storm::models::sparse::MarkovAutomaton<double>>()->getMarkovianStates();
+            } else if (type == storm::models::ModelType::Pomdp) {
+                observations = &sparseModel->template as<storm::models::sparse::Pomdp<double>>()->getObservations();
+            }
+
+            // Write header.
+            BinaryEncodingHeader header;
+            header.magic = BinaryEncodingHeader::MAGIC;
+            header.version = BinaryEncodingHeader::VERSION;
+            header.modelType = static_cast<uint64_t>(type);
+            header.numberOfStates = sparseModel->getNumberOfStates();
+            header.numberOfRows = matrix.getRowCount();
+            header.numberOfEntries = matrix.end() - matrix.begin();
+            header.numberOfLabels = sparseModel->getStateLabeling().getNumberOfLabels();
+            header.numberOfRewardModels = sparseModel->getRewardModels().size();
+            header.flags = 0;
+            header.flags |= matrix.hasTrivialRowGrouping() ? BinaryEncodingHeader::FLAG_TRIVIAL_ROW_GROUPING : 0;
+            header.flags |= exitRates ? BinaryEncodingHeader::FLAG_EXIT_RATES : 0;
+            header.flags |= markovianStates ? BinaryEncodingHeader::FLAG_MARKOVIAN_STATES : 0;
+            header.flags |= observations ? BinaryEncodingHeader::FLAG_OBSERVATIONS : 0;
+            os.write(reinterpret_cast<char const*>(&header), sizeof(header));
+
+            // Write the transition matrix.
+            std::vector<uint64_t> rowIndications;
+            rowIndications.reserve(matrix.getRowCount() + 1);
+            for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                rowIndications.push_back(matrix.begin(row) - matrix.begin());
+            }
+            rowIndications.push_back(matrix.end() - matrix.begin());
+            detail::writeArray(os, rowIndications);
+            if (!matrix.hasTrivialRowGrouping()) {
+                detail::writeArray(os, matrix.getRowGroupIndices());
+            }
+            for (auto const& entry : matrix) {
+                detail::writeWord(os, entry.getColumn());
+            }
+            for (auto const& entry : matrix) {
+                double value = entry.getValue();
+                os.write(reinterpret_cast<char const*>(&value), sizeof(value));
+            }
+
+            // Write model type specific components.
+            if (exitRates) {
+                detail::writeArray(os, *exitRates);
+            }
+            if (markovianStates) {
+                detail::writeBitVector(os, *markovianStates);
+            }
+            if (observations) {
+                detail::writeArray(os, *observations);
+            }
+
+            // Write labels.
+            for (auto const& label : sparseModel->getStateLabeling().getLabels()) {
+                detail::writeString(os, label);
+                detail::writeBitVector(os, sparseModel->getStateLabeling().getStates(label));
+            }
+
+            // Write reward models.
+            for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
+                STORM_LOG_THROW(!rewardModelEntry.second.hasTransitionRewards(), storm::exceptions::NotSupportedException, "The binary format does not support transition rewards.");
+                detail::writeString(os, rewardModelEntry.first);
+                uint64_t rewardFlags = 0;
+                rewardFlags |= rewardModelEntry.second.hasStateRewards() ? BinaryEncodingHeader::REWARDS_STATE : 0;
+                rewardFlags |= rewardModelEntry.second.hasStateActionRewards() ? BinaryEncodingHeader::REWARDS_STATE_ACTION : 0;
+                detail::writeWord(os, rewardFlags);
+                if (rewardModelEntry.second.hasStateRewards()) {
+                    detail::writeArray(os, rewardModelEntry.second.getStateRewardVector());
+                }
+                if (rewardModelEntry.second.hasStateActionRewards()) {
+                    detail::writeArray(os, rewardModelEntry.second.getStateActionRewardVector());
+                }
+            }
+
+            STORM_LOG_THROW(os.good(), storm::exceptions::FileIoException, "Error while writing the model in the binary format.");
+        }
+
+        // Template instantiations
+        template void binaryExportSparseModel<storm::RationalNumber>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> sparseModel);
+        template void binaryExportSparseModel<storm::RationalFunction>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> sparseModel);
+    }
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+    namespace exporter {
+
+        /*!
+         * The header of the binary format for sparse models. The header is followed by the sections below, each of which
+         * starts at a multiple of eight bytes (all integers and values are stored in the byte order of the exporting
+         * machine):
+         *
+         * - the row indications (number of rows + 1 entries) and, unless the row grouping is trivial, the row group
+         *   indices (number of states + 1 entries) of the transition matrix,
+         * - the columns and the values of all matrix entries (as two separate arrays),
+         * - the exit rates (if the corresponding flag is set),
+         * - the buckets of the Markovian states (if the corresponding flag is set),
+         * - the observations (if the corresponding flag is set),
+         * - for each label its name (length and characters) followed by the buckets of the labelled states,
+         * - for each reward model its name, a word indicating which reward vectors follow and the reward vectors.
+         *
+         * As the sections directly mirror the underlying storage, a model can be loaded from a memory mapped file
+         * without any parsing.
+         */
+        struct BinaryEncodingHeader {
+            // Identifies the format. As it is stored in the byte order of the exporting machine, this also reveals
+            // files with a foreign byte order.
+            uint64_t magic;
+            uint64_t version;
+            uint64_t modelType;
+            uint64_t numberOfStates;
+            uint64_t numberOfRows;
+            uint64_t numberOfEntries;
+            uint64_t numberOfLabels;
+            uint64_t numberOfRewardModels;
+            uint64_t flags;
+
+            // The characters "STORMBIN" when stored in little endian byte order.
+            static const uint64_t MAGIC = 0x4e49424d524f5453ull;
+            static const uint64_t VERSION = 1;
+
+            static const uint64_t FLAG_TRIVIAL_ROW_GROUPING = 1ull << 0;
+            static const uint64_t FLAG_EXIT_RATES = 1ull << 1;
+            static const uint64_t FLAG_MARKOVIAN_STATES = 1ull << 2;
+            static const uint64_t FLAG_OBSERVATIONS = 1ull << 3;
+
+            static const uint64_t REWARDS_STATE = 1ull << 0;
+            static const uint64_t REWARDS_STATE_ACTION = 1ull << 1;
+        };
+
+        /*!
+         * Exports a sparse model into the binary format (see BinaryEncodingHeader). Only models with double precision
+         * values are supported. Choice labels, state valuations and transition rewards are not exported.
+         *
+         * @param os           Stream to export to. Should be opened in binary mode.
+         * @param sparseModel  Model to export
+         */
+        template<typename ValueType>
+        void binaryExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel);
+
+    }
+}
@@ -0,0 +1,72 @@
+#include "storm/io/TemporaryFile.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <unistd.h>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+
+namespace storm {
+    namespace io {
+
+        TemporaryFile::TemporaryFile(std::string const& directory) : size(0) {
+            std::string actualDirectory = directory;
+            if (actualDirectory.empty()) {
+                char const* environmentDirectory = std::getenv("TMPDIR");
+                actualDirectory = environmentDirectory != nullptr ? environmentDirectory : "/tmp";
+            }
+            std::string pattern = actualDirectory + "/storm-XXXXXX";
+            std::vector<char> filename(pattern.begin(), pattern.end());
+            filename.push_back('\0');
+            fileDescriptor = mkstemp(filename.data());
+            STORM_LOG_THROW(fileDescriptor != -1, storm::exceptions::FileIoException, "Unable to create temporary file in directory " << actualDirectory << ": " << std::strerror(errno) << ".");
+            // Remove the file from the directory. It remains accessible through the descriptor.
+            unlink(filename.data());
+        }
+
+        TemporaryFile::~TemporaryFile() {
+            close(fileDescriptor);
+        }
+
+        void TemporaryFile::append(void const* data, uint64_t numberOfBytes) {
+            char const* current = static_cast<char const*>(data);
+            while (numberOfBytes > 0) {
+                ssize_t written = pwrite(fileDescriptor, current, numberOfBytes, size);
+                STORM_LOG_THROW(written > 0 || (written == -1 && errno == EINTR), storm::exceptions::FileIoException, "Unable to write to temporary file: " << std::strerror(errno) << ".");
+                if (written > 0) {
+                    current += written;
+                    size += written;
+                    numberOfBytes -= written;
+                }
+            }
+        }
+
+        void TemporaryFile::read(uint64_t offset, void* data, uint64_t numberOfBytes) const {
+            STORM_LOG_ASSERT(offset + numberOfBytes <= size, "Reading beyond the end of the temporary file.");
+            char* current = static_cast<char*>(data);
+            while (numberOfBytes > 0) {
+                ssize_t numberOfReadBytes = pread(fileDescriptor, current, numberOfBytes, offset);
+                STORM_LOG_THROW(numberOfReadBytes > 0 || (numberOfReadBytes == -1 && errno == EINTR), storm::exceptions::FileIoException, "Unable to read from temporary file: " << std::strerror(errno) << ".");
+                if (numberOfReadBytes > 0) {
+                    current += numberOfReadBytes;
+                    offset += numberOfReadBytes;
+                    numberOfBytes -= numberOfReadBytes;
+                }
+            }
+        }
+
+        void TemporaryFile::clear() {
+            STORM_LOG_THROW(ftruncate(fileDescriptor, 0) == 0, storm::exceptions::FileIoException, "Unable to truncate temporary file: " << std::strerror(errno) << ".");
+            size = 0;
+        }
+
+        uint64_t TemporaryFile::getSize() const {
+            return size;
+        }
+
+    }
+}
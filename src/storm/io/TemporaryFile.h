@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace storm {
+    namespace io {
+
+        /*!
+         * A binary file that only exists as long as this object exists. The file is created in the given directory
+         * and removed from the file system right away, so it also disappears if the process terminates abnormally.
+         */
+        class TemporaryFile {
+        public:
+            /*!
+             * Creates a new empty temporary file.
+             *
+             * @param directory The directory in which to create the file. If empty, the directory given by the
+             * environment variable TMPDIR (or /tmp) is used.
+             */
+            TemporaryFile(std::string const& directory = "");
+
+            TemporaryFile(TemporaryFile const&) = delete;
+            TemporaryFile& operator=(TemporaryFile const&) = delete;
+
+            ~TemporaryFile();
+
+            /*!
+             * Appends the given number of bytes to the file.
+             */
+            void append(void const* data, uint64_t numberOfBytes);
+
+            /*!
+             * Reads the given number of bytes starting at the given offset. May be called concurrently (but not
+             * concurrently to append or clear).
+             */
+            void read(uint64_t offset, void* data, uint64_t numberOfBytes) const;
+
+            /*!
+             * Removes the content of the file.
+             */
+            void clear();
+
+            /*!
+             * Retrieves the size of the file in bytes.
+             */
+            uint64_t getSize() const;
+
+        private:
+            // The descriptor of the opened file.
+            int fileDescriptor;
+
+            // The current size of the file.
+            uint64_t size;
+        };
+
+    }
+}
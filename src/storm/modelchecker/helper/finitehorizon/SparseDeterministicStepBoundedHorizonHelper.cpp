@@ -40,7 +40,7 @@ namespace storm {
                 } else {
                     maybeStates = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates, true, upperBound);
                     if (lowerBound == 0) {
-                        maybeStates &= ~psiStates;
+                        maybeStates.andNotAssign(psiStates);
                     } else {
                         makeZeroColumns = psiStates;
                     }
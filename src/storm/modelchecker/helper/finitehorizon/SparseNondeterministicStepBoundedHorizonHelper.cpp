@@ -42,7 +42,7 @@ namespace storm {
                         maybeStates = storm::utility::graph::performProbGreater0E(backwardTransitions, phiStates, psiStates, true, upperBound);
                     }
                     if (lowerBound == 0) {
-                        maybeStates &= ~psiStates;
+                        maybeStates.andNotAssign(psiStates);
                     } else {
                         makeZeroColumns = psiStates;
                     }
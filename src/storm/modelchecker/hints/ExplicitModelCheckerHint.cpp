@@ -114,6 +114,21 @@ namespace storm {
             noEndComponentsInMaybeStates = value;
         }
     
+        template<typename ValueType>
+        bool ExplicitModelCheckerHint<ValueType>::hasSolverSession() const {
+            return static_cast<bool>(solverSession);
+        }
+    
+        template<typename ValueType>
+        helper::SparseMdpSolverSession<ValueType>& ExplicitModelCheckerHint<ValueType>::getSolverSession() const {
+            return *solverSession;
+        }
+    
+        template<typename ValueType>
+        void ExplicitModelCheckerHint<ValueType>::setSolverSession(std::shared_ptr<helper::SparseMdpSolverSession<ValueType>> const& solverSession) {
+            this->solverSession = solverSession;
+        }
+    
         template class ExplicitModelCheckerHint<double>;
         template class ExplicitModelCheckerHint<storm::RationalNumber>;
         template class ExplicitModelCheckerHint<storm::RationalFunction>;
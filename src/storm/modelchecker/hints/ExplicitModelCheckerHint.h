@@ -1,6 +1,7 @@
 #ifndef STORM_MODELCHECKER_HINTS_EXPLICITMODELCHECKERHINT_H
 #define STORM_MODELCHECKER_HINTS_EXPLICITMODELCHECKERHINT_H
 
+#include <memory>
 #include <vector>
 #include <boost/optional.hpp>
 
@@ -9,6 +10,10 @@
 
 namespace storm {
     namespace modelchecker {
+        namespace helper {
+            template<typename ValueType>
+            class SparseMdpSolverSession;
+        }
         
         /*!
          * This class contains information that might accelerate the model checking process.
@@ -56,13 +61,21 @@ namespace storm {
             bool getNoEndComponentsInMaybeStates() const;
             void setNoEndComponentsInMaybeStates(bool value);
             
+            // If set, the data that is computed while solving equation systems for MDPs (decompositions, solvers and
+            // solutions) is kept in the given session and reused by later queries on the same model.
+            bool hasSolverSession() const;
+            helper::SparseMdpSolverSession<ValueType>& getSolverSession() const;
+            void setSolverSession(std::shared_ptr<helper::SparseMdpSolverSession<ValueType>> const& solverSession);
+            
         private:
             boost::optional<std::vector<ValueType>> resultHint;
             boost::optional<storm::storage::Scheduler<ValueType>> schedulerHint;
             
-            bool computeOnlyMaybeStates;
+            bool computeOnlyMaybeStates = false;
             boost::optional<storm::storage::BitVector> maybeStates;
-            bool noEndComponentsInMaybeStates;
+            bool noEndComponentsInMaybeStates = false;
+            
+            std::shared_ptr<helper::SparseMdpSolverSession<ValueType>> solverSession;
         };
         
     }
@@ -1,5 +1,8 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaParetoQuery.h"
 
+#include <algorithm>
+#include <type_traits>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
@@ -7,6 +10,7 @@
 #include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/modelchecker/multiobjective/MultiObjectivePostprocessing.h"
@@ -17,7 +21,7 @@ namespace storm {
         namespace multiobjective {
             
             template <class SparseModelType, typename GeometryValueType>
-            SparsePcaaParetoQuery<SparseModelType, GeometryValueType>::SparsePcaaParetoQuery(preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType>& preprocessorResult) : SparsePcaaQuery<SparseModelType, GeometryValueType>(preprocessorResult) {
+            SparsePcaaParetoQuery<SparseModelType, GeometryValueType>::SparsePcaaParetoQuery(preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType>& preprocessorResult) : SparsePcaaQuery<SparseModelType, GeometryValueType>(preprocessorResult), preprocessorResult(preprocessorResult) {
                 STORM_LOG_ASSERT(preprocessorResult.queryType == preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType>::QueryType::Pareto, "Invalid query Type");
             }
             
@@ -34,6 +38,14 @@ namespace storm {
                 // Lets be a little bit more precise to reduce the number of required iterations.
                 weightedPrecision *= storm::utility::convertNumber<typename SparseModelType::ValueType>(0.9);
                 this->weightVectorChecker->setWeightedPrecision(weightedPrecision);
+                
+                // Every concurrent refinement step needs its own weight vector checker.
+                while (additionalWeightVectorCheckers.size() + 1 < env.modelchecker().multi().getNumberOfParallelRefinementSteps()) {
+                    additionalWeightVectorCheckers.push_back(WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult));
+                }
+                for (auto& checker : additionalWeightVectorCheckers) {
+                    checker->setWeightedPrecision(weightedPrecision);
+                }
 
                 // refine the approximation
                 exploreSetOfAchievablePoints(env);
@@ -58,41 +70,95 @@ namespace storm {
                 STORM_LOG_THROW(env.modelchecker().multi().getPrecisionType() == MultiObjectiveModelCheckerEnvironment::PrecisionType::Absolute, storm::exceptions::IllegalArgumentException, "Unhandled multiobjective precision type.");
 
                 //First consider the objectives individually
-                for(uint_fast64_t objIndex = 0; objIndex<this->objectives.size() && !this->maxStepsPerformed(env); ++objIndex) {
-                    WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
-                    direction[objIndex] = storm::utility::one<GeometryValueType>();
-                    this->performRefinementStep(env, std::move(direction));
-                    if (storm::utility::resources::isTerminate()) {
-                        break;
+                uint_fast64_t objIndex = 0;
+                while (objIndex < this->objectives.size() && !this->maxStepsPerformed(env) && !storm::utility::resources::isTerminate()) {
+                    std::vector<WeightVector> directions;
+                    for (uint_fast64_t numberOfSteps = getNumberOfConcurrentRefinementSteps(env); numberOfSteps > 0 && objIndex < this->objectives.size(); --numberOfSteps, ++objIndex) {
+                        WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
+                        direction[objIndex] = storm::utility::one<GeometryValueType>();
+                        directions.push_back(std::move(direction));
                     }
+                    performRefinementSteps(env, std::move(directions));
                 }
                 
+                GeometryValueType precision = storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision());
                 while(!this->maxStepsPerformed(env) && !storm::utility::resources::isTerminate()) {
-                    // Get the halfspace of the underApproximation with maximal distance to a vertex of the overApproximation
+                    // Sort the halfspaces of the underApproximation by their maximal distance to a vertex of the overApproximation.
+                    // Halfspaces with the same distance keep their order, so the first one is refined first.
                     std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> underApproxHalfspaces = this->underApproximation->getHalfspaces();
                     std::vector<Point> overApproxVertices = this->overApproximation->getVertices();
-                    uint_fast64_t farestHalfspaceIndex = underApproxHalfspaces.size();
-                    GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
+                    std::vector<std::pair<GeometryValueType, uint_fast64_t>> halfspaceDistances;
                     for(uint_fast64_t halfspaceIndex = 0; halfspaceIndex < underApproxHalfspaces.size(); ++halfspaceIndex) {
+                        GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
                         for(auto const& vertex : overApproxVertices) {
-                            GeometryValueType distance = underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex);
-                            if(distance > farestDistance) {
-                                farestHalfspaceIndex = halfspaceIndex;
-                                farestDistance = distance;
-                            }
+                            farestDistance = std::max(farestDistance, underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex));
                         }
+                        halfspaceDistances.emplace_back(farestDistance, halfspaceIndex);
                     }
-                    if(farestDistance < storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision())) {
+                    std::stable_sort(halfspaceDistances.begin(), halfspaceDistances.end(), [] (std::pair<GeometryValueType, uint_fast64_t> const& lhs, std::pair<GeometryValueType, uint_fast64_t> const& rhs) { return lhs.first > rhs.first; });
+                    if(halfspaceDistances.empty() || halfspaceDistances.front().first < precision) {
                         // Goal precision reached!
                         return;
                     }
-                    STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(farestDistance));
-                    WeightVector direction = underApproxHalfspaces[farestHalfspaceIndex].normalVector();
-                    this->performRefinementStep(env, std::move(direction));
+                    STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(halfspaceDistances.front().first));
+                    
+                    // Refine the halfspaces that are farthest away. As they belong to different facets, the corresponding weight vectors are independent.
+                    std::vector<WeightVector> directions;
+                    uint_fast64_t numberOfSteps = getNumberOfConcurrentRefinementSteps(env);
+                    for (auto const& halfspaceDistance : halfspaceDistances) {
+                        if (directions.size() == numberOfSteps || halfspaceDistance.first < precision) {
+                            break;
+                        }
+                        directions.push_back(underApproxHalfspaces[halfspaceDistance.second].normalVector());
+                    }
+                    performRefinementSteps(env, std::move(directions));
                 }
                 STORM_LOG_ERROR("Could not reach the desired precision: Termination requested or maximum number of refinement steps exceeded.");
             }
             
+            template <class SparseModelType, typename GeometryValueType>
+            uint_fast64_t SparsePcaaParetoQuery<SparseModelType, GeometryValueType>::getNumberOfConcurrentRefinementSteps(Environment const& env) const {
+                uint_fast64_t result = additionalWeightVectorCheckers.size() + 1;
+                if (env.modelchecker().multi().isMaxStepsSet()) {
+                    STORM_LOG_ASSERT(env.modelchecker().multi().getMaxSteps() > this->refinementSteps.size(), "The maximal number of refinement steps is already reached.");
+                    result = std::min<uint_fast64_t>(result, env.modelchecker().multi().getMaxSteps() - this->refinementSteps.size());
+                }
+                return result;
+            }
+            
+            template <class SparseModelType, typename GeometryValueType>
+            void SparsePcaaParetoQuery<SparseModelType, GeometryValueType>::performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions) {
+                STORM_LOG_ASSERT(directions.size() <= additionalWeightVectorCheckers.size() + 1, "There are not enough weight vector checkers for the given directions.");
+                if (directions.size() == 1) {
+                    this->performRefinementStep(env, std::move(directions.front()));
+                    return;
+                }
+                
+                // Every step gets its own copy of the environment, as sub-environments are created lazily on first access.
+                std::vector<Environment> environments(directions.size(), env);
+                std::vector<typename SparsePcaaQuery<SparseModelType, GeometryValueType>::RefinementStep> steps(directions.size());
+                auto computeSteps = [&] (auto const& range) {
+                    for (uint_fast64_t stepIndex = range.begin(); stepIndex < range.end(); ++stepIndex) {
+                        auto& checker = stepIndex == 0 ? *this->weightVectorChecker : *additionalWeightVectorCheckers[stepIndex - 1];
+                        steps[stepIndex] = this->computeRefinementStep(environments[stepIndex], std::move(directions[stepIndex]), checker);
+                    }
+                };
+                
+                // Exact arithmetic is not thread-safe, so the steps are only computed concurrently if neither the model
+                // checking nor the geometry uses exact numbers. Otherwise, the steps are computed one after another.
+                if (std::is_same<typename SparseModelType::ValueType, double>::value && std::is_same<GeometryValueType, double>::value) {
+                    storm::utility::parallel::parallelFor(0, directions.size(), 1, computeSteps);
+                } else {
+                    computeSteps(storm::utility::parallel::Range(0, directions.size()));
+                }
+                
+                // Merge the obtained points into the approximations.
+                for (auto& step : steps) {
+                    this->refinementSteps.push_back(std::move(step));
+                    this->updateOverApproximation();
+                }
+                this->updateUnderApproximation();
+            }
             
 #ifdef STORM_HAVE_CARL
             template class SparsePcaaParetoQuery<storm::models::sparse::Mdp<double>, storm::RationalNumber>;
@@ -40,6 +40,25 @@ namespace storm {
                  * Performs refinement steps until the approximation is sufficiently precise
                  */
                 void exploreSetOfAchievablePoints(Environment const& env);
+                
+                /*
+                 * Retrieves the number of refinement steps that are performed at once. This respects the maximal number
+                 * of refinement steps (if given).
+                 */
+                uint_fast64_t getNumberOfConcurrentRefinementSteps(Environment const& env) const;
+                
+                /*
+                 * Refines the current result w.r.t. the given direction vectors. The weight vectors are checked (each one
+                 * with its own weight vector checker) before the approximations are updated. This happens concurrently
+                 * unless exact arithmetic is involved.
+                 */
+                void performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions);
+                
+                // The result from preprocessing, used to create the additional weight vector checkers.
+                preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType> const& preprocessorResult;
+                
+                // The weight vector checkers that are used (besides the one of the query) for concurrent refinement steps.
+                std::vector<std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>>> additionalWeightVectorCheckers;
             };
             
         }
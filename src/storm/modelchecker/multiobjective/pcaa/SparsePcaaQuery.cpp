@@ -82,14 +82,22 @@ namespace storm {
             
             template <class SparseModelType, typename GeometryValueType>
             void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(Environment const& env, WeightVector&& direction) {
+                refinementSteps.push_back(computeRefinementStep(env, std::move(direction), *weightVectorChecker));
+                
+                updateOverApproximation();
+                updateUnderApproximation();
+            }
+            
+            template <class SparseModelType, typename GeometryValueType>
+            typename SparsePcaaQuery<SparseModelType, GeometryValueType>::RefinementStep SparsePcaaQuery<SparseModelType, GeometryValueType>::computeRefinementStep(Environment const& env, WeightVector&& direction, PcaaWeightVectorChecker<SparseModelType>& checker) const {
                 // Normalize the direction vector so that the entries sum up to one
                 storm::utility::vector::scaleVectorInPlace(direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
-                weightVectorChecker->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
-                STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(weightVectorChecker->getUnderApproximationOfInitialStateResults())));
+                checker.check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
+                STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(checker.getUnderApproximationOfInitialStateResults())));
                 RefinementStep step;
-                step.weightVector = direction;
-                step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getUnderApproximationOfInitialStateResults());
-                step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getOverApproximationOfInitialStateResults());
+                step.weightVector = std::move(direction);
+                step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getUnderApproximationOfInitialStateResults());
+                step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getOverApproximationOfInitialStateResults());
                 // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
                 for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
                     if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
@@ -97,10 +105,7 @@ namespace storm {
                         step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
                     }
                 }
-                refinementSteps.push_back(std::move(step));
-                
-                updateOverApproximation();
-                updateUnderApproximation();
+                return step;
             }
             
             template <class SparseModelType, typename GeometryValueType>
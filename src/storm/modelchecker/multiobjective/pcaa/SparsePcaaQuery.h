@@ -70,6 +70,12 @@ namespace storm {
                  */
                 void performRefinementStep(Environment const& env, WeightVector&& direction);
                 
+                /*
+                 * Checks the given direction vector with the given weight vector checker and returns the obtained information.
+                 * The approximations are not updated. Calls with different checkers can be executed concurrently.
+                 */
+                RefinementStep computeRefinementStep(Environment const& env, WeightVector&& direction, PcaaWeightVectorChecker<SparseModelType>& checker) const;
+                
                 /*
                  * Updates the overapproximation after a refinement step has been performed
                  *
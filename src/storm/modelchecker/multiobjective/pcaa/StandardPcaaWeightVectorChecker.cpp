@@ -835,7 +835,7 @@ namespace storm {
                     // Set a scheduler for the ecStates that we want to reach
                     computeSchedulerProb0(transitionMatrix, backwardsTransitions, ecStatesToReach, ~unprocessedStates | ~totalReward0EStates, actionsWithoutRewardInUnboundedPhase, originalOptimalChoices);
                 }
-                unprocessedStates &= ~ecStatesToReach;
+                unprocessedStates.andNotAssign(ecStatesToReach);
                 // Set a scheduler for the remaining states
                 computeSchedulerProb1(transitionMatrix, backwardsTransitions, unprocessedStates, ecStatesToReach, originalOptimalChoices);
             }
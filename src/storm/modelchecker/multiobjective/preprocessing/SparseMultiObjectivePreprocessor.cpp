@@ -412,7 +412,7 @@ namespace storm {
                     // Get the states that are reachable from an initial state, stopping at the states reachable from goal
                     storm::storage::BitVector reachableFromInit = storm::utility::graph::getReachableStates(data.model->getTransitionMatrix(), data.model->getInitialStates(), ~notLeftOrRight, reachableFromGoal);
                     // Exclude the actual notLeftOrRight states from the states that are reachable from init
-                    reachableFromInit &= ~notLeftOrRight;
+                    reachableFromInit.andNotAssign(notLeftOrRight);
                     // If we can reach a state that is reachable from goal, but which is not a goal state, it means that the transformation to expected rewards is not possible.
                     if ((reachableFromInit & reachableFromGoal).empty()) {
                         STORM_LOG_INFO("Objective " << *data.objectives.back()->originalFormula << " is transformed to an expected total/cumulative reward property.");
@@ -485,7 +485,7 @@ namespace storm {
                     // Get the states that are reachable from an initial state, stopping at the states reachable from goal
                     storm::storage::BitVector reachableFromInit = storm::utility::graph::getReachableStates(data.model->getTransitionMatrix(), data.model->getInitialStates(), allStates, reachableFromGoal);
                     // Exclude the actual goal states from the states that are reachable from an initial state
-                    reachableFromInit &= ~subFormulaResult;
+                    reachableFromInit.andNotAssign(subFormulaResult);
                     // If we can reach a state that is reachable from goal but which is not a goal state, it means that the transformation to expected total rewards is not possible.
                     if ((reachableFromInit & reachableFromGoal).empty()) {
                         STORM_LOG_INFO("Objective " << *data.objectives.back()->originalFormula << " is transformed to an expected total reward property.");
@@ -28,6 +28,7 @@
 
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/PerformanceCounters.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/io/export.h"
 
@@ -164,7 +165,11 @@ namespace storm {
                     STORM_LOG_INFO("Preprocessing: " << statesWithProbability1.getNumberOfSetBits() << " states with probability 1 (" << maybeStates.getNumberOfSetBits() << " states remaining).");
                 } else {
                     // Get all states that have probability 0 and 1 of satisfying the until-formula.
-                    std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+                    std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
+                    {
+                        storm::utility::PerformanceCounters::Scope scope(env.getPerformanceCounters(), "precomputation");
+                        statesWithProbability01 = storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+                    }
                     storm::storage::BitVector statesWithProbability0 = std::move(statesWithProbability01.first);
                     statesWithProbability1 = std::move(statesWithProbability01.second);
                     maybeStates = ~(statesWithProbability0 | statesWithProbability1);
@@ -428,7 +433,11 @@ namespace storm {
                     STORM_LOG_INFO("Preprocessing: " << rew0States.getNumberOfSetBits() << " States with reward zero (" << maybeStates.getNumberOfSetBits() << " states remaining).");
                 } else {
                     storm::storage::BitVector trueStates(transitionMatrix.getRowCount(), true);
-                    storm::storage::BitVector infinityStates = storm::utility::graph::performProb1(backwardTransitions, trueStates, rew0States);
+                    storm::storage::BitVector infinityStates;
+                    {
+                        storm::utility::PerformanceCounters::Scope scope(env.getPerformanceCounters(), "precomputation");
+                        infinityStates = storm::utility::graph::performProb1(backwardTransitions, trueStates, rew0States);
+                    }
                     infinityStates.complement();
                     maybeStates = ~(rew0States | infinityStates);
                     
@@ -7,6 +7,7 @@
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpSolverSession.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -35,6 +36,7 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/io/export.h"
 #include "storm/utility/NumberTraits.h"
+#include "storm/utility/PerformanceCounters.h"
 
 #include "storm/transformer/EndComponentEliminator.h"
 
@@ -396,14 +398,51 @@ namespace storm {
             };
             
             template<typename ValueType>
-            MaybeStateResult<ValueType> computeValuesForMaybeStates(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType>&& submatrix, std::vector<ValueType> const& b, bool produceScheduler, SparseMdpHintType<ValueType>& hint) {
+            SparseMdpSolverSession<ValueType>* getSolverSession(ModelCheckerHint const& hint) {
+                if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().hasSolverSession()) {
+                    return &hint.template asExplicitModelCheckerHint<ValueType>().getSolverSession();
+                }
+                return nullptr;
+            }
+            
+            template<typename ValueType>
+            MaybeStateResult<ValueType> computeValuesForMaybeStates(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType>&& submatrix, std::vector<ValueType> const& b, bool produceScheduler, SparseMdpHintType<ValueType>& hint, SparseMdpSolverSession<ValueType>* session = nullptr) {
+                
+                // If the same equation system was solved before, we start from the previous solution (scheduler). As for
+                // hints provided by the caller, this requires a unique solution (the absence of end components).
+                typename SparseMdpSolverSession<ValueType>::EquationSystemData* sessionData = session ? &session->getEquationSystemData(submatrix, env.solver().minMax().getMethod()) : nullptr;
+                if (sessionData) {
+                    if (!hint.hasValueHint() && hint.hasUniqueSolution() && sessionData->values) {
+                        hint.valueHint = sessionData->values.get();
+                    }
+                    if (!hint.hasSchedulerHint() && hint.hasNoEndComponents() && sessionData->scheduler && env.solver().minMax().getMethod() == storm::solver::MinMaxMethod::PolicyIteration) {
+                        hint.schedulerHint = sessionData->scheduler.get();
+                    }
+                }
                 
                 // Initialize the solution vector.
                 std::vector<ValueType> x = hint.hasValueHint() ? std::move(hint.getValueHint()) : std::vector<ValueType>(submatrix.getRowGroupCount(), hint.hasLowerResultBound() ? hint.getLowerResultBound() : storm::utility::zero<ValueType>());
                 
-                // Set up the solver.
-                storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType> minMaxLinearEquationSolverFactory;
-                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = storm::solver::configureMinMaxLinearEquationSolver(env, std::move(goal), minMaxLinearEquationSolverFactory, std::move(submatrix));
+                // Set up the solver. A solver of the session is reused (along with its caches), but it forgets the
+                // settings of its previous query.
+                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> localSolver;
+                storm::solver::MinMaxLinearEquationSolver<ValueType>* solver;
+                if (sessionData && sessionData->solver) {
+                    solver = sessionData->solver.get();
+                    storm::solver::configureMinMaxLinearEquationSolver(std::move(goal), *solver);
+                    solver->clearBounds();
+                    solver->clearInitialScheduler();
+                } else {
+                    storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType> minMaxLinearEquationSolverFactory;
+                    localSolver = storm::solver::configureMinMaxLinearEquationSolver(env, std::move(goal), minMaxLinearEquationSolverFactory, std::move(submatrix));
+                    if (sessionData) {
+                        localSolver->setCachingEnabled(true);
+                        sessionData->solver = std::move(localSolver);
+                        solver = sessionData->solver.get();
+                    } else {
+                        solver = localSolver.get();
+                    }
+                }
                 solver->setRequirementsChecked();
                 solver->setHasUniqueSolution(hint.hasUniqueSolution());
                 solver->setHasNoEndComponents(hint.hasNoEndComponents());
@@ -435,6 +474,16 @@ namespace storm {
                 }
 #endif
                 
+                // Keep the solution (and scheduler) as starting point for later queries.
+                if (sessionData) {
+                    sessionData->values = x;
+                    if (solver->hasScheduler()) {
+                        sessionData->scheduler = solver->getSchedulerChoices();
+                    } else {
+                        sessionData->scheduler = boost::none;
+                    }
+                }
+                
                 // Create result.
                 MaybeStateResult<ValueType> result(std::move(x));
 
@@ -544,23 +593,28 @@ namespace storm {
             }
             
             template<typename ValueType>
-            boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(storm::solver::SolveGoal<ValueType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, QualitativeStateSetsUntilProbabilities const& qualitativeStateSets, storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b, bool produceScheduler) {
+            boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(storm::solver::SolveGoal<ValueType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, QualitativeStateSetsUntilProbabilities const& qualitativeStateSets, storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b, bool produceScheduler, SparseMdpSolverSession<ValueType>* session = nullptr) {
                 
                 // Get the set of states that (under some scheduler) can stay in the set of maybestates forever
                 storm::storage::BitVector candidateStates = storm::utility::graph::performProb0E(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, qualitativeStateSets.maybeStates, ~qualitativeStateSets.maybeStates);
                 
                 bool doDecomposition = !candidateStates.empty();
                 
-                storm::storage::MaximalEndComponentDecomposition<ValueType> endComponentDecomposition;
+                storm::storage::MaximalEndComponentDecomposition<ValueType> localEndComponentDecomposition;
+                storm::storage::MaximalEndComponentDecomposition<ValueType> const* endComponentDecomposition = &localEndComponentDecomposition;
                 if (doDecomposition) {
                     // Compute the states that are in MECs.
-                    endComponentDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, candidateStates);
+                    if (session) {
+                        endComponentDecomposition = &session->getEndComponentDecomposition(transitionMatrix, backwardTransitions, candidateStates);
+                    } else {
+                        localEndComponentDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, candidateStates);
+                    }
                 }
                 
                 // Only do more work if there are actually end-components.
-                if (doDecomposition && !endComponentDecomposition.empty()) {
-                    STORM_LOG_DEBUG("Eliminating " << endComponentDecomposition.size() << " EC(s).");
-                    SparseMdpEndComponentInformation<ValueType> result = SparseMdpEndComponentInformation<ValueType>::eliminateEndComponents(endComponentDecomposition, transitionMatrix, qualitativeStateSets.maybeStates, &qualitativeStateSets.statesWithProbability1, nullptr, nullptr, submatrix, &b, nullptr, produceScheduler);
+                if (doDecomposition && !endComponentDecomposition->empty()) {
+                    STORM_LOG_DEBUG("Eliminating " << endComponentDecomposition->size() << " EC(s).");
+                    SparseMdpEndComponentInformation<ValueType> result = SparseMdpEndComponentInformation<ValueType>::eliminateEndComponents(*endComponentDecomposition, transitionMatrix, qualitativeStateSets.maybeStates, &qualitativeStateSets.statesWithProbability1, nullptr, nullptr, submatrix, &b, nullptr, produceScheduler);
                     
                     // If the solve goal has relevant values, we need to adjust them.
                     if (goal.hasRelevantValues()) {
@@ -593,7 +647,11 @@ namespace storm {
                 
                 // We need to identify the maybe states (states which have a probability for satisfying the until formula
                 // that is strictly between 0 and 1) and the states that satisfy the formula with probablity 1 and 0, respectively.
-                QualitativeStateSetsUntilProbabilities qualitativeStateSets = getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint);
+                QualitativeStateSetsUntilProbabilities qualitativeStateSets;
+                {
+                    storm::utility::PerformanceCounters::Scope scope(env.getPerformanceCounters(), "precomputation");
+                    qualitativeStateSets = getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint);
+                }
                 
                 STORM_LOG_INFO("Preprocessing: " << qualitativeStateSets.statesWithProbability1.getNumberOfSetBits() << " states with probability 1, " << qualitativeStateSets.statesWithProbability0.getNumberOfSetBits() << " with probability 0 (" << qualitativeStateSets.maybeStates.getNumberOfSetBits() << " states remaining).");
                 
@@ -627,14 +685,14 @@ namespace storm {
                         // If the hint information tells us that we have to eliminate MECs, we do so now.
                         boost::optional<SparseMdpEndComponentInformation<ValueType>> ecInformation;
                         if (hintInformation.getEliminateEndComponents()) {
-                            ecInformation = computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(goal, transitionMatrix, backwardTransitions, qualitativeStateSets, submatrix, b, produceScheduler);
+                            ecInformation = computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(goal, transitionMatrix, backwardTransitions, qualitativeStateSets, submatrix, b, produceScheduler, getSolverSession<ValueType>(hint));
                         } else {
                             // Otherwise, we compute the standard equations.
                             computeFixedPointSystemUntilProbabilities(goal, transitionMatrix, qualitativeStateSets, submatrix, b);
                         }
                         
                         // Now compute the results for the maybe states.
-                        MaybeStateResult<ValueType> resultForMaybeStates = computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation);
+                        MaybeStateResult<ValueType> resultForMaybeStates = computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation, getSolverSession<ValueType>(hint));
                         
                         // If we eliminated end components, we need to extract the result differently.
                         if (ecInformation && ecInformation.get().getEliminatedEndComponents()) {
@@ -992,7 +1050,7 @@ namespace storm {
             }
             
             template<typename ValueType>
-            boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSystemReachabilityRewardsEliminateEndComponents(storm::solver::SolveGoal<ValueType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, QualitativeStateSetsReachabilityRewards const& qualitativeStateSets, boost::optional<storm::storage::BitVector> const& selectedChoices, std::function<std::vector<ValueType>(uint_fast64_t, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&)> const& totalStateRewardVectorGetter, storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b, boost::optional<std::vector<ValueType>>& oneStepTargetProbabilities, bool produceScheduler) {
+            boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSystemReachabilityRewardsEliminateEndComponents(storm::solver::SolveGoal<ValueType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, QualitativeStateSetsReachabilityRewards const& qualitativeStateSets, boost::optional<storm::storage::BitVector> const& selectedChoices, std::function<std::vector<ValueType>(uint_fast64_t, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&)> const& totalStateRewardVectorGetter, storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b, boost::optional<std::vector<ValueType>>& oneStepTargetProbabilities, bool produceScheduler, SparseMdpSolverSession<ValueType>* session = nullptr) {
                 
                 // Start by computing the choices with reward 0, as we only want ECs within this fragment.
                 storm::storage::BitVector zeroRewardChoices(transitionMatrix.getRowCount());
@@ -1030,16 +1088,21 @@ namespace storm {
                 
                 bool doDecomposition = !candidateStates.empty();
                 
-                storm::storage::MaximalEndComponentDecomposition<ValueType> endComponentDecomposition;
+                storm::storage::MaximalEndComponentDecomposition<ValueType> localEndComponentDecomposition;
+                storm::storage::MaximalEndComponentDecomposition<ValueType> const* endComponentDecomposition = &localEndComponentDecomposition;
                 if (doDecomposition) {
                     // Then compute the states that are in MECs with zero reward.
-                    endComponentDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, candidateStates, zeroRewardChoices);
+                    if (session) {
+                        endComponentDecomposition = &session->getEndComponentDecomposition(transitionMatrix, backwardTransitions, candidateStates, &zeroRewardChoices);
+                    } else {
+                        localEndComponentDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, candidateStates, zeroRewardChoices);
+                    }
                 }
                 
                 // Only do more work if there are actually end-components.
-                if (doDecomposition && !endComponentDecomposition.empty()) {
-                    STORM_LOG_DEBUG("Eliminating " << endComponentDecomposition.size() << " ECs.");
-                    SparseMdpEndComponentInformation<ValueType> result = SparseMdpEndComponentInformation<ValueType>::eliminateEndComponents(endComponentDecomposition, transitionMatrix, qualitativeStateSets.maybeStates, oneStepTargetProbabilities ? &qualitativeStateSets.rewardZeroStates : nullptr, selectedChoices ? &selectedChoices.get() : nullptr, &rewardVector, submatrix, oneStepTargetProbabilities ? &oneStepTargetProbabilities.get() : nullptr, &b, produceScheduler);
+                if (doDecomposition && !endComponentDecomposition->empty()) {
+                    STORM_LOG_DEBUG("Eliminating " << endComponentDecomposition->size() << " ECs.");
+                    SparseMdpEndComponentInformation<ValueType> result = SparseMdpEndComponentInformation<ValueType>::eliminateEndComponents(*endComponentDecomposition, transitionMatrix, qualitativeStateSets.maybeStates, oneStepTargetProbabilities ? &qualitativeStateSets.rewardZeroStates : nullptr, selectedChoices ? &selectedChoices.get() : nullptr, &rewardVector, submatrix, oneStepTargetProbabilities ? &oneStepTargetProbabilities.get() : nullptr, &b, produceScheduler);
                     
                     // If the solve goal has relevant values, we need to adjust them.
                     if (goal.hasRelevantValues()) {
@@ -1082,7 +1145,11 @@ namespace storm {
                 std::vector<ValueType> result(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
                 
                 // Determine which states have a reward that is infinity or less than infinity.
-                QualitativeStateSetsReachabilityRewards qualitativeStateSets = getQualitativeStateSetsReachabilityRewards(goal, transitionMatrix, backwardTransitions, targetStates, hint, zeroRewardStatesGetter, zeroRewardChoicesGetter);
+                QualitativeStateSetsReachabilityRewards qualitativeStateSets;
+                {
+                    storm::utility::PerformanceCounters::Scope scope(env.getPerformanceCounters(), "precomputation");
+                    qualitativeStateSets = getQualitativeStateSetsReachabilityRewards(goal, transitionMatrix, backwardTransitions, targetStates, hint, zeroRewardStatesGetter, zeroRewardChoicesGetter);
+                }
                 
                 STORM_LOG_INFO("Preprocessing: " << qualitativeStateSets.infinityStates.getNumberOfSetBits() << " states with reward infinity, " << qualitativeStateSets.rewardZeroStates.getNumberOfSetBits() << " states with reward zero (" << qualitativeStateSets.maybeStates.getNumberOfSetBits() << " states remaining).");
 
@@ -1130,7 +1197,7 @@ namespace storm {
                         // If the hint information tells us that we have to eliminate MECs, we do so now.
                         boost::optional<SparseMdpEndComponentInformation<ValueType>> ecInformation;
                         if (hintInformation.getEliminateEndComponents()) {
-                            ecInformation = computeFixedPointSystemReachabilityRewardsEliminateEndComponents(goal, transitionMatrix, backwardTransitions, qualitativeStateSets, selectedChoices, totalStateRewardVectorGetter, submatrix, b, oneStepTargetProbabilities, produceScheduler);
+                            ecInformation = computeFixedPointSystemReachabilityRewardsEliminateEndComponents(goal, transitionMatrix, backwardTransitions, qualitativeStateSets, selectedChoices, totalStateRewardVectorGetter, submatrix, b, oneStepTargetProbabilities, produceScheduler, getSolverSession<ValueType>(hint));
                         } else {
                             // Otherwise, we compute the standard equations.
                             computeFixedPointSystemReachabilityRewards(goal, transitionMatrix, qualitativeStateSets, selectedChoices, totalStateRewardVectorGetter, submatrix, b, oneStepTargetProbabilities ? &oneStepTargetProbabilities.get() : nullptr);
@@ -1143,7 +1210,7 @@ namespace storm {
                         }
                         
                         // Now compute the results for the maybe states.
-                        MaybeStateResult<ValueType> resultForMaybeStates = computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation);
+                        MaybeStateResult<ValueType> resultForMaybeStates = computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation, getSolverSession<ValueType>(hint));
 
                         // If we eliminated end components, we need to extract the result differently.
                         if (ecInformation && ecInformation.get().getEliminatedEndComponents()) {
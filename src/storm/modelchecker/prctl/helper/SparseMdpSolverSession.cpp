@@ -0,0 +1,97 @@
+#include "storm/modelchecker/prctl/helper/SparseMdpSolverSession.h"
+
+#include <algorithm>
+
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+
+            template<typename ValueType>
+            SparseMdpSolverSession<ValueType>::SparseMdpSolverSession(uint64_t maximalNumberOfEntries) : maximalNumberOfEntries(std::max<uint64_t>(maximalNumberOfEntries, 1)), numberOfReusedDecompositions(0), numberOfReusedEquationSystems(0) {
+                // Intentionally left empty.
+            }
+
+            template<typename ValueType>
+            storm::storage::MaximalEndComponentDecomposition<ValueType> const& SparseMdpSolverSession<ValueType>::getEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states, storm::storage::BitVector const* choices) {
+                for (auto entryIt = decompositions.begin(); entryIt != decompositions.end(); ++entryIt) {
+                    if (entryIt->transitionMatrix == &transitionMatrix && entryIt->numberOfEntries == transitionMatrix.getEntryCount() && entryIt->states == states && static_cast<bool>(entryIt->choices) == (choices != nullptr) && (!choices || entryIt->choices.get() == *choices)) {
+                        STORM_LOG_DEBUG("Reusing the end component decomposition of a previous query.");
+                        ++numberOfReusedDecompositions;
+                        decompositions.splice(decompositions.begin(), decompositions, entryIt);
+                        return decompositions.front().decomposition;
+                    }
+                }
+
+                DecompositionEntry entry;
+                entry.transitionMatrix = &transitionMatrix;
+                entry.numberOfEntries = transitionMatrix.getEntryCount();
+                entry.states = states;
+                if (choices) {
+                    entry.choices = *choices;
+                    entry.decomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, states, *choices);
+                } else {
+                    entry.decomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, states);
+                }
+                decompositions.push_front(std::move(entry));
+                if (decompositions.size() > maximalNumberOfEntries) {
+                    decompositions.pop_back();
+                }
+                return decompositions.front().decomposition;
+            }
+
+            template<typename ValueType>
+            typename SparseMdpSolverSession<ValueType>::EquationSystemData& SparseMdpSolverSession<ValueType>::getEquationSystemData(storm::storage::SparseMatrix<ValueType> const& matrix, storm::solver::MinMaxMethod const& method) {
+                std::size_t matrixHash = matrix.hash();
+                for (auto entryIt = equationSystems.begin(); entryIt != equationSystems.end(); ++entryIt) {
+                    if (entryIt->matrixHash == matrixHash && entryIt->method == method && entryIt->matrix == matrix) {
+                        STORM_LOG_DEBUG("Reusing the solver of a previous query.");
+                        ++numberOfReusedEquationSystems;
+                        equationSystems.splice(equationSystems.begin(), equationSystems, entryIt);
+                        return equationSystems.front().data;
+                    }
+                }
+
+                EquationSystemEntry entry;
+                entry.matrix = matrix;
+                entry.matrixHash = matrixHash;
+                entry.method = method;
+                equationSystems.push_front(std::move(entry));
+                if (equationSystems.size() > maximalNumberOfEntries) {
+                    equationSystems.pop_back();
+                }
+                return equationSystems.front().data;
+            }
+
+            template<typename ValueType>
+            void SparseMdpSolverSession<ValueType>::clear() {
+                decompositions.clear();
+                equationSystems.clear();
+            }
+
+            template<typename ValueType>
+            uint64_t SparseMdpSolverSession<ValueType>::getNumberOfReusedDecompositions() const {
+                return numberOfReusedDecompositions;
+            }
+
+            template<typename ValueType>
+            uint64_t SparseMdpSolverSession<ValueType>::getNumberOfReusedEquationSystems() const {
+                return numberOfReusedEquationSystems;
+            }
+
+            template class SparseMdpSolverSession<double>;
+
+#ifdef STORM_HAVE_CARL
+            template class SparseMdpSolverSession<storm::RationalNumber>;
+            template class SparseMdpSolverSession<storm::RationalFunction>;
+#endif
+
+        }
+    }
+}
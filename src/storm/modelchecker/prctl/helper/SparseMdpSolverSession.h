@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/SolverSelectionOptions.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+
+            /*!
+             * Keeps data between several queries on the same MDP, such that related queries (e.g. several reachability
+             * properties whose maybe states share their structure, or the same property with different bounds) do not
+             * start from scratch. The session keeps
+             *  - the end component decompositions computed for the elimination of end components,
+             *  - the solvers of the solved equation systems, including their caches (e.g. the multiplier or the SCC
+             *    decomposition of the topological solver), and
+             *  - the solution and the scheduler of the last solve of each equation system, which serve as the starting
+             *    point of the next solve of the same system (if this is sound).
+             * Equation systems are identified by their matrix (and the solution method), so the right-hand sides and the
+             * goals of the queries may differ. To this end, a copy of the matrix of each equation system is kept. To bound the memory consumption, only a limited number of entries is kept
+             * and the least recently used one is dropped first. A session belongs to a single model and must be cleared if
+             * that model is modified. It must not be used by several threads at once.
+             */
+            template<typename ValueType>
+            class SparseMdpSolverSession {
+            public:
+                /*!
+                 * The data that is kept for an equation system.
+                 */
+                struct EquationSystemData {
+                    // The solver (if the system was solved before).
+                    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver;
+
+                    // The solution and the scheduler of the previous solve (if available).
+                    boost::optional<std::vector<ValueType>> values;
+                    boost::optional<std::vector<uint64_t>> scheduler;
+                };
+
+                /*!
+                 * Creates an empty session.
+                 *
+                 * @param maximalNumberOfEntries The maximal number of decompositions and equation systems (each) that are kept.
+                 */
+                SparseMdpSolverSession(uint64_t maximalNumberOfEntries = 8);
+
+                /*!
+                 * Retrieves the maximal end component decomposition of the subsystem of the given model that is induced by
+                 * the given states (and choices). The decomposition is only computed if it is not already known.
+                 */
+                storm::storage::MaximalEndComponentDecomposition<ValueType> const& getEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states, storm::storage::BitVector const* choices = nullptr);
+
+                /*!
+                 * Retrieves the data of the equation system with the given matrix that is solved with the given method. If
+                 * the system is not known, empty data is created.
+                 */
+                EquationSystemData& getEquationSystemData(storm::storage::SparseMatrix<ValueType> const& matrix, storm::solver::MinMaxMethod const& method);
+
+                /*!
+                 * Drops all data of this session.
+                 */
+                void clear();
+
+                /*!
+                 * Retrieves how often a decomposition (or the data of an equation system) was found in this session.
+                 */
+                uint64_t getNumberOfReusedDecompositions() const;
+                uint64_t getNumberOfReusedEquationSystems() const;
+
+            private:
+                struct DecompositionEntry {
+                    // The identification of the decomposed subsystem.
+                    void const* transitionMatrix;
+                    uint64_t numberOfEntries;
+                    storm::storage::BitVector states;
+                    boost::optional<storm::storage::BitVector> choices;
+
+                    storm::storage::MaximalEndComponentDecomposition<ValueType> decomposition;
+                };
+
+                struct EquationSystemEntry {
+                    // The identification of the equation system. The hash only serves to quickly skip entries, a
+                    // system is only reused if its matrix is equal to the stored copy.
+                    storm::storage::SparseMatrix<ValueType> matrix;
+                    std::size_t matrixHash;
+                    storm::solver::MinMaxMethod method;
+
+                    EquationSystemData data;
+                };
+
+                // The maximal number of entries of each kind.
+                uint64_t maximalNumberOfEntries;
+
+                // The entries, the most recently used ones first.
+                std::list<DecompositionEntry> decompositions;
+                std::list<EquationSystemEntry> equationSystems;
+
+                uint64_t numberOfReusedDecompositions;
+                uint64_t numberOfReusedEquationSystems;
+            };
+
+        }
+    }
+}
@@ -15,6 +15,7 @@ namespace storm {
             class BuildSettings;
             class ModuleSettings;
             class AbstractionSettings;
+            class ModelCheckerSettings;
         }
         class Option;
         
@@ -319,6 +320,14 @@ namespace storm {
          */
         storm::settings::modules::AbstractionSettings& mutableAbstractionSettings();
         
+        /*!
+         * Retrieves the model checker settings in a mutable form. This is only meant to be used for debug purposes or
+         * very rare cases where it is necessary.
+         *
+         * @return An object that allows accessing and modifying the model checker settings.
+         */
+        storm::settings::modules::ModelCheckerSettings& mutableModelCheckerSettings();
+        
     } // namespace settings
 } // namespace storm
 
@@ -21,6 +21,7 @@ namespace storm {
             const std::string BisimulationSettings::reuseOptionName = "reuse";
             const std::string BisimulationSettings::initialPartitionOptionName = "init";
             const std::string BisimulationSettings::refinementModeOptionName = "refine";
+            const std::string BisimulationSettings::sparseRefinementModeOptionName = "sparserefine";
             const std::string BisimulationSettings::exactArithmeticDdOptionName = "ddexact";
             
             BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
@@ -54,6 +55,12 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(refinementModes))
                                              .setDefaultValueString("full").build())
                                 .build());
+                
+                std::vector<std::string> sparseRefinementModes = {"splitter", "signature"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, sparseRefinementModeOptionName, true, "Sets how the partition is refined in sparse bisimulation. 'splitter' refines with one splitter at a time, 'signature' refines all blocks in rounds based on state signatures (in parallel for floating-point models).").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(sparseRefinementModes))
+                                             .setDefaultValueString("splitter").build())
+                                .build());
             }
             
             bool BisimulationSettings::isStrongBisimulationSet() const {
@@ -135,6 +142,16 @@ namespace storm {
                 return RefinementMode::Full;
             }
 
+            BisimulationSettings::SparseRefinementMode BisimulationSettings::getSparseRefinementMode() const {
+                std::string sparseRefinementModeAsString = this->getOption(sparseRefinementModeOptionName).getArgumentByName("mode").getValueAsString();
+                if (sparseRefinementModeAsString == "splitter") {
+                    return SparseRefinementMode::Splitter;
+                } else if (sparseRefinementModeAsString == "signature") {
+                    return SparseRefinementMode::Signature;
+                }
+                return SparseRefinementMode::Splitter;
+            }
+
             bool BisimulationSettings::check() const {
                 bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet();
                 STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet() || !optionsSet, "Bisimulation minimization is not selected, so setting options for bisimulation has no effect.");
@@ -24,6 +24,8 @@ namespace storm {
                 
                 enum class RefinementMode { Full, ChangedStates };
                 
+                enum class SparseRefinementMode { Splitter, Signature };
+                
                 /*!
                  * Creates a new set of bisimulation settings.
                  */
@@ -95,6 +97,11 @@ namespace storm {
                  * Retrieves the refinement mode to use.
                  */
                 RefinementMode getRefinementMode() const;
+                
+                /*!
+                 * Retrieves how the partition is refined in sparse bisimulation.
+                 */
+                SparseRefinementMode getSparseRefinementMode() const;
                                 
                 virtual bool check() const override;
                 
@@ -111,6 +118,7 @@ namespace storm {
                 static const std::string reuseOptionName;
                 static const std::string initialPartitionOptionName;
                 static const std::string refinementModeOptionName;
+                static const std::string sparseRefinementModeOptionName;
                 static const std::string parallelismModeOptionName;
                 static const std::string exactArithmeticDdOptionName;
             };
@@ -21,6 +21,9 @@ namespace storm {
             const std::string explorationOrderOptionName = "explorder";
             const std::string explorationOrderOptionShortName = "eo";
             const std::string explorationChecksOptionName = "explchecks";
+            const std::string parallelExplorationOptionName = "parallel-exploration";
+            const std::string memoryBudgetOptionName = "memory-budget";
+            const std::string externalStorageDirectoryOptionName = "external-storage-dir";
             const std::string explorationChecksOptionShortName = "ec";
             const std::string prismCompatibilityOptionName = "prismcompat";
             const std::string prismCompatibilityOptionShortName = "pc";
@@ -53,6 +56,11 @@ namespace storm {
                 std::vector<std::string> explorationOrders = {"dfs", "bfs"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationOrderOptionName, false, "Sets which exploration order to use.").setShortName(explorationOrderOptionShortName).setIsAdvanced()
                                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the exploration order to choose.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(explorationOrders)).setDefaultValueString("bfs").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, parallelExplorationOptionName, false, "If set, the states of the explicit model are explored by multiple threads (see the core settings for the number of threads). Requires breadth-first exploration order.").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, memoryBudgetOptionName, false, "If set, the states and transitions of the explicit model that exceed the given memory budget are moved to temporary files during exploration. Requires breadth-first exploration order.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("mb", "The memory budget in megabytes.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, externalStorageDirectoryOptionName, false, "Sets the directory in which the temporary files for exploring with a memory budget are created.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "The directory.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationChecksOptionName, false, "If set, additional checks (if available) are performed during model exploration to debug the model.").setShortName(explorationChecksOptionShortName).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, buildOutOfBoundsStateOptionName, false, "If set, a state for out-of-bounds valuations is added").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, buildOverlappingGuardsLabelOptionName, false, "For states where multiple guards are enabled, we add a label (for debugging DTMCs)").setIsAdvanced().build());
@@ -127,6 +135,26 @@ namespace storm {
                 return this->getOption(explorationChecksOptionName).getHasOptionBeenSet();
             }
             
+            bool BuildSettings::isParallelExplorationSet() const {
+                return this->getOption(parallelExplorationOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isMemoryBudgetSet() const {
+                return this->getOption(memoryBudgetOptionName).getHasOptionBeenSet();
+            }
+
+            uint64_t BuildSettings::getMemoryBudget() const {
+                return this->getOption(memoryBudgetOptionName).getArgumentByName("mb").getValueAsUnsignedInteger();
+            }
+
+            bool BuildSettings::isExternalStorageDirectorySet() const {
+                return this->getOption(externalStorageDirectoryOptionName).getHasOptionBeenSet();
+            }
+
+            std::string BuildSettings::getExternalStorageDirectory() const {
+                return this->getOption(externalStorageDirectoryOptionName).getArgumentByName("directory").getValueAsString();
+            }
+
             bool BuildSettings::isNoSimplifySet() const {
                 return this->getOption(noSimplifyOptionName).getHasOptionBeenSet();
             }
@@ -38,6 +38,41 @@ namespace storm {
                  */
                 storm::builder::ExplorationOrder getExplorationOrder() const;
 
+                /*!
+                 * Retrieves whether the explicit state space is to be explored by multiple threads.
+                 *
+                 * @return True iff the state space is to be explored in parallel.
+                 */
+                bool isParallelExplorationSet() const;
+
+                /*!
+                 * Retrieves whether a memory budget for the exploration of the explicit state space was set.
+                 *
+                 * @return True iff a memory budget was set.
+                 */
+                bool isMemoryBudgetSet() const;
+
+                /*!
+                 * Retrieves the memory budget for the exploration of the explicit state space.
+                 *
+                 * @return The memory budget in megabytes.
+                 */
+                uint64_t getMemoryBudget() const;
+
+                /*!
+                 * Retrieves whether a directory for the temporary files of the exploration was set.
+                 *
+                 * @return True iff a directory was set.
+                 */
+                bool isExternalStorageDirectorySet() const;
+
+                /*!
+                 * Retrieves the directory for the temporary files of the exploration.
+                 *
+                 * @return The directory.
+                 */
+                std::string getExternalStorageDirectory() const;
+
                 /*!
                  * Retrieves whether the PRISM compatibility mode was enabled.
                  *
@@ -31,6 +31,7 @@ namespace storm {
             const std::string CoreSettings::cudaOptionName = "cuda";
             const std::string CoreSettings::intelTbbOptionName = "enable-tbb";
             const std::string CoreSettings::intelTbbOptionShortName = "tbb";
+            const std::string CoreSettings::threadCountOptionName = "threads";
             
             CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility::Engine::Sparse) {
                 std::vector<std::string> engines;
@@ -60,7 +61,9 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, statisticsOptionName, false, "Sets whether to display statistics if available.").setShortName(statisticsOptionShortName).build());
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, cudaOptionName, false, "Sets whether to use CUDA.").setIsAdvanced().build());
-                this->addOption(storm::settings::OptionBuilder(moduleName, intelTbbOptionName, false, "Sets whether to use Intel TBB (if Storm was built with support for TBB).").setShortName(intelTbbOptionShortName).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, intelTbbOptionName, false, "Sets whether to parallelize computations. Uses Intel TBB if Storm was built with support for TBB and a built-in thread pool otherwise.").setShortName(intelTbbOptionShortName).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, threadCountOptionName, false, "Sets the number of threads used for parallel computations.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means 'auto-detect').").setDefaultValueUnsignedInteger(0).build()).build());
             }
 
             storm::solver::EquationSolverType  CoreSettings::getEquationSolver() const {
@@ -136,6 +139,14 @@ namespace storm {
                 return this->getOption(intelTbbOptionName).getHasOptionBeenSet();
             }
 
+            bool CoreSettings::isThreadCountSet() const {
+                return this->getOption(threadCountOptionName).getHasOptionBeenSet();
+            }
+            
+            uint64_t CoreSettings::getThreadCount() const {
+                return this->getOption(threadCountOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+
             bool CoreSettings::isUseCudaSet() const {
                 return this->getOption(cudaOptionName).getHasOptionBeenSet();
             }
@@ -156,12 +167,11 @@ namespace storm {
             }
 
             bool CoreSettings::check() const {
-#ifdef STORM_HAVE_INTELTBB
-                return true;
-#else
-                STORM_LOG_WARN_COND(!isUseIntelTbbSet(), "Enabling TBB is not supported in this version of Storm as it was not built with support for it.");
-                return true;
+#ifndef STORM_HAVE_INTELTBB
+                STORM_LOG_INFO_COND(!isUseIntelTbbSet(), "Storm was built without support for Intel TBB, using the built-in thread pool for parallel computations.");
 #endif
+                STORM_LOG_WARN_COND(!isThreadCountSet() || isUseIntelTbbSet(), "The number of threads is only relevant if parallel computations are enabled (--" << intelTbbOptionName << ").");
+                return true;
             }
 
         } // namespace modules
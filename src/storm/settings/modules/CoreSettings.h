@@ -103,6 +103,20 @@ namespace storm {
                  */
                 bool isUseIntelTbbSet() const;
 
+                /*!
+                 * Retrieves whether the number of threads for parallel computations has been set.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isThreadCountSet() const;
+
+                /*!
+                 * Retrieves the number of threads for parallel computations (0 means 'auto-detect').
+                 *
+                 * @return The number of threads.
+                 */
+                uint64_t getThreadCount() const;
+
                 /*!
                  * Retrieves whether the option to use CUDA is set.
                  *
@@ -142,6 +156,7 @@ namespace storm {
                 static const std::string ddLibraryOptionName;
                 static const std::string intelTbbOptionName;
                 static const std::string intelTbbOptionShortName;
+                static const std::string threadCountOptionName;
                 static const std::string cudaOptionName;
             };
 
@@ -20,17 +20,21 @@ namespace storm {
             const std::string IOSettings::exportDotOptionName = "exportdot";
             const std::string IOSettings::exportDotMaxWidthOptionName = "dot-maxwidth";
             const std::string IOSettings::exportExplicitOptionName = "exportexplicit";
+            const std::string IOSettings::exportBinaryOptionName = "exportbinary";
             const std::string IOSettings::exportDdOptionName = "exportdd";
             const std::string IOSettings::exportJaniDotOptionName = "exportjanidot";
             const std::string IOSettings::exportCdfOptionName = "exportcdf";
             const std::string IOSettings::exportCdfOptionShortName = "cdf";
             const std::string IOSettings::exportSchedulerOptionName = "exportscheduler";
             const std::string IOSettings::exportCheckResultOptionName = "exportresult";
+            const std::string IOSettings::exportPerformanceCountersOptionName = "exportperformance";
             const std::string IOSettings::exportMonotonicityName = "exportmonotonicity";
             const std::string IOSettings::explicitOptionName = "explicit";
             const std::string IOSettings::explicitOptionShortName = "exp";
             const std::string IOSettings::explicitDrnOptionName = "explicit-drn";
             const std::string IOSettings::explicitDrnOptionShortName = "drn";
+            const std::string IOSettings::explicitBinaryOptionName = "explicit-binary";
+            const std::string IOSettings::explicitBinaryOptionShortName = "bin";
             const std::string IOSettings::explicitImcaOptionName = "explicit-imca";
             const std::string IOSettings::explicitImcaOptionShortName = "imca";
             const std::string IOSettings::prismInputOptionName = "prism";
@@ -66,10 +70,16 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportCdfOptionName, false, "Exports the cumulative density function for reward bounded properties into a .csv file.").setIsAdvanced().setShortName(exportCdfOptionShortName).addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "A path to an existing directory where the cdf files will be stored.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportSchedulerOptionName, false, "Exports the choices of an optimal scheduler to the given file (if supported by engine).").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file. Use file extension '.json' to export in json.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportCheckResultOptionName, false, "Exports the result to a given file (if supported by engine). The export will be in json.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file.").build()).build());
+                std::vector<std::string> performanceCountersFormats = {"json", "chrome"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, exportPerformanceCountersOptionName, false, "Collects timers, counters (e.g. solver iterations) and memory high-water marks of the computation and exports them to the given file.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file.").build())
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("format", "The format of the export. 'chrome' yields a trace that can be opened with chrome://tracing.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(performanceCountersFormats)).setDefaultValueString("json").makeOptional().build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportMonotonicityName, false, "Exports the result of monotonicity checking to the given file.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportExplicitOptionName, "", "If given, the loaded model will be written to the specified file in the drn format.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "the name of the file to which the model is to be writen.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName,  preventDRNPlaceholderOptionName, true, "If given, the exported DRN contains no placeholders").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, exportBinaryOptionName, false, "If given, the loaded model will be written to the specified file in a binary format that can be loaded without parsing.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to which the model is to be written.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportDdOptionName, "", "If given, the loaded model will be written to the specified file in the drdd format.")
                                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "the name of the file to which the model is to be writen.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, explicitOptionName, false, "Parses the model given in an explicit (sparse) representation.").setShortName(explicitOptionShortName)
@@ -78,6 +88,9 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, explicitDrnOptionName, false, "Parses the model given in the DRN format.").setShortName(explicitDrnOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("drn filename", "The name of the DRN file containing the model.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build())
                                 .build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, explicitBinaryOptionName, false, "Loads the model given in the binary format (as written by --" + exportBinaryOptionName + ").").setShortName(explicitBinaryOptionShortName)
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file containing the model.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build())
+                                .build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, explicitImcaOptionName, false, "Parses the model given in the IMCA format.").setShortName(explicitImcaOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("imca filename", "The name of the imca file containing the model.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build())
                                 .build());
@@ -188,6 +201,23 @@ namespace storm {
                 return this->getOption(exportCheckResultOptionName).getArgumentByName("filename").getValueAsString();
             }
 
+            bool IOSettings::isExportPerformanceCountersSet() const {
+                return this->getOption(exportPerformanceCountersOptionName).getHasOptionBeenSet();
+            }
+
+            std::string IOSettings::getExportPerformanceCountersFilename() const {
+                return this->getOption(exportPerformanceCountersOptionName).getArgumentByName("filename").getValueAsString();
+            }
+
+            storm::utility::PerformanceCounters::ExportFormat IOSettings::getExportPerformanceCountersFormat() const {
+                std::string format = this->getOption(exportPerformanceCountersOptionName).getArgumentByName("format").getValueAsString();
+                if (format == "chrome") {
+                    return storm::utility::PerformanceCounters::ExportFormat::ChromeTrace;
+                }
+                STORM_LOG_ASSERT(format == "json", "Unknown export format '" << format << "'.");
+                return storm::utility::PerformanceCounters::ExportFormat::Json;
+            }
+
             bool IOSettings::isExportMonotonicitySet() const {
                 return this->getOption(exportMonotonicityName).getHasOptionBeenSet();
             }
@@ -208,6 +238,22 @@ namespace storm {
                 return this->getOption(explicitOptionName).getArgumentByName("labeling filename").getValueAsString();
             }
 
+            bool IOSettings::isExportBinarySet() const {
+                return this->getOption(exportBinaryOptionName).getHasOptionBeenSet();
+            }
+
+            std::string IOSettings::getExportBinaryFilename() const {
+                return this->getOption(exportBinaryOptionName).getArgumentByName("filename").getValueAsString();
+            }
+
+            bool IOSettings::isExplicitBinarySet() const {
+                return this->getOption(explicitBinaryOptionName).getHasOptionBeenSet();
+            }
+
+            std::string IOSettings::getExplicitBinaryFilename() const {
+                return this->getOption(explicitBinaryOptionName).getArgumentByName("filename").getValueAsString();
+            }
+
             bool IOSettings::isExplicitDRNSet() const {
                 return this->getOption(explicitDrnOptionName).getHasOptionBeenSet();
             }
@@ -360,6 +406,7 @@ namespace storm {
                 // Ensure that not two explicit input models were given.
                 uint64_t numExplicitInputs = isExplicitSet() ? 1 : 0;
                 numExplicitInputs += isExplicitDRNSet() ? 1 : 0;
+                numExplicitInputs += isExplicitBinarySet() ? 1 : 0;
                 numExplicitInputs += isExplicitIMCASet() ? 1 : 0;
                 STORM_LOG_THROW(numExplicitInputs <= 1, storm::exceptions::InvalidSettingsException, "Multiple explicit input models");
 
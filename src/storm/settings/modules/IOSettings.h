@@ -7,6 +7,7 @@
 #include "storm/settings/modules/ModuleSettings.h"
 
 #include "storm/builder/ExplorationOrder.h"
+#include "storm/utility/PerformanceCounters.h"
 
 namespace storm {
     namespace settings {
@@ -116,6 +117,21 @@ namespace storm {
                  */
                  std::string getExportCheckResultFilename() const;
 
+                /*!
+                 * Retrieves whether the collected performance counters should be exported.
+                 */
+                bool isExportPerformanceCountersSet() const;
+
+                /*!
+                 * Retrieves a filename to which the collected performance counters should be exported.
+                 */
+                std::string getExportPerformanceCountersFilename() const;
+
+                /*!
+                 * Retrieves the format in which the collected performance counters should be exported.
+                 */
+                storm::utility::PerformanceCounters::ExportFormat getExportPerformanceCountersFormat() const;
+
                 /*!
                 * Retrieves whether an optimal scheduler is to be exported
                 */
@@ -149,6 +165,34 @@ namespace storm {
                  */
                 std::string getLabelingFilename() const;
 
+                /*!
+                 * Retrieves whether the model is to be exported in the binary format.
+                 *
+                 * @return True if the model is to be exported in the binary format.
+                 */
+                bool isExportBinarySet() const;
+
+                /*!
+                 * Retrieves the name of the file to which the model is to be exported in the binary format.
+                 *
+                 * @return The name of the file to which the model is to be exported in the binary format.
+                 */
+                std::string getExportBinaryFilename() const;
+
+                /*!
+                 * Retrieves whether the explicit option with the binary format was set.
+                 *
+                 * @return True if the explicit option with the binary format was set.
+                 */
+                bool isExplicitBinarySet() const;
+
+                /*!
+                 * Retrieves the name of the file that contains the model in the binary format.
+                 *
+                 * @return The name of the file that contains the model in the binary format.
+                 */
+                std::string getExplicitBinaryFilename() const;
+
                 /*!
                  * Retrieves whether the explicit option with DRN was set.
                  *
@@ -371,16 +415,20 @@ namespace storm {
                 static const std::string exportDotMaxWidthOptionName;
                 static const std::string exportJaniDotOptionName;
                 static const std::string exportExplicitOptionName;
+                static const std::string exportBinaryOptionName;
                 static const std::string exportDdOptionName;
                 static const std::string exportCdfOptionName;
                 static const std::string exportCdfOptionShortName;
                 static const std::string exportSchedulerOptionName;
                 static const std::string exportCheckResultOptionName;
+                static const std::string exportPerformanceCountersOptionName;
                 static const std::string exportMonotonicityName;
                 static const std::string explicitOptionName;
                 static const std::string explicitOptionShortName;
                 static const std::string explicitDrnOptionName;
                 static const std::string explicitDrnOptionShortName;
+                static const std::string explicitBinaryOptionName;
+                static const std::string explicitBinaryOptionShortName;
                 static const std::string explicitImcaOptionName;
                 static const std::string explicitImcaOptionShortName;
                 static const std::string prismInputOptionName;
@@ -32,6 +32,9 @@ namespace storm {
                 
                 uint64_t getOptimizationLevel() const;
                 
+                bool isCacheDirectorySet() const;
+                std::string getCacheDirectory() const;
+                
                 bool check() const override;
                 void finalize() override;
                 
@@ -45,6 +48,7 @@ namespace storm {
                 static const std::string compilerFlagsOptionName;
                 static const std::string doctorOptionName;
                 static const std::string optimizationLevelOptionName;
+                static const std::string cacheDirectoryOptionName;
             };
             
         }
@@ -95,6 +95,11 @@ namespace storm {
                  */
                 bool isForceIntervalIterationSymmetricUpdatesSet() const;
                 
+                /*!
+                 * Retrieves whether (interval) value iteration is supposed to iterate in single precision first.
+                 */
+                bool isMixedPrecisionSet() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -106,6 +111,7 @@ namespace storm {
                 static const std::string absoluteOptionName;
                 static const std::string valueIterationMultiplicationStyleOptionName;
                 static const std::string intervalIterationSymmetricUpdatesOptionName;
+                static const std::string mixedPrecisionOptionName;
                 static const std::string forceBoundsOptionName;
             };
             
@@ -14,15 +14,31 @@ namespace storm {
             
             const std::string ModelCheckerSettings::moduleName = "modelchecker";
             const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
+            const std::string ModelCheckerSettings::frontierSearchOptionName = "frontiersearch";
+            const std::string ModelCheckerSettings::reuseSolverOptionName = "reusesolver";
 
             ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false, "If set, states with reward zero are filtered out, potentially reducing the size of the equation system").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, frontierSearchOptionName, false, "If set, the qualitative analyses on sparse models search the state space level by level, which is done in parallel if parallel computations are enabled.").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, reuseSolverOptionName, false, "If set, decompositions, solvers and solutions are kept between the properties checked on the same MDP (sparse engine only). Related properties then start from the results of previous ones.").setIsAdvanced().build());
             }
             
             bool ModelCheckerSettings::isFilterRewZeroSet() const {
                 return this->getOption(filterRewZeroOptionName).getHasOptionBeenSet();
             }
             
+            bool ModelCheckerSettings::isFrontierSearchSet() const {
+                return this->getOption(frontierSearchOptionName).getHasOptionBeenSet();
+            }
+            
+            std::unique_ptr<storm::settings::SettingMemento> ModelCheckerSettings::overrideFrontierSearchSet(bool stateToSet) {
+                return this->overrideOption(frontierSearchOptionName, stateToSet);
+            }
+            
+            bool ModelCheckerSettings::isReuseSolverSet() const {
+                return this->getOption(reuseSolverOptionName).getHasOptionBeenSet();
+            }
+            
         } // namespace modules
     } // namespace settings
 } // namespace storm
@@ -21,6 +21,27 @@ namespace storm {
                 ModelCheckerSettings();
                 
                 bool isFilterRewZeroSet() const;
+                
+                /*!
+                 * Retrieves whether the qualitative analyses (e.g. computing the states with probability zero or one)
+                 * on sparse models search the state space level by level (possibly in parallel) instead of depth-first.
+                 */
+                bool isFrontierSearchSet() const;
+                
+                /*!
+                 * Overrides the option to use the frontier search by setting it to the specified value. As soon as the
+                 * returned memento goes out of scope, the original value is restored.
+                 *
+                 * @param stateToSet The value that is to be set for the frontier search option.
+                 * @return The memento that will eventually restore the original value.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideFrontierSearchSet(bool stateToSet);
+                
+                /*!
+                 * Retrieves whether the data computed while solving the equation systems for an MDP (decompositions,
+                 * solvers and solutions) is kept and reused by the subsequent properties checked on the same MDP.
+                 */
+                bool isReuseSolverSet() const;
 
                 // The name of the module.
                 static const std::string moduleName;
@@ -28,6 +49,8 @@ namespace storm {
             private:
                 // Define the string names of the options as constants.
                 static const std::string filterRewZeroOptionName;
+                static const std::string frontierSearchOptionName;
+                static const std::string reuseSolverOptionName;
             };
 
         } // namespace modules
@@ -16,6 +16,7 @@ namespace storm {
             const std::string MultiObjectiveSettings::exportPlotOptionName = "exportplot";
             const std::string MultiObjectiveSettings::precisionOptionName = "precision";
             const std::string MultiObjectiveSettings::maxStepsOptionName = "maxsteps";
+            const std::string MultiObjectiveSettings::parallelRefinementStepsOptionName = "parallelsteps";
             const std::string MultiObjectiveSettings::schedulerRestrictionOptionName = "purescheds";
             const std::string MultiObjectiveSettings::printResultsOptionName = "printres";
             const std::string MultiObjectiveSettings::encodingOptionName = "encoding";
@@ -31,6 +32,8 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("type", "The type of precision.").setDefaultValueString("abs").makeOptional().addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(precTypes)).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, maxStepsOptionName, true, "Aborts the computation after the given number of refinement steps (= computed pareto optimal points).").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "the threshold for the number of refinement steps to be performed.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, parallelRefinementStepsOptionName, true, "Sets the number of refinement steps (= weight vectors) that are performed concurrently when approximating Pareto curves. Each concurrent step works on its own copy of the preprocessed model.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of concurrent refinement steps.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
                 std::vector<std::string> memoryPatterns = {"positional", "goalmemory", "arbitrary", "counter"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, schedulerRestrictionOptionName, false, "Restricts the class of considered schedulers to non-randomized schedulers with the provided memory pattern.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("memorypattern", "The pattern of the memory.").setDefaultValueString("positional").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(memoryPatterns)).makeOptional().build())
@@ -83,6 +86,10 @@ namespace storm {
                 return this->getOption(maxStepsOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
             }
             
+            uint_fast64_t MultiObjectiveSettings::getNumberOfParallelRefinementSteps() const {
+                return this->getOption(parallelRefinementStepsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
             bool MultiObjectiveSettings::hasSchedulerRestriction() const {
                 return this->getOption(schedulerRestrictionOptionName).getHasOptionBeenSet();
             }
@@ -68,6 +68,11 @@ namespace storm {
                  */
                 uint_fast64_t getMaxSteps() const;
                 
+                /*!
+                 * Retrieves the number of weight vectors that are checked concurrently when approximating Pareto curves.
+                 */
+                uint_fast64_t getNumberOfParallelRefinementSteps() const;
+                
 				/*!
 				 * Retrieves whether a scheduler restriction has been set.
 				 */
@@ -114,6 +119,7 @@ namespace storm {
 				const static std::string exportPlotOptionName;
 				const static std::string precisionOptionName;
 				const static std::string maxStepsOptionName;
+				const static std::string parallelRefinementStepsOptionName;
 				const static std::string schedulerRestrictionOptionName;
 				const static std::string printResultsOptionName;
 				const static std::string encodingOptionName;
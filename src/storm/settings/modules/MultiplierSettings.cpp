@@ -13,12 +13,16 @@ namespace storm {
             
             const std::string MultiplierSettings::moduleName = "multiplier";
             const std::string MultiplierSettings::multiplierTypeOptionName = "type";
+            const std::string MultiplierSettings::structureOfArraysOptionName = "soa";
+            const std::string MultiplierSettings::compressedMatrixOptionName = "compressed";
 
             MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> multiplierTypes = {"native", "gmmxx"};
+                std::vector<std::string> multiplierTypes = {"native", "gmmxx", "simd"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, multiplierTypeOptionName, true, "Sets which type of multiplier is preferred.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplier.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(multiplierTypes)).setDefaultValueString("gmmxx").build()).build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, structureOfArraysOptionName, true, "If set, the native multiplier stores column indices (32 bit if possible) and values of the matrix in separate arrays.").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, compressedMatrixOptionName, true, "If set, the native multiplier stores the column indices of the matrix with variable-length delta encoding and the values in a dictionary (if there are few distinct values).").setIsAdvanced().build());
             }
             
             storm::solver::MultiplierType MultiplierSettings::getMultiplierType() const {
@@ -27,6 +31,8 @@ namespace storm {
                     return storm::solver::MultiplierType::Native;
                 } else if (type == "gmmxx") {
                     return storm::solver::MultiplierType::Gmmxx;
+                } else if (type == "simd") {
+                    return storm::solver::MultiplierType::Simd;
                 }
                 
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown multiplier type '" << type << "'.");
@@ -35,6 +41,14 @@ namespace storm {
             bool MultiplierSettings::isMultiplierTypeSetFromDefaultValue() const {
                 return !this->getOption(multiplierTypeOptionName).getArgumentByName("name").getHasBeenSet() || this->getOption(multiplierTypeOptionName).getArgumentByName("name").wasSetFromDefaultValue();
             }
+            
+            bool MultiplierSettings::isStructureOfArraysSet() const {
+                return this->getOption(structureOfArraysOptionName).getHasOptionBeenSet();
+            }
+            
+            bool MultiplierSettings::isCompressedMatrixSet() const {
+                return this->getOption(compressedMatrixOptionName).getHasOptionBeenSet();
+            }
         }
     }
 }
@@ -22,11 +22,23 @@ namespace storm {
                 
                 bool isMultiplierTypeSetFromDefaultValue() const;
                 
+                /*!
+                 * Retrieves whether the native multiplier is to use a structure-of-arrays representation of the matrix.
+                 */
+                bool isStructureOfArraysSet() const;
+                
+                /*!
+                 * Retrieves whether the native multiplier is to use a compressed representation of the matrix.
+                 */
+                bool isCompressedMatrixSet() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
             private:
                 static const std::string multiplierTypeOptionName;
+                static const std::string structureOfArraysOptionName;
+                static const std::string compressedMatrixOptionName;
             };
             
         }
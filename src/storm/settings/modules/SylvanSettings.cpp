@@ -6,6 +6,7 @@
 #include "storm/settings/OptionBuilder.h"
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/Argument.h"
+#include "storm/settings/ArgumentValidators.h"
 
 namespace storm {
     namespace settings {
@@ -14,10 +15,15 @@ namespace storm {
             const std::string SylvanSettings::moduleName = "sylvan";
             const std::string SylvanSettings::maximalMemoryOptionName = "maxmem";
             const std::string SylvanSettings::threadCountOptionName = "threads";
+            const std::string SylvanSettings::workerPinningOptionName = "pin";
+            const std::string SylvanSettings::workerStatisticsOptionName = "workerstats";
             
             SylvanSettings::SylvanSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalMemoryOptionName, true, "Sets the upper bound of memory available to Sylvan in MB.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The memory available to Sylvan.").setDefaultValueUnsignedInteger(4096).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, threadCountOptionName, true, "Sets the number of threads used by Sylvan.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The number of threads available to Sylvan (0 means 'auto-detect').").build()).build());
+                std::vector<std::string> pinnings = {"none", "compact", "scatter"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, workerPinningOptionName, true, "Sets how the Sylvan workers are pinned to CPUs. The thread that starts Sylvan is not pinned.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The pinning to use. 'compact' fills one NUMA node after the other, 'scatter' distributes the workers over all NUMA nodes.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(pinnings)).setDefaultValueString("none").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, workerStatisticsOptionName, true, "If set, statistics about the individual Sylvan workers (CPU, NUMA node and memory) are shown when Sylvan is shut down.").setIsAdvanced().build());
             }
             
             uint_fast64_t SylvanSettings::getMaximalMemory() const {
@@ -32,6 +38,20 @@ namespace storm {
                 return this->getOption(threadCountOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
             }
             
+            SylvanSettings::WorkerPinning SylvanSettings::getWorkerPinning() const {
+                std::string pinningAsString = this->getOption(workerPinningOptionName).getArgumentByName("mode").getValueAsString();
+                if (pinningAsString == "compact") {
+                    return WorkerPinning::Compact;
+                } else if (pinningAsString == "scatter") {
+                    return WorkerPinning::Scatter;
+                }
+                return WorkerPinning::None;
+            }
+            
+            bool SylvanSettings::isShowWorkerStatisticsSet() const {
+                return this->getOption(workerStatisticsOptionName).getHasOptionBeenSet();
+            }
+            
         } // namespace modules
     } // namespace settings
 } // namespace storm
@@ -12,6 +12,9 @@ namespace storm {
              */
             class SylvanSettings : public ModuleSettings {
             public:
+                // The ways in which the Sylvan workers can be pinned to CPUs.
+                enum class WorkerPinning { None, Compact, Scatter };
+                
                 /*!
                  * Creates a new set of Sylvan settings.
                  */
@@ -37,6 +40,20 @@ namespace storm {
                  */
                 bool isNumberOfThreadsSet() const;
                 
+                /*!
+                 * Retrieves how the Sylvan workers are pinned to CPUs. 'Compact' fills the CPUs of one NUMA node before
+                 * moving on to the next one, 'Scatter' distributes the workers over the NUMA nodes in a round-robin
+                 * fashion.
+                 *
+                 * @return The worker pinning.
+                 */
+                WorkerPinning getWorkerPinning() const;
+                
+                /*!
+                 * Retrieves whether statistics about the individual Sylvan workers are to be shown.
+                 */
+                bool isShowWorkerStatisticsSet() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -44,6 +61,8 @@ namespace storm {
                 // Define the string names of the options as constants.
                 static const std::string maximalMemoryOptionName;
                 static const std::string threadCountOptionName;
+                static const std::string workerPinningOptionName;
+                static const std::string workerStatisticsOptionName;
             };
             
         } // namespace modules
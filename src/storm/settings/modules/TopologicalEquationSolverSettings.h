@@ -61,6 +61,13 @@ namespace storm {
                  */
                 storm::solver::MinMaxMethod getUnderlyingMinMaxMethod() const;
                 
+                /*!
+                 * Retrieves whether independent SCCs are to be solved in parallel.
+                 *
+                 * @return True iff the SCCs are to be solved in parallel.
+                 */
+                bool isParallelSet() const;
+                
                 bool check() const override;
                 
                 // The name of the module.
@@ -70,6 +77,7 @@ namespace storm {
                 // Define the string names of the options as constants.
                 static const std::string underlyingEquationSolverOptionName;
                 static const std::string underlyingMinMaxMethodOptionName;
+                static const std::string parallelOptionName;
             };
             
         } // namespace modules
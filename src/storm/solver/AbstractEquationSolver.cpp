@@ -5,10 +5,13 @@
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
+#include "storm/environment/Environment.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/PerformanceCounters.h"
+#include "storm/storage/SparseMatrix.h"
 #include "storm/utility/SignalHandler.h"
 
 
@@ -321,6 +324,18 @@ namespace storm {
         }
 
 
+        template<typename ValueType>
+        void AbstractEquationSolver<ValueType>::reportWork(Environment const& env, uint64_t iterations, uint64_t multiplications, storm::storage::SparseMatrix<ValueType> const& matrix) const {
+            storm::utility::PerformanceCounters* counters = env.getPerformanceCounters();
+            if (counters) {
+                // A multiplication reads all matrix entries, the row indications and the input vectors and writes the result.
+                uint64_t bytesPerMultiplication = matrix.getEntryCount() * sizeof(storm::storage::MatrixEntry<uint_fast64_t, ValueType>) + (matrix.getRowCount() + 1) * sizeof(uint_fast64_t) + (2 * matrix.getRowCount() + matrix.getColumnCount()) * sizeof(ValueType);
+                counters->addToCounter("iterations", iterations);
+                counters->addToCounter("multiplications", multiplications);
+                counters->addToCounter("streamed bytes", multiplications * bytesPerMultiplication);
+            }
+        }
+
         template<typename ValueType>
         SolverStatus AbstractEquationSolver<ValueType>::updateStatus(SolverStatus status, bool earlyTermination, uint64_t iterations, uint64_t maximalNumberOfIterations) const {
             if (status != SolverStatus::Converged) {
@@ -12,6 +12,14 @@
 
 
 namespace storm {
+    
+    class Environment;
+    
+    namespace storage {
+        template<typename ValueType>
+        class SparseMatrix;
+    }
+    
     namespace solver {
         
         template<typename ValueType>
@@ -201,6 +209,15 @@ namespace storm {
              */
             void reportStatus(SolverStatus status, boost::optional<uint64_t> const& iterations = boost::none) const;
 
+            /*!
+             * Reports the work of an iterative solver to the performance counters of the environment (if any).
+             * @param env The environment.
+             * @param iterations Number of iterations.
+             * @param multiplications Number of (matrix-vector) multiplications with the given matrix.
+             * @param matrix The matrix of the solved equation system (used to estimate the number of streamed bytes).
+             */
+            void reportWork(Environment const& env, uint64_t iterations, uint64_t multiplications, storm::storage::SparseMatrix<ValueType> const& matrix) const;
+
             /*!
              * Update the status of the solver with respect to convergence, early termination, abortion, etc.
              * @param status Current status.
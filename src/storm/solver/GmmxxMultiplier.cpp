@@ -2,12 +2,12 @@
 
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
-#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/exceptions/NotSupportedException.h"
 
 #include "storm/utility/macros.h"
@@ -30,16 +30,21 @@ namespace storm {
         template<typename ValueType>
         void GmmxxMultiplier<ValueType>::clearCache() const {
             gmmMatrix = gmm::csr_matrix<ValueType>();
+            parallelGaussSeidelHelper.reset();
             Multiplier<ValueType>::clearCache();
         }
         
         template<typename ValueType>
         bool GmmxxMultiplier<ValueType>::parallelize(Environment const& env) const {
-#ifdef STORM_HAVE_INTELTBB
             return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
-#else
-            return false;
-#endif
+        }
+        
+        template<typename ValueType>
+        storm::solver::helper::ParallelGaussSeidelHelper<ValueType> const& GmmxxMultiplier<ValueType>::getParallelGaussSeidelHelper() const {
+            if (!parallelGaussSeidelHelper) {
+                parallelGaussSeidelHelper = std::make_unique<storm::solver::helper::ParallelGaussSeidelHelper<ValueType>>(this->matrix);
+            }
+            return *parallelGaussSeidelHelper;
         }
         
         template<typename ValueType>
@@ -66,6 +71,10 @@ namespace storm {
         
         template<typename ValueType>
         void GmmxxMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const {
+            if (parallelize(env) && this->matrix.hasTrivialRowGrouping()) {
+                getParallelGaussSeidelHelper().multiplyGaussSeidel(x, b, backwards);
+                return;
+            }
             initialize();
             STORM_LOG_ASSERT(gmmMatrix.nr == gmmMatrix.nc, "Expecting square matrix.");
             if (backwards) {
@@ -107,10 +116,31 @@ namespace storm {
         
         template<typename ValueType>
         void GmmxxMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
+            if (parallelize(env) && &rowGroupIndices == &this->matrix.getRowGroupIndices()) {
+                getParallelGaussSeidelHelper().multiplyAndReduceGaussSeidel(dir, x, b, choices, backwards);
+                return;
+            }
             initialize();
             multAddReduceHelper(dir, rowGroupIndices, x, b, x, choices, backwards);
         }
         
+        template<typename ValueType>
+        void GmmxxMultiplier<ValueType>::multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x1, std::vector<ValueType>& result1, std::vector<ValueType> const& x2, std::vector<ValueType>& result2, std::vector<ValueType> const* b) const {
+            // Make sure that the rows are not converted concurrently.
+            initialize();
+            Multiplier<ValueType>::multiplyAndReduce2(env, dir, x1, result1, x2, result2, b);
+        }
+        
+        template<typename ValueType>
+        void GmmxxMultiplier<ValueType>::multiplyAndReduceGaussSeidel2(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x1, std::vector<ValueType>& x2, std::vector<ValueType> const* b, bool backwards) const {
+            if (parallelize(env)) {
+                getParallelGaussSeidelHelper().multiplyAndReduceGaussSeidel2(dir, x1, x2, b, backwards);
+                return;
+            }
+            initialize();
+            Multiplier<ValueType>::multiplyAndReduceGaussSeidel2(env, dir, x1, x2, b, backwards);
+        }
+        
         template<typename ValueType>
         void GmmxxMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
             initialize();
@@ -259,31 +289,27 @@ namespace storm {
         
         template<typename ValueType>
         void GmmxxMultiplier<ValueType>::multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
-#ifdef STORM_HAVE_INTELTBB
-            if (b) {
-                if (b == &result) {
-                    gmm::mult_add_parallel(gmmMatrix, x, result);
-                } else {
-                    gmm::mult_add_parallel(gmmMatrix, x, *b, result);
+            storm::utility::parallel::parallelFor(0, gmm::mat_nrows(gmmMatrix), 100, [&] (auto const& range) {
+                for (uint64_t row = range.begin(); row < range.end(); ++row) {
+                    ValueType value = vect_sp(gmm::mat_const_row(gmmMatrix, row), x, typename gmm::linalg_traits<gmm::csr_matrix<ValueType>>::storage_type(), typename gmm::linalg_traits<std::vector<ValueType>>::storage_type());
+                    if (b) {
+                        result[row] = (*b)[row] + value;
+                    } else {
+                        result[row] = value;
+                    }
                 }
-            } else {
-                gmm::mult_parallel(gmmMatrix, x, result);
-            }
-#else
-            STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-            multAdd(x, b, result);
-#endif
+            });
         }
         
-#ifdef STORM_HAVE_INTELTBB
         template<typename ValueType, typename Compare>
-        class TbbMultAddReduceFunctor {
+        class ParallelMultAddReduceFunctor {
         public:
-            TbbMultAddReduceFunctor(std::vector<uint64_t> const& rowGroupIndices, gmm::csr_matrix<ValueType> const& matrix, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices) : rowGroupIndices(rowGroupIndices), matrix(matrix), x(x), b(b), result(result), choices(choices) {
+            ParallelMultAddReduceFunctor(std::vector<uint64_t> const& rowGroupIndices, gmm::csr_matrix<ValueType> const& matrix, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices) : rowGroupIndices(rowGroupIndices), matrix(matrix), x(x), b(b), result(result), choices(choices) {
                 // Intentionally left empty.
             }
             
-            void operator()(tbb::blocked_range<unsigned long> const& range) const {
+            template<typename Range>
+            void operator()(Range const& range) const {
                 typedef std::vector<ValueType> VectorType;
                 typedef gmm::csr_matrix<ValueType> MatrixType;
 
@@ -359,20 +385,14 @@ namespace storm {
             std::vector<ValueType>& result;
             std::vector<uint64_t>* choices;
         };
-#endif
         
         template<typename ValueType>
         void GmmxxMultiplier<ValueType>::multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
-#ifdef STORM_HAVE_INTELTBB
             if (dir == storm::OptimizationDirection::Minimize) {
-                tbb::parallel_for(tbb::blocked_range<unsigned long>(0, rowGroupIndices.size() - 1, 100), TbbMultAddReduceFunctor<ValueType, storm::utility::ElementLess<ValueType>>(rowGroupIndices, this->gmmMatrix, x, b, result, choices));
+                storm::utility::parallel::parallelFor(0, rowGroupIndices.size() - 1, 100, ParallelMultAddReduceFunctor<ValueType, storm::utility::ElementLess<ValueType>>(rowGroupIndices, this->gmmMatrix, x, b, result, choices));
             } else {
-                tbb::parallel_for(tbb::blocked_range<unsigned long>(0, rowGroupIndices.size() - 1, 100), TbbMultAddReduceFunctor<ValueType, storm::utility::ElementGreater<ValueType>>(rowGroupIndices, this->gmmMatrix, x, b, result, choices));
+                storm::utility::parallel::parallelFor(0, rowGroupIndices.size() - 1, 100, ParallelMultAddReduceFunctor<ValueType, storm::utility::ElementGreater<ValueType>>(rowGroupIndices, this->gmmMatrix, x, b, result, choices));
             }
-#else
-            STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-            multAddReduceHelper(dir, rowGroupIndices, x, b, result, choices);
-#endif
         }
         
         template<>
@@ -3,6 +3,7 @@
 #include "storm/solver/Multiplier.h"
 
 #include "storm/adapters/GmmxxAdapter.h"
+#include "storm/solver/helper/ParallelGaussSeidelHelper.h"
 
 #include "storm-config.h"
 
@@ -25,6 +26,8 @@ namespace storm {
             virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
             virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const override;
             virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr, bool backwards = true) const override;
+            virtual void multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x1, std::vector<ValueType>& result1, std::vector<ValueType> const& x2, std::vector<ValueType>& result2, std::vector<ValueType> const* b) const override;
+            virtual void multiplyAndReduceGaussSeidel2(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x1, std::vector<ValueType>& x2, std::vector<ValueType> const* b, bool backwards = true) const override;
             virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
             virtual void clearCache() const override;
             
@@ -33,6 +36,11 @@ namespace storm {
             
             bool parallelize(Environment const& env) const;
             
+            /*!
+             * Retrieves the helper for parallel Gauss-Seidel sweeps (and creates it if necessary).
+             */
+            storm::solver::helper::ParallelGaussSeidelHelper<ValueType> const& getParallelGaussSeidelHelper() const;
+            
             void multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
             void multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
             void multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
@@ -42,6 +50,7 @@ namespace storm {
             void multAddReduceHelper(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
 
             mutable gmm::csr_matrix<ValueType> gmmMatrix;
+            mutable std::unique_ptr<storm::solver::helper::ParallelGaussSeidelHelper<ValueType>> parallelGaussSeidelHelper;
         };
         
     }
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include <limits>
 
@@ -10,8 +12,10 @@
 #include "storm/utility/KwekMehlhorn.h"
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/VectorHelper.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
@@ -91,6 +95,17 @@ namespace storm {
             return result;
         }
 
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::internalSolveEquationsBlock(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfVectors) const {
+            // Only plain value iteration processes all vectors at once. Initial schedulers and custom termination
+            // conditions refer to a single system, so in these cases the systems are solved one after another.
+            auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
+            if (method != MinMaxMethod::ValueIteration || numberOfVectors == 1 || this->hasInitialScheduler() || this->hasCustomTerminationCondition() || env.solver().minMax().isMixedPrecisionSet()) {
+                return MinMaxLinearEquationSolver<ValueType>::internalSolveEquationsBlock(env, dir, x, b, numberOfVectors);
+            }
+            return solveEquationsValueIterationBlock(env, dir, x, b, numberOfVectors);
+        }
+        
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::solveInducedEquationSystem(Environment const& env, std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver, std::vector<uint64_t> const& scheduler, std::vector<ValueType>& x, std::vector<ValueType>& subB, std::vector<ValueType> const& originalB) const {
             assert(subB.size() == x.size());
@@ -205,6 +220,7 @@ namespace storm {
             } while (status == SolverStatus::InProgress);
             
             this->reportStatus(status, iterations);
+            this->reportWork(env, iterations, iterations, *this->A);
             
             // If requested, we store the scheduler for retrieval.
             if (this->isTrackSchedulerSet()) {
@@ -335,6 +351,78 @@ namespace storm {
             
             return ValueIterationResult(iterations - currentIterations, status);
         }
+        
+        template<typename ValueType>
+        uint64_t IterativeMinMaxLinearEquationSolver<ValueType>::performSinglePrecisionValueIteration(Environment const&, OptimizationDirection, std::vector<ValueType>&, std::vector<ValueType> const&, SolverGuarantee const&, uint64_t) const {
+            STORM_LOG_WARN("Mixed precision value iteration is only supported for double precision values. Skipping the iterations in single precision.");
+            return 0;
+        }
+        
+        template<>
+        uint64_t IterativeMinMaxLinearEquationSolver<double>::performSinglePrecisionValueIteration(Environment const& env, OptimizationDirection dir, std::vector<double>& x, std::vector<double> const& b, SolverGuarantee const& guarantee, uint64_t maximalNumberOfIterations) const {
+            if (!singlePrecisionA) {
+                singlePrecisionA = std::make_unique<storm::storage::SparseMatrix<float>>(this->A->template toValueType<float>());
+            }
+            std::vector<uint64_t> const& rowGroupIndices = singlePrecisionA->getRowGroupIndices();
+            std::vector<float> currentX = storm::utility::vector::convertNumericVector<float>(x);
+            std::vector<float> newX(currentX.size());
+            std::vector<float> const singlePrecisionB = storm::utility::vector::convertNumericVector<float>(b);
+            
+            // Single precision only has about seven significant digits, so we leave the last digits to the iterations in double precision.
+            bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+            float precision = std::max(static_cast<float>(storm::utility::convertNumber<double>(env.solver().minMax().getPrecision())), 1e-5f);
+            bool useGaussSeidelMultiplication = env.solver().minMax().getMultiplicationStyle() == storm::solver::MultiplicationStyle::GaussSeidel;
+            
+            uint64_t iterations = 0;
+            bool converged = false;
+            while (!converged && iterations < maximalNumberOfIterations && !storm::utility::resources::isTerminate()) {
+                if (useGaussSeidelMultiplication) {
+                    newX = currentX;
+                    singlePrecisionA->multiplyAndReduceBackward(dir, rowGroupIndices, newX, &singlePrecisionB, newX, nullptr);
+                } else {
+                    singlePrecisionA->multiplyAndReduce(dir, rowGroupIndices, currentX, &singlePrecisionB, newX, nullptr);
+                }
+                converged = storm::utility::vector::equalModuloPrecision<float>(currentX, newX, precision, relative);
+                std::swap(currentX, newX);
+                ++iterations;
+                this->showProgressIterative(iterations);
+            }
+            STORM_LOG_INFO("Performed " << iterations << " iterations in single precision.");
+            
+            std::vector<double> candidate = storm::utility::vector::convertNumericVector<double>(currentX);
+            if (guarantee == SolverGuarantee::None) {
+                x = std::move(candidate);
+                return iterations;
+            }
+            
+            // The rounding errors of the single precision iterations may have pushed some values beyond the solution.
+            // We therefore move the values away from the solution (by the precision of the single precision iterations)
+            // and then check in double precision whether the guarantee holds.
+            bool lessOrEqual = guarantee == SolverGuarantee::LessOrEqual;
+            for (auto& value : candidate) {
+                double offset = relative ? precision * std::abs(value) : precision;
+                value = lessOrEqual ? value - offset : value + offset;
+            }
+            std::vector<double> bounds(candidate.size());
+            if (lessOrEqual && this->hasLowerBound()) {
+                this->createLowerBoundsVector(bounds);
+                storm::utility::vector::applyPointwise<double, double, double>(candidate, bounds, candidate, [] (double const& value, double const& bound) { return std::max(value, bound); });
+            } else if (!lessOrEqual && this->hasUpperBound()) {
+                this->createUpperBoundsVector(bounds);
+                storm::utility::vector::applyPointwise<double, double, double>(candidate, bounds, candidate, [] (double const& value, double const& bound) { return std::min(value, bound); });
+            }
+            
+            // A sub-solution (super-solution) stays below (above) the solution under further iterations.
+            std::vector<double>& image = bounds;
+            this->multiplierA->multiplyAndReduce(env, dir, candidate, &b, image);
+            bool keepsGuarantee = lessOrEqual ? storm::utility::vector::compareElementWise(candidate, image, std::less_equal<double>()) : storm::utility::vector::compareElementWise(candidate, image, std::greater_equal<double>());
+            if (keepsGuarantee) {
+                x = std::move(image);
+            } else {
+                STORM_LOG_INFO("Discarding the result of the iterations in single precision as it violates the solver guarantee.");
+            }
+            return iterations;
+        }
 
         template<typename ValueType>
         ValueType computeMaxAbsDiff(std::vector<ValueType> const& allValues, storm::storage::BitVector const& relevantValues, std::vector<ValueType> const& oldValues) {
@@ -347,15 +435,6 @@ namespace storm {
             return result;
         }
 
-        template<typename ValueType>
-        ValueType computeMaxAbsDiff(std::vector<ValueType> const& allOldValues, std::vector<ValueType> const& allNewValues, storm::storage::BitVector const& relevantValues) {
-            ValueType result = storm::utility::zero<ValueType>();
-            for (auto value : relevantValues) {
-                result = storm::utility::max<ValueType>(result, storm::utility::abs<ValueType>(allNewValues[value] - allOldValues[value]));
-            }
-            return result;
-        }
-
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsOptimisticValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
 
@@ -394,6 +473,7 @@ namespace storm {
             storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(*lowerX, *upperX, x, [&two] (ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
 
             this->reportStatus(statusIters.first, statusIters.second);
+            this->reportWork(env, statusIters.second, statusIters.second, *this->A);
 
             // If requested, we store the scheduler for retrieval.
             if (this->isTrackSchedulerSet()) {
@@ -471,7 +551,15 @@ namespace storm {
             std::vector<ValueType>* currentX = &x;
             
             this->startMeasureProgress();
-            ValueIterationResult result = performValueIteration(env, dir, currentX, newX, b, storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), env.solver().minMax().getRelativeTerminationCriterion(), guarantee, 0, env.solver().minMax().getMaximalNumberOfIterations(), env.solver().minMax().getMultiplicationStyle());
+            
+            // If requested, we do the bulk of the iterations in single precision.
+            uint64_t singlePrecisionIterations = 0;
+            if (env.solver().minMax().isMixedPrecisionSet()) {
+                singlePrecisionIterations = performSinglePrecisionValueIteration(env, dir, x, b, guarantee, env.solver().minMax().getMaximalNumberOfIterations());
+            }
+            
+            ValueIterationResult result = performValueIteration(env, dir, currentX, newX, b, storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), env.solver().minMax().getRelativeTerminationCriterion(), guarantee, singlePrecisionIterations, env.solver().minMax().getMaximalNumberOfIterations(), env.solver().minMax().getMultiplicationStyle());
+            result.iterations += singlePrecisionIterations;
 
             // Swap the result into the output x.
             if (currentX == auxiliaryRowGroupVector.get()) {
@@ -479,6 +567,7 @@ namespace storm {
             }
             
             this->reportStatus(result.status, result.iterations);
+            this->reportWork(env, result.iterations, result.iterations, *this->A);
             
             // If requested, we store the scheduler for retrieval.
             if (this->isTrackSchedulerSet()) {
@@ -493,6 +582,73 @@ namespace storm {
             return result.status == SolverStatus::Converged || result.status == SolverStatus::TerminatedEarly;
         }
         
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIterationBlock(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfVectors) const {
+            STORM_LOG_THROW(x.size() == this->A->getRowGroupCount() * numberOfVectors && b.size() == this->A->getRowCount() * numberOfVectors, storm::exceptions::InvalidArgumentException, "The sizes of the given blocks do not match the matrix.");
+            if (!this->multiplierA) {
+                this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+            }
+            
+            // Without a unique solution, we have to approach the solution from below (above) for all vectors.
+            if (!this->hasUniqueSolution()) {
+                std::vector<ValueType> bounds(this->A->getRowGroupCount());
+                if (maximize(dir)) {
+                    this->createLowerBoundsVector(bounds);
+                } else {
+                    this->createUpperBoundsVector(bounds);
+                }
+                for (uint64_t rowGroup = 0; rowGroup < bounds.size(); ++rowGroup) {
+                    std::fill(x.begin() + rowGroup * numberOfVectors, x.begin() + (rowGroup + 1) * numberOfVectors, bounds[rowGroup]);
+                }
+            }
+            
+            // The auxiliary vector depends on the number of vectors, so it is not cached.
+            std::vector<ValueType> auxiliaryBlock(x.size());
+            std::vector<ValueType>* currentX = &x;
+            std::vector<ValueType>* newX = &auxiliaryBlock;
+            
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+            bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+            bool useGaussSeidelMultiplication = env.solver().minMax().getMultiplicationStyle() == storm::solver::MultiplicationStyle::GaussSeidel;
+            uint64_t maximalNumberOfIterations = env.solver().minMax().getMaximalNumberOfIterations();
+            
+            this->startMeasureProgress();
+            uint64_t iterations = 0;
+            SolverStatus status = SolverStatus::InProgress;
+            while (status == SolverStatus::InProgress) {
+                // Compute x_j' = min/max(A*x_j + b_j) for all vectors in one pass over the matrix.
+                if (useGaussSeidelMultiplication) {
+                    *newX = *currentX;
+                    this->multiplierA->multiplyAndReduceGaussSeidelBlock(env, dir, *newX, &b, numberOfVectors);
+                } else {
+                    this->multiplierA->multiplyAndReduceBlock(env, dir, *currentX, &b, *newX, numberOfVectors);
+                }
+                
+                // The block converged if every entry (and hence every vector) converged.
+                if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, precision, relative)) {
+                    status = SolverStatus::Converged;
+                }
+                
+                std::swap(currentX, newX);
+                ++iterations;
+                status = this->updateStatus(status, false, iterations, maximalNumberOfIterations);
+                this->showProgressIterative(iterations);
+            }
+            
+            if (currentX == &auxiliaryBlock) {
+                std::swap(x, auxiliaryBlock);
+            }
+            
+            this->reportStatus(status, iterations);
+            this->reportWork(env, iterations, iterations * numberOfVectors, *this->A);
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            return status == SolverStatus::Converged;
+        }
+        
         template<typename ValueType>
         void preserveOldRelevantValues(std::vector<ValueType> const& allValues, storm::storage::BitVector const& relevantValues, std::vector<ValueType>& oldValues) {
             storm::utility::vector::selectVectorValues(oldValues, relevantValues, allValues);
@@ -524,10 +680,15 @@ namespace storm {
             this->createUpperBoundsVector(this->auxiliaryRowGroupVector, this->A->getRowGroupCount());
             std::vector<ValueType>* upperX = this->auxiliaryRowGroupVector.get();
             
+            // When both bounds are improved, they are updated in a single pass over the matrix, which requires a second
+            // temporary vector.
             std::vector<ValueType>* tmp = nullptr;
+            std::vector<ValueType>* upperTmp = nullptr;
             if (!useGaussSeidelMultiplication) {
                 auxiliaryRowGroupVector2 = std::make_unique<std::vector<ValueType>>(lowerX->size());
                 tmp = auxiliaryRowGroupVector2.get();
+                auxiliaryRowGroupVector3 = std::make_unique<std::vector<ValueType>>(lowerX->size());
+                upperTmp = auxiliaryRowGroupVector3.get();
             }
             
             // Proceed with the iterations as long as the method did not converge or reach the maximum number of iterations.
@@ -537,9 +698,13 @@ namespace storm {
             bool doConvergenceCheck = true;
             bool useDiffs = this->hasRelevantValues() && !env.solver().minMax().isSymmetricUpdatesSet();
             std::vector<ValueType> oldValues;
+            std::vector<ValueType> oldUpperValues;
             if (useGaussSeidelMultiplication && useDiffs) {
                 oldValues.resize(this->getRelevantValues().getNumberOfSetBits());
+                oldUpperValues.resize(oldValues.size());
             }
+            storm::utility::VectorHelper<ValueType> vectorHelper;
+            storm::storage::BitVector const* relevantValues = this->hasRelevantValues() ? &this->getRelevantValues() : nullptr;
             ValueType maxLowerDiff = storm::utility::zero<ValueType>();
             ValueType maxUpperDiff = storm::utility::zero<ValueType>();
             bool relative = env.solver().minMax().getRelativeTerminationCriterion();
@@ -548,6 +713,13 @@ namespace storm {
                 precision *= storm::utility::convertNumber<ValueType>(2.0);
             }
             this->startMeasureProgress();
+            
+            // If requested, we first approach the solution from both sides in single precision. Since the bounds are
+            // only kept if they still hold in double precision, the result remains sound.
+            if (env.solver().minMax().isMixedPrecisionSet()) {
+                iterations += performSinglePrecisionValueIteration(env, dir, *lowerX, b, SolverGuarantee::LessOrEqual, env.solver().minMax().getMaximalNumberOfIterations());
+                iterations += performSinglePrecisionValueIteration(env, dir, *upperX, b, SolverGuarantee::GreaterOrEqual, env.solver().minMax().getMaximalNumberOfIterations() - std::min(iterations, env.solver().minMax().getMaximalNumberOfIterations()));
+            }
             while (status == SolverStatus::InProgress && iterations < env.solver().minMax().getMaximalNumberOfIterations()) {
                 // Remember in which directions we took steps in this iteration.
                 bool lowerStep = false;
@@ -560,27 +732,21 @@ namespace storm {
                     if (useGaussSeidelMultiplication) {
                         if (useDiffs) {
                             preserveOldRelevantValues(*lowerX, this->getRelevantValues(), oldValues);
+                            preserveOldRelevantValues(*upperX, this->getRelevantValues(), oldUpperValues);
                         }
-                        this->multiplierA->multiplyAndReduceGaussSeidel(env, dir, *lowerX, &b);
+                        this->multiplierA->multiplyAndReduceGaussSeidel2(env, dir, *lowerX, *upperX, &b);
                         if (useDiffs) {
                             maxLowerDiff = computeMaxAbsDiff(*lowerX, this->getRelevantValues(), oldValues);
-                            preserveOldRelevantValues(*upperX, this->getRelevantValues(), oldValues);
-                        }
-                        this->multiplierA->multiplyAndReduceGaussSeidel(env, dir, *upperX, &b);
-                        if (useDiffs) {
-                            maxUpperDiff = computeMaxAbsDiff(*upperX, this->getRelevantValues(), oldValues);
+                            maxUpperDiff = computeMaxAbsDiff(*upperX, this->getRelevantValues(), oldUpperValues);
                         }
                     } else {
-                        this->multiplierA->multiplyAndReduce(env, dir, *lowerX, &b, *tmp);
+                        this->multiplierA->multiplyAndReduce2(env, dir, *lowerX, *tmp, *upperX, *upperTmp, &b);
                         if (useDiffs) {
-                            maxLowerDiff = computeMaxAbsDiff(*lowerX, *tmp, this->getRelevantValues());
+                            maxLowerDiff = vectorHelper.computeMaxAbsDiff(*lowerX, *tmp, relevantValues);
+                            maxUpperDiff = vectorHelper.computeMaxAbsDiff(*upperX, *upperTmp, relevantValues);
                         }
                         std::swap(lowerX, tmp);
-                        this->multiplierA->multiplyAndReduce(env, dir, *upperX, &b, *tmp);
-                        if (useDiffs) {
-                            maxUpperDiff = computeMaxAbsDiff(*upperX, *tmp, this->getRelevantValues());
-                        }
-                        std::swap(upperX, tmp);
+                        std::swap(upperX, upperTmp);
                     }
                 } else {
                     // In the following iterations, we improve the bound with the greatest difference.
@@ -608,14 +774,14 @@ namespace storm {
                         if (maxLowerDiff >= maxUpperDiff) {
                             this->multiplierA->multiplyAndReduce(env, dir, *lowerX, &b, *tmp);
                             if (useDiffs) {
-                                maxLowerDiff = computeMaxAbsDiff(*lowerX, *tmp, this->getRelevantValues());
+                                maxLowerDiff = vectorHelper.computeMaxAbsDiff(*lowerX, *tmp, relevantValues);
                             }
                             std::swap(tmp, lowerX);
                             lowerStep = true;
                         } else {
                             this->multiplierA->multiplyAndReduce(env, dir, *upperX, &b, *tmp);
                             if (useDiffs) {
-                                maxUpperDiff = computeMaxAbsDiff(*upperX, *tmp, this->getRelevantValues());
+                                maxUpperDiff = vectorHelper.computeMaxAbsDiff(*upperX, *tmp, relevantValues);
                             }
                             std::swap(tmp, upperX);
                             upperStep = true;
@@ -630,11 +796,7 @@ namespace storm {
 
                 if (doConvergenceCheck) {
                     // Determine whether the method converged.
-                    if (this->hasRelevantValues()) {
-                        status = storm::utility::vector::equalModuloPrecision<ValueType>(*lowerX, *upperX, this->getRelevantValues(), precision, relative) ? SolverStatus::Converged : status;
-                    } else {
-                        status = storm::utility::vector::equalModuloPrecision<ValueType>(*lowerX, *upperX, precision, relative) ? SolverStatus::Converged : status;
-                    }
+                    status = vectorHelper.equalModuloPrecision(*lowerX, *upperX, precision, relative, relevantValues) ? SolverStatus::Converged : status;
                 }
                 
                 // Update environment variables.
@@ -652,16 +814,15 @@ namespace storm {
             }
             
             this->reportStatus(status, iterations);
+            this->reportWork(env, iterations, 2 * iterations, *this->A);
 
             // We take the means of the lower and upper bound so we guarantee the desired precision.
             ValueType two = storm::utility::convertNumber<ValueType>(2.0);
             storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(*lowerX, *upperX, *lowerX, [&two] (ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
             
             // Since we shuffled the pointer around, we need to write the actual results to the input/output vector x.
-            if (&x == tmp) {
-                std::swap(x, *tmp);
-            } else if (&x == this->auxiliaryRowGroupVector.get()) {
-                std::swap(x, *this->auxiliaryRowGroupVector);
+            if (lowerX != &x) {
+                std::swap(x, *lowerX);
             }
             
             // If requested, we store the scheduler for retrieval.
@@ -729,6 +890,7 @@ namespace storm {
             }
 
             this->reportStatus(status, iterations);
+            this->reportWork(env, iterations, 2 * iterations, *this->A);
             
             if (!this->isCachingEnabled()) {
                 clearCache();
@@ -1069,8 +1231,10 @@ namespace storm {
         template<typename ValueType>
         void IterativeMinMaxLinearEquationSolver<ValueType>::clearCache() const {
             multiplierA.reset();
+            singlePrecisionA.reset();
             auxiliaryRowGroupVector.reset();
             auxiliaryRowGroupVector2.reset();
+            auxiliaryRowGroupVector3.reset();
             soundValueIterationHelper.reset();
             optimisticValueIterationHelper.reset();
             StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
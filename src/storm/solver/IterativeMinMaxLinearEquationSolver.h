@@ -26,6 +26,7 @@ namespace storm {
             IterativeMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A, std::unique_ptr<LinearEquationSolverFactory<ValueType>>&& linearEquationSolverFactory);
             
             virtual bool internalSolveEquations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
+            virtual bool internalSolveEquationsBlock(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfVectors) const override;
 
             virtual void clearCache() const override;
             
@@ -41,6 +42,7 @@ namespace storm {
             bool valueImproved(OptimizationDirection dir, ValueType const& value1, ValueType const& value2) const;
 
             bool solveEquationsValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            bool solveEquationsValueIterationBlock(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfVectors) const;
             bool solveEquationsOptimisticValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             bool solveEquationsIntervalIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             bool solveEquationsSoundValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
@@ -76,6 +78,17 @@ namespace storm {
             
             ValueIterationResult performValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>*& currentX, std::vector<ValueType>*& newX, std::vector<ValueType> const& b, ValueType const& precision, bool relative, SolverGuarantee const& guarantee, uint64_t currentIterations, uint64_t  maximalNumberOfIterations, storm::solver::MultiplicationStyle const& multiplicationStyle) const;
             
+            /*!
+             * Performs value iteration on a single precision copy of the equation system, starting from the given
+             * values, until the values no longer change with respect to a coarse precision. Afterwards, the result is
+             * only written back to x if it preserves the given guarantee, i.e., if it is a sub-solution (for
+             * SolverGuarantee::LessOrEqual) or a super-solution (for SolverGuarantee::GreaterOrEqual) of the equation
+             * system in the original precision. Only has an effect if the value type is double.
+             *
+             * @return The number of iterations that were performed.
+             */
+            uint64_t performSinglePrecisionValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, SolverGuarantee const& guarantee, uint64_t maximalNumberOfIterations) const;
+            
             void createLinearEquationSolver(Environment const& env) const;
             
             /// The factory used to obtain linear equation solvers.
@@ -85,8 +98,10 @@ namespace storm {
             mutable std::unique_ptr<storm::solver::Multiplier<ValueType>> multiplierA;
             mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector; // A.rowGroupCount() entries
             mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector2; // A.rowGroupCount() entries
+            mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector3; // A.rowGroupCount() entries
             mutable std::unique_ptr<storm::solver::helper::SoundValueIterationHelper<ValueType>> soundValueIterationHelper;
             mutable std::unique_ptr<storm::solver::helper::OptimisticValueIterationHelper<ValueType>> optimisticValueIterationHelper;
+            mutable std::unique_ptr<storm::storage::SparseMatrix<float>> singlePrecisionA;
             
         };
         
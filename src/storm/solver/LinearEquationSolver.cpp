@@ -15,6 +15,7 @@
 #include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/PerformanceCounters.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
 
@@ -28,6 +29,7 @@ namespace storm {
         
         template<typename ValueType>
         bool LinearEquationSolver<ValueType>::solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            storm::utility::PerformanceCounters::Scope scope(env.getPerformanceCounters(), "linear equation solving");
             return this->internalSolveEquations(env, x, b);
         }
         
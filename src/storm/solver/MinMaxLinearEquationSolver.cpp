@@ -12,9 +12,11 @@
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/PerformanceCounters.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
+#include "storm/exceptions/IllegalArgumentException.h"
 
 namespace storm {
     namespace solver {
@@ -32,6 +34,7 @@ namespace storm {
         template<typename ValueType>
         bool MinMaxLinearEquationSolver<ValueType>::solveEquations(Environment const& env, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             STORM_LOG_WARN_COND_DEBUG(this->isRequirementsCheckedSet(), "The requirements of the solver have not been marked as checked. Please provide the appropriate check or mark the requirements as checked (if applicable).");
+            storm::utility::PerformanceCounters::Scope scope(env.getPerformanceCounters(), "min-max equation solving");
             return internalSolveEquations(env, d, x, b);
         }
         
@@ -41,6 +44,38 @@ namespace storm {
             solveEquations(env, convert(this->direction), x, b);
         }
 
+        template<typename ValueType>
+        bool MinMaxLinearEquationSolver<ValueType>::solveEquationsBlock(Environment const& env, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfVectors) const {
+            STORM_LOG_WARN_COND_DEBUG(this->isRequirementsCheckedSet(), "The requirements of the solver have not been marked as checked. Please provide the appropriate check or mark the requirements as checked (if applicable).");
+            STORM_LOG_THROW(numberOfVectors > 0, storm::exceptions::IllegalArgumentException, "Expected at least one vector.");
+            STORM_LOG_THROW(x.size() % numberOfVectors == 0 && b.size() % numberOfVectors == 0, storm::exceptions::IllegalArgumentException, "The sizes of the given blocks do not match the number of vectors.");
+            STORM_LOG_THROW(!this->isTrackSchedulerSet(), storm::exceptions::IllegalFunctionCallException, "Schedulers can not be tracked when solving for several vectors at once.");
+            storm::utility::PerformanceCounters::Scope scope(env.getPerformanceCounters(), "min-max equation solving");
+            return internalSolveEquationsBlock(env, d, x, b, numberOfVectors);
+        }
+        
+        template<typename ValueType>
+        bool MinMaxLinearEquationSolver<ValueType>::internalSolveEquationsBlock(Environment const& env, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfVectors) const {
+            uint64_t const numberOfRowGroups = x.size() / numberOfVectors;
+            uint64_t const numberOfRows = b.size() / numberOfVectors;
+            std::vector<ValueType> singleX(numberOfRowGroups);
+            std::vector<ValueType> singleB(numberOfRows);
+            bool result = true;
+            for (uint64_t vector = 0; vector < numberOfVectors; ++vector) {
+                for (uint64_t rowGroup = 0; rowGroup < numberOfRowGroups; ++rowGroup) {
+                    singleX[rowGroup] = x[rowGroup * numberOfVectors + vector];
+                }
+                for (uint64_t row = 0; row < numberOfRows; ++row) {
+                    singleB[row] = b[row * numberOfVectors + vector];
+                }
+                result &= internalSolveEquations(env, d, singleX, singleB);
+                for (uint64_t rowGroup = 0; rowGroup < numberOfRowGroups; ++rowGroup) {
+                    x[rowGroup * numberOfVectors + vector] = singleX[rowGroup];
+                }
+            }
+            return result;
+        }
+
         template<typename ValueType>
         void MinMaxLinearEquationSolver<ValueType>::setOptimizationDirection(OptimizationDirection d) {
             direction = convert(d);
@@ -141,6 +176,11 @@ namespace storm {
             return initialScheduler.get();
         }
         
+        template<typename ValueType>
+        void MinMaxLinearEquationSolver<ValueType>::clearInitialScheduler() {
+            initialScheduler = boost::none;
+        }
+        
         template<typename ValueType>
         MinMaxLinearEquationSolverRequirements MinMaxLinearEquationSolver<ValueType>::getRequirements(Environment const&, boost::optional<storm::solver::OptimizationDirection> const& direction, bool const& hasInitialScheduler) const {
             return MinMaxLinearEquationSolverRequirements();
@@ -60,6 +60,21 @@ namespace storm {
              */
             void solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             
+            /*!
+             * Solves the equation systems x_j = min/max(A*x_j + b_j) for several right-hand sides b_1, ..., b_k that
+             * share the matrix A. The vectors are given as row-major blocks, i.e., the value of vector j for row group
+             * (row) i is stored at position i*k+j of x (b). Solvers that support this traverse the matrix only once per
+             * iteration for all vectors. Others solve the systems one after another. Schedulers can not be tracked
+             * for blocks of vectors.
+             *
+             * @param d The optimization direction (for all systems).
+             * @param x The block of solution vectors. The initial values represent a guess of the real values.
+             * @param b The block of vectors to add after the matrix-vector multiplication.
+             * @param numberOfVectors The number k of vectors in each block.
+             * @return True iff all systems were solved.
+             */
+            bool solveEquationsBlock(Environment const& env, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfVectors) const;
+            
             /*!
              * Sets an optimization direction to use for calls to methods that do not explicitly provide one.
              */
@@ -151,6 +166,11 @@ namespace storm {
              */
             std::vector<uint_fast64_t> const& getInitialScheduler() const;
             
+            /*!
+             * Removes a previously set initial scheduler.
+             */
+            void clearInitialScheduler();
+            
             /*!
              * Retrieves the requirements of this solver for solving equations with the current settings. The requirements
              * are guaranteed to be ordered according to their appearance in the SolverRequirement type.
@@ -170,6 +190,11 @@ namespace storm {
             
         protected:
             virtual bool internalSolveEquations(Environment const& env, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
+            
+            /*!
+             * Solves the equation systems of the given blocks of vectors. By default, the systems are solved one after another.
+             */
+            virtual bool internalSolveEquationsBlock(Environment const& env, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t numberOfVectors) const;
                         
             /// The optimization direction to use for calls to functions that do not provide it explicitly. Can also be unset.
             OptimizationDirectionSetting direction;
@@ -1,5 +1,7 @@
 #include "storm/solver/Multiplier.h"
 
+#include <algorithm>
+
 #include "storm-config.h"
 
 #include "storm/storage/SparseMatrix.h"
@@ -7,18 +9,141 @@
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/NativeMultiplier.h"
 #include "storm/solver/GmmxxMultiplier.h"
+#include "storm/solver/SimdMultiplier.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/ProgressMeasurement.h"
 
 namespace storm {
     namespace solver {
         
+        namespace detail {
+            // The number of row groups that are processed by a task of the parallel multiplications.
+            static const uint64_t parallelMultiplicationGrainSize = 256;
+            
+            /*!
+             * Multiplies the rows of the given group with both vectors and reduces the results. Like the other
+             * multiplications, empty groups are skipped, so the results keep their previous values.
+             */
+            template<typename Compare, typename ValueType>
+            void multiplyAndReduceRowGroup2(Multiplier<ValueType> const& multiplier, uint64_t groupStart, uint64_t groupEnd, std::vector<ValueType> const& x1, ValueType& result1, std::vector<ValueType> const& x2, ValueType& result2, std::vector<ValueType> const* b) {
+                Compare compare;
+                for (uint64_t row = groupStart; row < groupEnd; ++row) {
+                    ValueType value1 = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                    ValueType value2 = value1;
+                    multiplier.multiplyRow2(row, x1, value1, x2, value2);
+                    if (row == groupStart || compare(value1, result1)) {
+                        result1 = std::move(value1);
+                    }
+                    if (row == groupStart || compare(value2, result2)) {
+                        result2 = std::move(value2);
+                    }
+                }
+            }
+            
+            template<typename Compare, typename ValueType>
+            void multiplyAndReduce2(Multiplier<ValueType> const& multiplier, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x1, std::vector<ValueType>& result1, std::vector<ValueType> const& x2, std::vector<ValueType>& result2, std::vector<ValueType> const* b, bool parallel) {
+                // The groups are written independently of each other, so they can be processed in any order.
+                auto processGroups = [&] (auto const& range) {
+                    for (uint64_t group = range.begin(); group < range.end(); ++group) {
+                        multiplyAndReduceRowGroup2<Compare>(multiplier, rowGroupIndices[group], rowGroupIndices[group + 1], x1, result1[group], x2, result2[group], b);
+                    }
+                };
+                if (parallel) {
+                    storm::utility::parallel::parallelFor(0, result1.size(), parallelMultiplicationGrainSize, processGroups);
+                } else {
+                    processGroups(storm::utility::parallel::Range(0, result1.size()));
+                }
+            }
+            
+            template<typename Compare, typename ValueType>
+            void multiplyAndReduceGaussSeidel2(Multiplier<ValueType> const& multiplier, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x1, std::vector<ValueType>& x2, std::vector<ValueType> const* b, bool backwards) {
+                uint64_t const numberOfGroups = x1.size();
+                for (uint64_t step = 0; step < numberOfGroups; ++step) {
+                    uint64_t group = backwards ? numberOfGroups - 1 - step : step;
+                    // Only multiply and reduce if there is at least one row in the group.
+                    if (rowGroupIndices[group] == rowGroupIndices[group + 1]) {
+                        continue;
+                    }
+                    ValueType value1, value2;
+                    multiplyAndReduceRowGroup2<Compare>(multiplier, rowGroupIndices[group], rowGroupIndices[group + 1], x1, value1, x2, value2, b);
+                    x1[group] = std::move(value1);
+                    x2[group] = std::move(value2);
+                }
+            }
+            
+            /*!
+             * Multiplies the rows of the given group with all vectors of the block and writes the reduced results to
+             * the given positions. The buffer must hold one value per vector. Empty groups are skipped, so their results
+             * keep the previous values (as when multiplying with each vector separately).
+             */
+            template<typename Compare, typename ValueType>
+            void multiplyAndReduceRowGroupBlock(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t groupStart, uint64_t groupEnd, std::vector<ValueType> const& x, std::vector<ValueType> const* b, uint64_t numberOfVectors, std::vector<ValueType>& buffer, ValueType* result) {
+                Compare compare;
+                for (uint64_t row = groupStart; row < groupEnd; ++row) {
+                    if (b) {
+                        std::copy((*b).begin() + row * numberOfVectors, (*b).begin() + (row + 1) * numberOfVectors, buffer.begin());
+                    } else {
+                        std::fill(buffer.begin(), buffer.end(), storm::utility::zero<ValueType>());
+                    }
+                    for (auto const& entry : matrix.getRow(row)) {
+                        ValueType const* xValues = x.data() + entry.getColumn() * numberOfVectors;
+                        for (uint64_t vector = 0; vector < numberOfVectors; ++vector) {
+                            buffer[vector] += entry.getValue() * xValues[vector];
+                        }
+                    }
+                    for (uint64_t vector = 0; vector < numberOfVectors; ++vector) {
+                        if (row == groupStart || compare(buffer[vector], result[vector])) {
+                            result[vector] = buffer[vector];
+                        }
+                    }
+                }
+            }
+            
+            template<typename Compare, typename ValueType>
+            void multiplyAndReduceBlock(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t numberOfVectors, bool parallel) {
+                auto const& rowGroupIndices = matrix.getRowGroupIndices();
+                auto processGroups = [&] (auto const& range) {
+                    std::vector<ValueType> buffer(numberOfVectors);
+                    for (uint64_t group = range.begin(); group < range.end(); ++group) {
+                        multiplyAndReduceRowGroupBlock<Compare>(matrix, rowGroupIndices[group], rowGroupIndices[group + 1], x, b, numberOfVectors, buffer, result.data() + group * numberOfVectors);
+                    }
+                };
+                uint64_t const numberOfGroups = matrix.getRowGroupCount();
+                if (parallel) {
+                    // Each entry of the matrix is now used for several vectors, so smaller chunks of row groups suffice.
+                    storm::utility::parallel::parallelFor(0, numberOfGroups, std::max<uint64_t>(1, parallelMultiplicationGrainSize / numberOfVectors), processGroups);
+                } else {
+                    processGroups(storm::utility::parallel::Range(0, numberOfGroups));
+                }
+            }
+            
+            template<typename Compare, typename ValueType>
+            void multiplyAndReduceGaussSeidelBlock(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t numberOfVectors, bool backwards) {
+                auto const& rowGroupIndices = matrix.getRowGroupIndices();
+                uint64_t const numberOfGroups = matrix.getRowGroupCount();
+                std::vector<ValueType> buffer(numberOfVectors);
+                std::vector<ValueType> groupResult(numberOfVectors);
+                for (uint64_t step = 0; step < numberOfGroups; ++step) {
+                    uint64_t group = backwards ? numberOfGroups - 1 - step : step;
+                    // Only multiply and reduce if there is at least one row in the group.
+                    if (rowGroupIndices[group] == rowGroupIndices[group + 1]) {
+                        continue;
+                    }
+                    multiplyAndReduceRowGroupBlock<Compare>(matrix, rowGroupIndices[group], rowGroupIndices[group + 1], x, b, numberOfVectors, buffer, groupResult.data());
+                    std::copy(groupResult.begin(), groupResult.end(), x.begin() + group * numberOfVectors);
+                }
+            }
+        }
+        
         template<typename ValueType>
         Multiplier<ValueType>::Multiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : matrix(matrix) {
             // Intentionally left empty.
@@ -39,6 +164,73 @@ namespace storm {
             multiplyAndReduceGaussSeidel(env, dir, this->matrix.getRowGroupIndices(), x, b, choices, backwards);
         }
     
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x1, std::vector<ValueType>& result1, std::vector<ValueType> const& x2, std::vector<ValueType>& result2, std::vector<ValueType> const* b) const {
+            STORM_LOG_ASSERT(&result1 != &x1 && &result1 != &x2 && &result2 != &x1 && &result2 != &x2, "The results must not alias the input vectors.");
+            bool parallel = env.solver().multiplier().isParallelSet() && storm::utility::parallel::getNumberOfThreads() > 1;
+            if (dir == storm::OptimizationDirection::Minimize) {
+                detail::multiplyAndReduce2<storm::utility::ElementLess<ValueType>>(*this, this->matrix.getRowGroupIndices(), x1, result1, x2, result2, b, parallel);
+            } else {
+                detail::multiplyAndReduce2<storm::utility::ElementGreater<ValueType>>(*this, this->matrix.getRowGroupIndices(), x1, result1, x2, result2, b, parallel);
+            }
+        }
+        
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyAndReduceGaussSeidel2(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x1, std::vector<ValueType>& x2, std::vector<ValueType> const* b, bool backwards) const {
+            if (dir == storm::OptimizationDirection::Minimize) {
+                detail::multiplyAndReduceGaussSeidel2<storm::utility::ElementLess<ValueType>>(*this, this->matrix.getRowGroupIndices(), x1, x2, b, backwards);
+            } else {
+                detail::multiplyAndReduceGaussSeidel2<storm::utility::ElementGreater<ValueType>>(*this, this->matrix.getRowGroupIndices(), x1, x2, b, backwards);
+            }
+        }
+        
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyAndReduceBlock(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t numberOfVectors) const {
+            STORM_LOG_ASSERT(&result != &x, "The result must not alias the input vector.");
+            STORM_LOG_ASSERT(x.size() == this->matrix.getColumnCount() * numberOfVectors, "The size of the input block does not match.");
+            STORM_LOG_ASSERT(!b || b->size() == this->matrix.getRowCount() * numberOfVectors, "The size of the offset block does not match.");
+            result.resize(this->matrix.getRowGroupCount() * numberOfVectors);
+            bool parallel = env.solver().multiplier().isParallelSet() && storm::utility::parallel::getNumberOfThreads() > 1;
+            if (dir == storm::OptimizationDirection::Minimize) {
+                detail::multiplyAndReduceBlock<storm::utility::ElementLess<ValueType>>(this->matrix, x, b, result, numberOfVectors, parallel);
+            } else {
+                detail::multiplyAndReduceBlock<storm::utility::ElementGreater<ValueType>>(this->matrix, x, b, result, numberOfVectors, parallel);
+            }
+        }
+        
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyAndReduceGaussSeidelBlock(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t numberOfVectors, bool backwards) const {
+            STORM_LOG_ASSERT(x.size() == this->matrix.getColumnCount() * numberOfVectors, "The size of the block does not match.");
+            STORM_LOG_ASSERT(!b || b->size() == this->matrix.getRowCount() * numberOfVectors, "The size of the offset block does not match.");
+            if (dir == storm::OptimizationDirection::Minimize) {
+                detail::multiplyAndReduceGaussSeidelBlock<storm::utility::ElementLess<ValueType>>(this->matrix, x, b, numberOfVectors, backwards);
+            } else {
+                detail::multiplyAndReduceGaussSeidelBlock<storm::utility::ElementGreater<ValueType>>(this->matrix, x, b, numberOfVectors, backwards);
+            }
+        }
+        
+#ifdef STORM_HAVE_CARL
+        template<>
+        void Multiplier<storm::RationalFunction>::multiplyAndReduceBlock(Environment const&, OptimizationDirection const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&, uint64_t) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+        
+        template<>
+        void Multiplier<storm::RationalFunction>::multiplyAndReduceGaussSeidelBlock(Environment const&, OptimizationDirection const&, std::vector<storm::RationalFunction>&, std::vector<storm::RationalFunction> const*, uint64_t, bool) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+        
+        template<>
+        void Multiplier<storm::RationalFunction>::multiplyAndReduce2(Environment const&, OptimizationDirection const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction>&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction>&, std::vector<storm::RationalFunction> const*) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+        
+        template<>
+        void Multiplier<storm::RationalFunction>::multiplyAndReduceGaussSeidel2(Environment const&, OptimizationDirection const&, std::vector<storm::RationalFunction>&, std::vector<storm::RationalFunction>&, std::vector<storm::RationalFunction> const*, bool) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+        
         template<typename ValueType>
         void Multiplier<ValueType>::repeatedMultiply(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n) const {
             storm::utility::ProgressMeasurement progress("multiplications");
@@ -96,6 +288,8 @@ namespace storm {
                     return std::make_unique<GmmxxMultiplier<ValueType>>(matrix);
                 case MultiplierType::Native:
                     return std::make_unique<NativeMultiplier<ValueType>>(matrix);
+                case MultiplierType::Simd:
+                    return std::make_unique<SimdMultiplier<ValueType>>(matrix);
             }
             STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Unknown MultiplierType");
         }
@@ -88,6 +88,61 @@ namespace storm {
             void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr, bool backwards = true) const;
             virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr, bool backwards = true) const = 0;
             
+            /*!
+             * Performs the matrix-vector multiplications x1' = A*x1 + b and x2' = A*x2 + b and then minimizes/maximizes
+             * both results over the row groups. In contrast to two calls of multiplyAndReduce, both vectors are
+             * processed in a single pass over the matrix. This is useful for methods that maintain a lower and an upper
+             * bound of the solution.
+             *
+             * @param dir The direction for the reduction step.
+             * @param x1 The first input vector with which to multiply the matrix.
+             * @param result1 The target vector for the first result. Must not be the same as x1 or x2.
+             * @param x2 The second input vector with which to multiply the matrix.
+             * @param result2 The target vector for the second result. Must not be the same as x1 or x2.
+             * @param b If non-null, this vector is added after the multiplications.
+             */
+            virtual void multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x1, std::vector<ValueType>& result1, std::vector<ValueType> const& x2, std::vector<ValueType>& result2, std::vector<ValueType> const* b) const;
+            
+            /*!
+             * Performs the Gauss-Seidel style multiplications of both given vectors (as in multiplyAndReduceGaussSeidel)
+             * in a single pass over the matrix. Both vectors are updated in place.
+             *
+             * @param dir The direction for the reduction step.
+             * @param x1 The first input/output vector.
+             * @param x2 The second input/output vector.
+             * @param b If non-null, this vector is added after the multiplications.
+             * @param backwards if true, the iterations will be performed beginning from the last rowgroup and ending at the first rowgroup.
+             */
+            virtual void multiplyAndReduceGaussSeidel2(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x1, std::vector<ValueType>& x2, std::vector<ValueType> const* b, bool backwards = true) const;
+            
+            /*!
+             * Performs the matrix-vector multiplications x_j' = A*x_j + b_j for several vectors x_1, ..., x_k and then
+             * minimizes/maximizes the results over the row groups. The vectors are given as row-major blocks, i.e., the
+             * value of vector j for column (row) i is stored at position i*k+j of x (b, result). Each entry of the matrix
+             * is read once for all vectors.
+             *
+             * @param dir The direction for the reduction step.
+             * @param x The block of input vectors. Its length must be equal to k times the number of columns of A.
+             * @param b If non-null, this block is added after the multiplication. Its length must be equal to k times
+             * the number of rows of A.
+             * @param result The block of result vectors. Its length must be equal to k times the number of row groups
+             * of A. Must not be the same as x.
+             * @param numberOfVectors The number k of vectors in each block.
+             */
+            virtual void multiplyAndReduceBlock(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, uint64_t numberOfVectors) const;
+            
+            /*!
+             * Performs the Gauss-Seidel style multiplications (as in multiplyAndReduceGaussSeidel) for a block of
+             * vectors (as in multiplyAndReduceBlock). The block is updated in place.
+             *
+             * @param dir The direction for the reduction step.
+             * @param x The input/output block of vectors.
+             * @param b If non-null, this block is added after the multiplication.
+             * @param numberOfVectors The number k of vectors in each block.
+             * @param backwards if true, the iterations will be performed beginning from the last rowgroup and ending at the first rowgroup.
+             */
+            virtual void multiplyAndReduceGaussSeidelBlock(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t numberOfVectors, bool backwards = true) const;
+            
             /*!
              * Performs repeated matrix-vector multiplication, using x[0] = x and x[i + 1] = A*x[i] + b. After
              * performing the necessary multiplications, the result is written to the input vector x. Note that the
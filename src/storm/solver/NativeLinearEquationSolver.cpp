@@ -94,6 +94,7 @@ namespace storm {
             }
 
             this->reportStatus(status, iterations);
+            this->reportWork(env, iterations, iterations, *this->A);
 
             return status == SolverStatus::Converged;
         }
@@ -164,6 +165,7 @@ namespace storm {
             }
 
             this->reportStatus(status, iterations);
+            this->reportWork(env, iterations, iterations, *this->A);
 
             return status == SolverStatus::Converged;
         }
@@ -381,6 +383,7 @@ namespace storm {
             }
             
             this->logIterations(result.status == SolverStatus::Converged, result.status == SolverStatus::TerminatedEarly, result.iterations);
+            this->reportWork(env, result.iterations, result.iterations, *this->A);
 
             return result.status == SolverStatus::Converged || result.status == SolverStatus::TerminatedEarly;
         }
@@ -573,6 +576,7 @@ namespace storm {
                 clearCache();
             }
             this->reportStatus(status, iterations);
+            this->reportWork(env, iterations, 2 * iterations, *this->A);
 
             return status == SolverStatus::Converged;
         }
@@ -626,6 +630,7 @@ namespace storm {
             this->soundValueIterationHelper->setSolutionVector();
 
             this->reportStatus(status, iterations);
+            this->reportWork(env, iterations, 2 * iterations, *this->A);
 
             if (!this->isCachingEnabled()) {
                 clearCache();
@@ -666,6 +671,7 @@ namespace storm {
             auto two = storm::utility::convertNumber<ValueType>(2.0);
             storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(*lowerX, *upperX, x, [&two] (ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
             this->logIterations(statusIters.first == SolverStatus::Converged, statusIters.first == SolverStatus::TerminatedEarly, statusIters.second);
+            this->reportWork(env, statusIters.second, statusIters.second, *this->A);
 
             if (!this->isCachingEnabled()) {
                 clearCache();
@@ -10,9 +10,9 @@
 
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
-#include "storm/adapters/IntelTbbAdapter.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/Stopwatch.h"
 
 namespace storm {
     namespace solver {
@@ -24,11 +24,54 @@ namespace storm {
         
         template<typename ValueType>
         bool NativeMultiplier<ValueType>::parallelize(Environment const& env) const {
-#ifdef STORM_HAVE_INTELTBB
             return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
-#else
-            return false;
-#endif
+        }
+        
+        template<typename ValueType>
+        storm::storage::SoaSparseMatrix<ValueType> const* NativeMultiplier<ValueType>::getSoaMatrix(Environment const& env) const {
+            if (!env.solver().multiplier().isStructureOfArraysSet()) {
+                return nullptr;
+            }
+            if (!soaMatrix) {
+                storm::utility::Stopwatch conversionWatch(true);
+                soaMatrix = std::make_unique<storm::storage::SoaSparseMatrix<ValueType>>(this->matrix);
+                conversionWatch.stop();
+                STORM_LOG_INFO("Converted matrix to structure-of-arrays representation (" << (soaMatrix->hasNarrowColumnIndices() ? "32" : "64") << " bit column indices, " << soaMatrix->getSizeInMemory() << " bytes) in " << conversionWatch << ".");
+            }
+            return soaMatrix.get();
+        }
+        
+        template<typename ValueType>
+        storm::storage::CompressedSparseMatrix<ValueType> const* NativeMultiplier<ValueType>::getCompressedMatrix(Environment const& env) const {
+            if (!env.solver().multiplier().isCompressedMatrixSet()) {
+                return nullptr;
+            }
+            if (!compressedMatrix) {
+                storm::utility::Stopwatch conversionWatch(true);
+                compressedMatrix = std::make_unique<storm::storage::CompressedSparseMatrix<ValueType>>(this->matrix);
+                conversionWatch.stop();
+                STORM_LOG_INFO("Converted matrix to compressed representation (" << compressedMatrix->getValueDictionarySize() << " values in dictionary, " << compressedMatrix->getSizeInMemory() << " bytes) in " << conversionWatch << ".");
+            }
+            return compressedMatrix.get();
+        }
+        
+        template<typename ValueType>
+        storm::solver::helper::ParallelGaussSeidelHelper<ValueType> const& NativeMultiplier<ValueType>::getParallelGaussSeidelHelper() const {
+            if (!parallelGaussSeidelHelper) {
+                storm::utility::Stopwatch partitionWatch(true);
+                parallelGaussSeidelHelper = std::make_unique<storm::solver::helper::ParallelGaussSeidelHelper<ValueType>>(this->matrix);
+                partitionWatch.stop();
+                STORM_LOG_INFO("Partitioned matrix for parallel Gauss-Seidel sweeps (" << parallelGaussSeidelHelper->getNumberOfBlocks() << " blocks on " << parallelGaussSeidelHelper->getNumberOfLevels() << " levels) in " << partitionWatch << ".");
+            }
+            return *parallelGaussSeidelHelper;
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::clearCache() const {
+            soaMatrix.reset();
+            compressedMatrix.reset();
+            parallelGaussSeidelHelper.reset();
+            Multiplier<ValueType>::clearCache();
         }
         
         template<typename ValueType>
@@ -44,6 +87,10 @@ namespace storm {
             }
             if (parallelize(env)) {
                 multAddParallel(x, b, *target);
+            } else if (auto compressed = getCompressedMatrix(env)) {
+                compressed->multiplyWithVector(x, *target, b);
+            } else if (auto soa = getSoaMatrix(env)) {
+                soa->multiplyWithVector(x, *target, b);
             } else {
                 multAdd(x, b, *target);
             }
@@ -54,7 +101,21 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const {
-            if (backwards) {
+            if (parallelize(env) && this->matrix.hasTrivialRowGrouping()) {
+                getParallelGaussSeidelHelper().multiplyGaussSeidel(x, b, backwards);
+            } else if (auto compressed = getCompressedMatrix(env)) {
+                if (backwards) {
+                    compressed->multiplyWithVectorBackward(x, x, b);
+                } else {
+                    compressed->multiplyWithVectorForward(x, x, b);
+                }
+            } else if (auto soa = getSoaMatrix(env)) {
+                if (backwards) {
+                    soa->multiplyWithVectorBackward(x, x, b);
+                } else {
+                    soa->multiplyWithVectorForward(x, x, b);
+                }
+            } else if (backwards) {
                 this->matrix.multiplyWithVectorBackward(x, x, b);
             } else {
                 this->matrix.multiplyWithVectorForward(x, x, b);
@@ -74,6 +135,10 @@ namespace storm {
             }
             if (parallelize(env)) {
                 multAddReduceParallel(dir, rowGroupIndices, x, b, *target, choices);
+            } else if (auto compressed = getCompressedMatrix(env)) {
+                compressed->multiplyAndReduceForward(dir, rowGroupIndices, x, b, *target, choices);
+            } else if (auto soa = getSoaMatrix(env)) {
+                soa->multiplyAndReduceForward(dir, rowGroupIndices, x, b, *target, choices);
             } else {
                 multAddReduce(dir, rowGroupIndices, x, b, *target, choices);
             }
@@ -84,15 +149,46 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
-            if (backwards) {
+            if (parallelize(env) && &rowGroupIndices == &this->matrix.getRowGroupIndices()) {
+                getParallelGaussSeidelHelper().multiplyAndReduceGaussSeidel(dir, x, b, choices, backwards);
+            } else if (auto compressed = getCompressedMatrix(env)) {
+                if (backwards) {
+                    compressed->multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+                } else {
+                    compressed->multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
+                }
+            } else if (auto soa = getSoaMatrix(env)) {
+                if (backwards) {
+                    soa->multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+                } else {
+                    soa->multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
+                }
+            } else if (backwards) {
                 this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
             } else {
                 this->matrix.multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
             }
         }
         
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel2(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x1, std::vector<ValueType>& x2, std::vector<ValueType> const* b, bool backwards) const {
+            if (parallelize(env)) {
+                getParallelGaussSeidelHelper().multiplyAndReduceGaussSeidel2(dir, x1, x2, b, backwards);
+            } else {
+                Multiplier<ValueType>::multiplyAndReduceGaussSeidel2(env, dir, x1, x2, b, backwards);
+            }
+        }
+        
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
+            if (compressedMatrix) {
+                compressedMatrix->multiplyRow(rowIndex, x, value);
+                return;
+            }
+            if (soaMatrix) {
+                soaMatrix->multiplyRow(rowIndex, x, value);
+                return;
+            }
             for (auto const& entry : this->matrix.getRow(rowIndex)) {
                 value += entry.getValue() * x[entry.getColumn()];
             }
@@ -100,6 +196,14 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2, ValueType& val2) const {
+            if (compressedMatrix) {
+                compressedMatrix->multiplyRow2(rowIndex, x1, val1, x2, val2);
+                return;
+            }
+            if (soaMatrix) {
+                soaMatrix->multiplyRow2(rowIndex, x1, val1, x2, val2);
+                return;
+            }
             for (auto const& entry : this->matrix.getRow(rowIndex)) {
                 val1 += entry.getValue() * x1[entry.getColumn()];
                 val2 += entry.getValue() * x2[entry.getColumn()];
@@ -118,22 +222,12 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
-#ifdef STORM_HAVE_INTELTBB
             this->matrix.multiplyWithVectorParallel(x, result, b);
-#else
-            STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-            multAdd(x, b, result);
-#endif
         }
                 
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
-#ifdef STORM_HAVE_INTELTBB
             this->matrix.multiplyAndReduceParallel(dir, rowGroupIndices, x, b, result, choices);
-#else
-            STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-            multAddReduce(dir, rowGroupIndices, x, b, result, choices);
-#endif
         }
 
         template class NativeMultiplier<double>;
@@ -3,6 +3,9 @@
 #include "storm/solver/Multiplier.h"
 
 #include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/SoaSparseMatrix.h"
+#include "storm/storage/CompressedSparseMatrix.h"
+#include "storm/solver/helper/ParallelGaussSeidelHelper.h"
 
 namespace storm {
     namespace storage {
@@ -22,12 +25,31 @@ namespace storm {
             virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
             virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const override;
             virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr, bool backwards = true) const override;
+            virtual void multiplyAndReduceGaussSeidel2(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x1, std::vector<ValueType>& x2, std::vector<ValueType> const* b, bool backwards = true) const override;
             virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
             virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2, ValueType& val2) const override;
+            virtual void clearCache() const override;
 
         private:
             bool parallelize(Environment const& env) const;
             
+            /*!
+             * Retrieves the structure-of-arrays representation of the matrix if the environment asks for it (and creates
+             * it if necessary). Returns null otherwise.
+             */
+            storm::storage::SoaSparseMatrix<ValueType> const* getSoaMatrix(Environment const& env) const;
+            
+            /*!
+             * Retrieves the compressed representation of the matrix if the environment asks for it (and creates it if
+             * necessary). Returns null otherwise.
+             */
+            storm::storage::CompressedSparseMatrix<ValueType> const* getCompressedMatrix(Environment const& env) const;
+            
+            /*!
+             * Retrieves the helper for parallel Gauss-Seidel sweeps (and creates it if necessary).
+             */
+            storm::solver::helper::ParallelGaussSeidelHelper<ValueType> const& getParallelGaussSeidelHelper() const;
+            
             void multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
             
             void multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
@@ -35,6 +57,9 @@ namespace storm {
             void multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
             void multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
             
+            mutable std::unique_ptr<storm::storage::SoaSparseMatrix<ValueType>> soaMatrix;
+            mutable std::unique_ptr<storm::storage::CompressedSparseMatrix<ValueType>> compressedMatrix;
+            mutable std::unique_ptr<storm::solver::helper::ParallelGaussSeidelHelper<ValueType>> parallelGaussSeidelHelper;
         };
         
     }
@@ -0,0 +1,437 @@
+#include "storm/solver/SimdMultiplier.h"
+
+#include <limits>
+
+#include "storm-config.h"
+
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/simd.h"
+
+#ifdef STORM_HAVE_X86_SIMD_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace storm {
+    namespace solver {
+
+        namespace detail {
+
+#ifdef STORM_HAVE_X86_SIMD_DISPATCH
+            /*!
+             * Retrieves the first (or, if backward, the last) offset in the given row group buffer whose value is the
+             * given extremum. If there is no such value (because a NaN is involved), the scan stops at the group bound.
+             */
+            template<bool Backward>
+            inline uint64_t findChoice(double const* buffer, uint64_t groupSize, double best) {
+                uint64_t choice = Backward ? groupSize - 1 : 0;
+                if (Backward) {
+                    while (choice > 0 && buffer[choice] != best) {
+                        --choice;
+                    }
+                } else {
+                    while (choice + 1 < groupSize && buffer[choice] != best) {
+                        ++choice;
+                    }
+                }
+                return choice;
+            }
+
+            namespace avx2 {
+                STORM_SIMD_TARGET_AVX2 inline double horizontalSum(__m256d v) {
+                    __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+                    return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+                }
+
+                STORM_SIMD_TARGET_AVX2 inline double rowDot(double const* values, uint32_t const* columns, uint64_t entry, uint64_t entryEnd, double const* x, double result) {
+                    __m256d acc = _mm256_setzero_pd();
+                    for (; entry + 4 <= entryEnd; entry += 4) {
+                        __m128i indices = _mm_loadu_si128(reinterpret_cast<__m128i const*>(columns + entry));
+                        acc = _mm256_fmadd_pd(_mm256_loadu_pd(values + entry), _mm256_i32gather_pd(x, indices, 8), acc);
+                    }
+                    result += horizontalSum(acc);
+                    for (; entry < entryEnd; ++entry) {
+                        result += values[entry] * x[columns[entry]];
+                    }
+                    return result;
+                }
+
+                STORM_SIMD_TARGET_AVX2 inline double rowDot(double const* values, uint64_t const* columns, uint64_t entry, uint64_t entryEnd, double const* x, double result) {
+                    __m256d acc = _mm256_setzero_pd();
+                    for (; entry + 4 <= entryEnd; entry += 4) {
+                        __m256i indices = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(columns + entry));
+                        acc = _mm256_fmadd_pd(_mm256_loadu_pd(values + entry), _mm256_i64gather_pd(x, indices, 8), acc);
+                    }
+                    result += horizontalSum(acc);
+                    for (; entry < entryEnd; ++entry) {
+                        result += values[entry] * x[columns[entry]];
+                    }
+                    return result;
+                }
+
+                template<bool Minimize>
+                STORM_SIMD_TARGET_AVX2 inline double extremum(double const* values, uint64_t size) {
+                    __m256d best = _mm256_set1_pd(values[0]);
+                    uint64_t i = 0;
+                    for (; i + 4 <= size; i += 4) {
+                        __m256d current = _mm256_loadu_pd(values + i);
+                        best = Minimize ? _mm256_min_pd(best, current) : _mm256_max_pd(best, current);
+                    }
+                    __m128d half = Minimize ? _mm_min_pd(_mm256_castpd256_pd128(best), _mm256_extractf128_pd(best, 1)) : _mm_max_pd(_mm256_castpd256_pd128(best), _mm256_extractf128_pd(best, 1));
+                    half = Minimize ? _mm_min_sd(half, _mm_unpackhi_pd(half, half)) : _mm_max_sd(half, _mm_unpackhi_pd(half, half));
+                    double result = _mm_cvtsd_f64(half);
+                    for (; i < size; ++i) {
+                        result = Minimize ? std::min(result, values[i]) : std::max(result, values[i]);
+                    }
+                    return result;
+                }
+
+                template<bool Backward, typename ColumnType>
+                STORM_SIMD_TARGET_AVX2 void multAdd(storm::storage::SoaSparseMatrix<double> const& matrix, std::vector<ColumnType> const& columns, std::vector<double> const& x, std::vector<double> const* b, std::vector<double>& result) {
+                    double const* values = matrix.getValues().data();
+                    uint64_t const* rowIndications = matrix.getRowIndications().data();
+                    uint64_t const rowCount = matrix.getRowCount();
+                    for (uint64_t i = 0; i < rowCount; ++i) {
+                        uint64_t const row = Backward ? rowCount - 1 - i : i;
+                        result[row] = rowDot(values, columns.data(), rowIndications[row], rowIndications[row + 1], x.data(), b ? (*b)[row] : 0.0);
+                    }
+                }
+
+                template<bool Minimize, bool Backward, typename ColumnType>
+                STORM_SIMD_TARGET_AVX2 void multAddReduce(storm::storage::SoaSparseMatrix<double> const& matrix, std::vector<ColumnType> const& columns, std::vector<uint64_t> const& rowGroupIndices, std::vector<double> const& x, std::vector<double> const* b, std::vector<double>& result, std::vector<uint64_t>* choices, std::vector<double>& buffer) {
+                    typedef typename std::conditional<Minimize, storm::utility::ElementLess<double>, storm::utility::ElementGreater<double>>::type Compare;
+                    Compare compare;
+                    double const* values = matrix.getValues().data();
+                    uint64_t const* rowIndications = matrix.getRowIndications().data();
+                    uint64_t const groupCount = rowGroupIndices.size() - 1;
+                    for (uint64_t i = 0; i < groupCount; ++i) {
+                        uint64_t const group = Backward ? groupCount - 1 - i : i;
+                        uint64_t const groupStart = rowGroupIndices[group];
+                        uint64_t const groupSize = rowGroupIndices[group + 1] - groupStart;
+                        // Empty row groups are skipped and keep their previous value.
+                        if (groupSize == 0) {
+                            continue;
+                        } else if (groupSize == 1) {
+                            result[group] = rowDot(values, columns.data(), rowIndications[groupStart], rowIndications[groupStart + 1], x.data(), b ? (*b)[groupStart] : 0.0);
+                            continue;
+                        }
+
+                        for (uint64_t offset = 0; offset < groupSize; ++offset) {
+                            uint64_t const row = groupStart + offset;
+                            buffer[offset] = rowDot(values, columns.data(), rowIndications[row], rowIndications[row + 1], x.data(), b ? (*b)[row] : 0.0);
+                        }
+                        double const best = extremum<Minimize>(buffer.data(), groupSize);
+                        result[group] = best;
+
+                        // Only update the choice if the new choice is strictly better than the previous one.
+                        if (choices) {
+                            uint64_t& choice = (*choices)[group];
+                            uint64_t selectedChoice = findChoice<Backward>(buffer.data(), groupSize, best);
+                            if (choice >= groupSize || compare(best, buffer[choice])) {
+                                choice = selectedChoice;
+                            }
+                        }
+                    }
+                }
+            }
+
+            namespace avx512 {
+                STORM_SIMD_TARGET_AVX512 inline double rowDot(double const* values, uint32_t const* columns, uint64_t entry, uint64_t entryEnd, double const* x, double result) {
+                    __m512d acc = _mm512_setzero_pd();
+                    for (; entry + 8 <= entryEnd; entry += 8) {
+                        __m256i indices = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(columns + entry));
+                        acc = _mm512_fmadd_pd(_mm512_loadu_pd(values + entry), _mm512_i32gather_pd(indices, x, 8), acc);
+                    }
+                    result += _mm512_reduce_add_pd(acc);
+                    for (; entry < entryEnd; ++entry) {
+                        result += values[entry] * x[columns[entry]];
+                    }
+                    return result;
+                }
+
+                STORM_SIMD_TARGET_AVX512 inline double rowDot(double const* values, uint64_t const* columns, uint64_t entry, uint64_t entryEnd, double const* x, double result) {
+                    __m512d acc = _mm512_setzero_pd();
+                    for (; entry + 8 <= entryEnd; entry += 8) {
+                        __m512i indices = _mm512_loadu_si512(columns + entry);
+                        acc = _mm512_fmadd_pd(_mm512_loadu_pd(values + entry), _mm512_i64gather_pd(indices, x, 8), acc);
+                    }
+                    result += _mm512_reduce_add_pd(acc);
+                    for (; entry < entryEnd; ++entry) {
+                        result += values[entry] * x[columns[entry]];
+                    }
+                    return result;
+                }
+
+                template<bool Minimize>
+                STORM_SIMD_TARGET_AVX512 inline double extremum(double const* values, uint64_t size) {
+                    __m512d best = _mm512_set1_pd(values[0]);
+                    uint64_t i = 0;
+                    for (; i + 8 <= size; i += 8) {
+                        __m512d current = _mm512_loadu_pd(values + i);
+                        best = Minimize ? _mm512_min_pd(best, current) : _mm512_max_pd(best, current);
+                    }
+                    double result = Minimize ? _mm512_reduce_min_pd(best) : _mm512_reduce_max_pd(best);
+                    for (; i < size; ++i) {
+                        result = Minimize ? std::min(result, values[i]) : std::max(result, values[i]);
+                    }
+                    return result;
+                }
+
+                template<bool Backward, typename ColumnType>
+                STORM_SIMD_TARGET_AVX512 void multAdd(storm::storage::SoaSparseMatrix<double> const& matrix, std::vector<ColumnType> const& columns, std::vector<double> const& x, std::vector<double> const* b, std::vector<double>& result) {
+                    double const* values = matrix.getValues().data();
+                    uint64_t const* rowIndications = matrix.getRowIndications().data();
+                    uint64_t const rowCount = matrix.getRowCount();
+                    for (uint64_t i = 0; i < rowCount; ++i) {
+                        uint64_t const row = Backward ? rowCount - 1 - i : i;
+                        result[row] = rowDot(values, columns.data(), rowIndications[row], rowIndications[row + 1], x.data(), b ? (*b)[row] : 0.0);
+                    }
+                }
+
+                template<bool Minimize, bool Backward, typename ColumnType>
+                STORM_SIMD_TARGET_AVX512 void multAddReduce(storm::storage::SoaSparseMatrix<double> const& matrix, std::vector<ColumnType> const& columns, std::vector<uint64_t> const& rowGroupIndices, std::vector<double> const& x, std::vector<double> const* b, std::vector<double>& result, std::vector<uint64_t>* choices, std::vector<double>& buffer) {
+                    typedef typename std::conditional<Minimize, storm::utility::ElementLess<double>, storm::utility::ElementGreater<double>>::type Compare;
+                    Compare compare;
+                    double const* values = matrix.getValues().data();
+                    uint64_t const* rowIndications = matrix.getRowIndications().data();
+                    uint64_t const groupCount = rowGroupIndices.size() - 1;
+                    for (uint64_t i = 0; i < groupCount; ++i) {
+                        uint64_t const group = Backward ? groupCount - 1 - i : i;
+                        uint64_t const groupStart = rowGroupIndices[group];
+                        uint64_t const groupSize = rowGroupIndices[group + 1] - groupStart;
+                        // Empty row groups are skipped and keep their previous value.
+                        if (groupSize == 0) {
+                            continue;
+                        } else if (groupSize == 1) {
+                            result[group] = rowDot(values, columns.data(), rowIndications[groupStart], rowIndications[groupStart + 1], x.data(), b ? (*b)[groupStart] : 0.0);
+                            continue;
+                        }
+
+                        for (uint64_t offset = 0; offset < groupSize; ++offset) {
+                            uint64_t const row = groupStart + offset;
+                            buffer[offset] = rowDot(values, columns.data(), rowIndications[row], rowIndications[row + 1], x.data(), b ? (*b)[row] : 0.0);
+                        }
+                        double const best = extremum<Minimize>(buffer.data(), groupSize);
+                        result[group] = best;
+
+                        // Only update the choice if the new choice is strictly better than the previous one.
+                        if (choices) {
+                            uint64_t& choice = (*choices)[group];
+                            uint64_t selectedChoice = findChoice<Backward>(buffer.data(), groupSize, best);
+                            if (choice >= groupSize || compare(best, buffer[choice])) {
+                                choice = selectedChoice;
+                            }
+                        }
+                    }
+                }
+            }
+
+#endif
+
+            template<typename ValueType>
+            bool multAddVectorized(storm::utility::simd::SimdLevel, storm::storage::SoaSparseMatrix<ValueType> const&, std::vector<ValueType> const&, std::vector<ValueType> const*, std::vector<ValueType>&, bool) {
+                return false;
+            }
+
+            template<bool Backward, typename ColumnType>
+            bool multAddVectorized(storm::utility::simd::SimdLevel level, storm::storage::SoaSparseMatrix<double> const& matrix, std::vector<ColumnType> const& columns, std::vector<double> const& x, std::vector<double> const* b, std::vector<double>& result) {
+#ifdef STORM_HAVE_X86_SIMD_DISPATCH
+                if (level == storm::utility::simd::SimdLevel::Avx512) {
+                    avx512::multAdd<Backward>(matrix, columns, x, b, result);
+                    return true;
+                } else if (level == storm::utility::simd::SimdLevel::Avx2) {
+                    avx2::multAdd<Backward>(matrix, columns, x, b, result);
+                    return true;
+                }
+#endif
+                return false;
+            }
+
+            bool multAddVectorized(storm::utility::simd::SimdLevel level, storm::storage::SoaSparseMatrix<double> const& matrix, std::vector<double> const& x, std::vector<double> const* b, std::vector<double>& result, bool backwards) {
+                if (matrix.hasNarrowColumnIndices()) {
+                    return backwards ? multAddVectorized<true>(level, matrix, matrix.getNarrowColumns(), x, b, result) : multAddVectorized<false>(level, matrix, matrix.getNarrowColumns(), x, b, result);
+                } else {
+                    return backwards ? multAddVectorized<true>(level, matrix, matrix.getWideColumns(), x, b, result) : multAddVectorized<false>(level, matrix, matrix.getWideColumns(), x, b, result);
+                }
+            }
+
+            template<typename ValueType>
+            bool multAddReduceVectorized(storm::utility::simd::SimdLevel, storm::storage::SoaSparseMatrix<ValueType> const&, OptimizationDirection const&, std::vector<uint64_t> const&, std::vector<ValueType> const&, std::vector<ValueType> const*, std::vector<ValueType>&, std::vector<uint64_t>*, bool, std::vector<ValueType>&) {
+                return false;
+            }
+
+            template<bool Minimize, bool Backward, typename ColumnType>
+            bool multAddReduceVectorized(storm::utility::simd::SimdLevel level, storm::storage::SoaSparseMatrix<double> const& matrix, std::vector<ColumnType> const& columns, std::vector<uint64_t> const& rowGroupIndices, std::vector<double> const& x, std::vector<double> const* b, std::vector<double>& result, std::vector<uint64_t>* choices, std::vector<double>& buffer) {
+#ifdef STORM_HAVE_X86_SIMD_DISPATCH
+                if (level == storm::utility::simd::SimdLevel::Avx512) {
+                    avx512::multAddReduce<Minimize, Backward>(matrix, columns, rowGroupIndices, x, b, result, choices, buffer);
+                    return true;
+                } else if (level == storm::utility::simd::SimdLevel::Avx2) {
+                    avx2::multAddReduce<Minimize, Backward>(matrix, columns, rowGroupIndices, x, b, result, choices, buffer);
+                    return true;
+                }
+#endif
+                return false;
+            }
+
+            template<bool Minimize, bool Backward>
+            bool multAddReduceVectorized(storm::utility::simd::SimdLevel level, storm::storage::SoaSparseMatrix<double> const& matrix, std::vector<uint64_t> const& rowGroupIndices, std::vector<double> const& x, std::vector<double> const* b, std::vector<double>& result, std::vector<uint64_t>* choices, std::vector<double>& buffer) {
+                if (matrix.hasNarrowColumnIndices()) {
+                    return multAddReduceVectorized<Minimize, Backward>(level, matrix, matrix.getNarrowColumns(), rowGroupIndices, x, b, result, choices, buffer);
+                } else {
+                    return multAddReduceVectorized<Minimize, Backward>(level, matrix, matrix.getWideColumns(), rowGroupIndices, x, b, result, choices, buffer);
+                }
+            }
+
+            bool multAddReduceVectorized(storm::utility::simd::SimdLevel level, storm::storage::SoaSparseMatrix<double> const& matrix, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<double> const& x, std::vector<double> const* b, std::vector<double>& result, std::vector<uint64_t>* choices, bool backwards, std::vector<double>& buffer) {
+                if (minimize(dir)) {
+                    return backwards ? multAddReduceVectorized<true, true>(level, matrix, rowGroupIndices, x, b, result, choices, buffer) : multAddReduceVectorized<true, false>(level, matrix, rowGroupIndices, x, b, result, choices, buffer);
+                } else {
+                    return backwards ? multAddReduceVectorized<false, true>(level, matrix, rowGroupIndices, x, b, result, choices, buffer) : multAddReduceVectorized<false, false>(level, matrix, rowGroupIndices, x, b, result, choices, buffer);
+                }
+            }
+        }
+
+        template<typename ValueType>
+        SimdMultiplier<ValueType>::SimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : Multiplier<ValueType>(matrix) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::initialize() const {
+            if (!soaMatrix) {
+                // The gather instructions interpret 32 bit indices as signed integers.
+                bool allowNarrowColumnIndices = this->matrix.getColumnCount() <= static_cast<uint64_t>(std::numeric_limits<int32_t>::max());
+                soaMatrix = std::make_unique<storm::storage::SoaSparseMatrix<ValueType>>(this->matrix, allowNarrowColumnIndices);
+                rowGroupBuffer.resize(this->matrix.getSizeOfLargestRowGroup());
+                STORM_LOG_INFO("Using " << storm::utility::simd::toString(getSimdLevel()) << " kernels for matrix-vector multiplication.");
+            }
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::clearCache() const {
+            soaMatrix.reset();
+            rowGroupBuffer = std::vector<ValueType>();
+            Multiplier<ValueType>::clearCache();
+        }
+
+        template<typename ValueType>
+        storm::utility::simd::SimdLevel SimdMultiplier<ValueType>::getSimdLevel() const {
+            if (std::is_same<ValueType, double>::value) {
+                return storm::utility::simd::getSupportedSimdLevel();
+            }
+            return storm::utility::simd::SimdLevel::Scalar;
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            initialize();
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize(x.size());
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+                }
+                target = this->cachedVector.get();
+            }
+            multAdd(x, b, *target);
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const {
+            initialize();
+            if (!detail::multAddVectorized(getSimdLevel(), *soaMatrix, x, b, x, backwards)) {
+                if (backwards) {
+                    soaMatrix->multiplyWithVectorBackward(x, x, b);
+                } else {
+                    soaMatrix->multiplyWithVectorForward(x, x, b);
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            initialize();
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize(x.size());
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+                }
+                target = this->cachedVector.get();
+            }
+            multAddReduce(dir, rowGroupIndices, x, b, *target, choices, false);
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
+            initialize();
+            multAddReduce(dir, rowGroupIndices, x, b, x, choices, backwards);
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x1, std::vector<ValueType>& result1, std::vector<ValueType> const& x2, std::vector<ValueType>& result2, std::vector<ValueType> const* b) const {
+            // Make sure that the matrix is not converted concurrently.
+            initialize();
+            Multiplier<ValueType>::multiplyAndReduce2(env, dir, x1, result1, x2, result2, b);
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
+            initialize();
+            soaMatrix->multiplyRow(rowIndex, x, value);
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2, ValueType& val2) const {
+            initialize();
+            soaMatrix->multiplyRow2(rowIndex, x1, val1, x2, val2);
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            if (!detail::multAddVectorized(getSimdLevel(), *soaMatrix, x, b, result, false)) {
+                soaMatrix->multiplyWithVector(x, result, b);
+            }
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices, bool backwards) const {
+            // The buffer needs to be able to hold all rows of a group, which need not be the groups of the matrix.
+            if (&rowGroupIndices != &this->matrix.getRowGroupIndices()) {
+                for (uint64_t group = 0; group + 1 < rowGroupIndices.size(); ++group) {
+                    if (rowGroupIndices[group + 1] - rowGroupIndices[group] > rowGroupBuffer.size()) {
+                        rowGroupBuffer.resize(rowGroupIndices[group + 1] - rowGroupIndices[group]);
+                    }
+                }
+            }
+            if (!detail::multAddReduceVectorized(getSimdLevel(), *soaMatrix, dir, rowGroupIndices, x, b, result, choices, backwards, rowGroupBuffer)) {
+                if (backwards) {
+                    soaMatrix->multiplyAndReduceBackward(dir, rowGroupIndices, x, b, result, choices);
+                } else {
+                    soaMatrix->multiplyAndReduceForward(dir, rowGroupIndices, x, b, result, choices);
+                }
+            }
+        }
+
+        template class SimdMultiplier<double>;
+#ifdef STORM_HAVE_CARL
+        template class SimdMultiplier<storm::RationalNumber>;
+        template class SimdMultiplier<storm::RationalFunction>;
+#endif
+
+    }
+}
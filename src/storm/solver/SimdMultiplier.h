@@ -0,0 +1,56 @@
+#pragma once
+
+#include "storm/solver/Multiplier.h"
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/SoaSparseMatrix.h"
+#include "storm/utility/simd.h"
+
+namespace storm {
+    namespace storage {
+        template<typename ValueType>
+        class SparseMatrix;
+    }
+
+    namespace solver {
+
+        /*!
+         * A multiplier that uses explicitly vectorized kernels (AVX2 or AVX-512, selected at runtime depending on the
+         * executing CPU) on a structure-of-arrays representation of the matrix. The kernels gather the vector entries
+         * over the column indices, use fused multiply-adds and reduce over the row groups with vector min/max operations.
+         * For value types other than double (or if the CPU does not support the extensions), scalar kernels are used.
+         */
+        template<typename ValueType>
+        class SimdMultiplier : public Multiplier<ValueType> {
+        public:
+            SimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
+            virtual ~SimdMultiplier() = default;
+
+            virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
+            virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
+            virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const override;
+            virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr, bool backwards = true) const override;
+            virtual void multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x1, std::vector<ValueType>& result1, std::vector<ValueType> const& x2, std::vector<ValueType>& result2, std::vector<ValueType> const* b) const override;
+            virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
+            virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2, ValueType& val2) const override;
+            virtual void clearCache() const override;
+
+            /*!
+             * Retrieves the instruction set extension used by the kernels of this multiplier.
+             */
+            storm::utility::simd::SimdLevel getSimdLevel() const;
+
+        private:
+            void initialize() const;
+
+            void multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+            void multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices, bool backwards) const;
+
+            mutable std::unique_ptr<storm::storage::SoaSparseMatrix<ValueType>> soaMatrix;
+
+            // A buffer that holds the values of the rows of one row group during the reduction.
+            mutable std::vector<ValueType> rowGroupBuffer;
+        };
+
+    }
+}
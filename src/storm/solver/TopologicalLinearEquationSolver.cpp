@@ -1,11 +1,14 @@
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/solver/helper/TopologicalSccScheduler.h"
 
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/PerformanceCounters.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/UnexpectedException.h"
@@ -64,7 +67,13 @@ namespace storm {
             if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
                 STORM_LOG_TRACE("Creating SCC decomposition.");
                 storm::utility::Stopwatch sccSw(true);
-                createSortedSccDecomposition(needAdaptPrecision);
+                {
+                    storm::utility::PerformanceCounters::Scope scope(env.getPerformanceCounters(), "SCC decomposition");
+                    createSortedSccDecomposition(needAdaptPrecision);
+                    if (env.hasPerformanceCounters()) {
+                        env.getPerformanceCounters()->addToCounter("SCCs", this->sortedSccDecomposition->size());
+                    }
+                }
                 sccSw.stop();
                 STORM_LOG_INFO("SCC decomposition computed in " << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size() << " states. Average SCC size is " << static_cast<double>(this->getMatrixRowCount()) / static_cast<double>(this->sortedSccDecomposition->size()) << ".");
             }
@@ -82,7 +91,11 @@ namespace storm {
             bool returnValue = true;
             if (this->sortedSccDecomposition->size() == 1) {
                 returnValue = solveFullyConnectedEquationSystem(sccSolverEnvironment, x, b);
+            } else if (env.solver().topological().isParallelSet() && storm::utility::parallel::getNumberOfThreads() > 1 && !std::is_same<ValueType, storm::RationalFunction>::value) {
+                // Rational functions are excluded as their (shared) caches are not thread-safe.
+                returnValue = solveSccsInParallel(sccSolverEnvironment, x, b);
             } else {
+                STORM_LOG_WARN_COND(!env.solver().topological().isParallelSet() || !(std::is_same<ValueType, storm::RationalFunction>::value), "Solving SCCs in parallel is not supported for rational functions. Falling back to sequential solving.");
                 // Solve each SCC individually
                 storm::storage::BitVector sccAsBitVector(x.size(), false);
                 uint64_t sccIndex = 0;
@@ -97,7 +110,7 @@ namespace storm {
                         for (auto const& state : scc) {
                             sccAsBitVector.set(state, true);
                         }
-                        returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b) && returnValue;
+                        returnValue = solveScc(sccSolverEnvironment, this->sccSolver, sccAsBitVector, x, b) && returnValue;
                     }
                     ++sccIndex;
                     progress.updateProgress(sccIndex);
@@ -173,21 +186,21 @@ namespace storm {
         }
         
         template<typename ValueType>
-        bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+        bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
             
             // Set up the SCC solver
-            if (!this->sccSolver) {
-                this->sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-                this->sccSolver->setCachingEnabled(true);
+            if (!sccSolver) {
+                sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+                sccSolver->setCachingEnabled(true);
             }
             
             // Matrix
-            bool asEquationSystem = this->sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
+            bool asEquationSystem = sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
             storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, scc, scc, asEquationSystem);
             if (asEquationSystem) {
                 sccA.convertToEquationSystem();
             }
-            this->sccSolver->setMatrix(std::move(sccA));
+            sccSolver->setMatrix(std::move(sccA));
             
             // x Vector
             auto sccX = storm::utility::vector::filterVector(globalX, scc);
@@ -207,24 +220,79 @@ namespace storm {
             
             // lower/upper bounds
             if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setLowerBound(this->getLowerBound());
+                sccSolver->setLowerBound(this->getLowerBound());
             } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
+                sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
             }
             if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setUpperBound(this->getUpperBound());
+                sccSolver->setUpperBound(this->getUpperBound());
             } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
+                sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
             }
             
             //std::cout << "rhs is " << storm::utility::vector::toString(sccB) << std::endl;
             //std::cout << "x is " << storm::utility::vector::toString(sccX) << std::endl;
             
-            bool returnvalue = this->sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
+            bool returnvalue = sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
             storm::utility::vector::setVectorValues(globalX, scc, sccX);
             return returnvalue;
         }
         
+        template<typename ValueType>
+        bool TopologicalLinearEquationSolver<ValueType>::solveSccsInParallel(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            storm::solver::helper::TopologicalSccScheduler<ValueType> scheduler(*this->A, *this->sortedSccDecomposition);
+            STORM_LOG_INFO("Solving SCCs with " << scheduler.getNumberOfWorkers() << " workers.");
+            
+            // Every worker has its own solver and its own auxiliary data. The environment is copied as well, because
+            // its sub-environments are created lazily on first access, which must not happen concurrently.
+            struct WorkerData {
+                WorkerData(storm::Environment const& environment, uint64_t size) : environment(environment), sccAsBitVector(size, false), returnValue(true) {
+                    // Intentionally left empty.
+                }
+                
+                storm::Environment environment;
+                std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> sccSolver;
+                storm::storage::BitVector sccAsBitVector;
+                bool returnValue;
+            };
+            std::vector<WorkerData> workerData;
+            workerData.reserve(scheduler.getNumberOfWorkers());
+            for (uint64_t worker = 0; worker < scheduler.getNumberOfWorkers(); ++worker) {
+                workerData.emplace_back(sccSolverEnvironment, x.size());
+            }
+            
+            storm::utility::ProgressMeasurement progress("states");
+            progress.setMaxCount(x.size());
+            progress.startNewMeasurement(0);
+            uint64_t processedSccs = scheduler.execute([&] (uint64_t worker, uint64_t sccIndex) {
+                auto const& scc = this->sortedSccDecomposition->getBlock(sccIndex);
+                WorkerData& data = workerData[worker];
+                if (scc.size() == 1) {
+                    data.returnValue = solveTrivialScc(*scc.begin(), x, b) && data.returnValue;
+                } else {
+                    for (auto const& state : scc) {
+                        data.sccAsBitVector.set(state, true);
+                    }
+                    data.returnValue = solveScc(data.environment, data.sccSolver, data.sccAsBitVector, x, b) && data.returnValue;
+                    // Only reset the bits of this SCC, which is cheaper than clearing the whole bit vector.
+                    for (auto const& state : scc) {
+                        data.sccAsBitVector.set(state, false);
+                    }
+                }
+                return !storm::utility::resources::isTerminate();
+            }, [&progress] (uint64_t processedSccs) { progress.updateProgress(processedSccs); });
+            
+            if (processedSccs < this->sortedSccDecomposition->size()) {
+                STORM_LOG_WARN("Topological solver aborted after analyzing " << processedSccs << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+            }
+            
+            bool returnValue = true;
+            for (auto const& data : workerData) {
+                returnValue = data.returnValue && returnValue;
+            }
+            return returnValue;
+        }
+        
         template<typename ValueType>
         LinearEquationSolverProblemFormat TopologicalLinearEquationSolver<ValueType>::getEquationProblemFormat(Environment const& env) const {
             return LinearEquationSolverProblemFormat::FixedPointSystem;
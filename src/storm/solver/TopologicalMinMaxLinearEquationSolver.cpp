@@ -2,11 +2,14 @@
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/solver/helper/TopologicalSccScheduler.h"
 
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/PerformanceCounters.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/UnexpectedException.h"
@@ -54,7 +57,13 @@ namespace storm {
             if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
                 STORM_LOG_TRACE("Creating SCC decomposition.");
                 storm::utility::Stopwatch sccSw(true);
-                createSortedSccDecomposition(needAdaptPrecision);
+                {
+                    storm::utility::PerformanceCounters::Scope scope(env.getPerformanceCounters(), "SCC decomposition");
+                    createSortedSccDecomposition(needAdaptPrecision);
+                    if (env.hasPerformanceCounters()) {
+                        env.getPerformanceCounters()->addToCounter("SCCs", this->sortedSccDecomposition->size());
+                    }
+                }
                 sccSw.stop();
                 STORM_LOG_INFO("SCC decomposition computed in " << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size() << " states. Average SCC size is " << static_cast<double>(this->A->getRowGroupCount()) / static_cast<double>(this->sortedSccDecomposition->size()) << ".");
             }
@@ -81,32 +90,36 @@ namespace storm {
                         this->schedulerChoices = std::vector<uint64_t>(x.size());
                     }
                 }
-                storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
-                storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
-                uint64_t sccIndex = 0;
-                storm::utility::ProgressMeasurement progress("states");
-                progress.setMaxCount(x.size());
-                progress.startNewMeasurement(0);
-                for (auto const& scc : *this->sortedSccDecomposition) {
-                    if (scc.size() == 1) {
-                        returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
-                    } else {
-                        STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
-                        sccRowGroupsAsBitVector.clear();
-                        sccRowsAsBitVector.clear();
-                        for (auto const& group : scc) {
-                            sccRowGroupsAsBitVector.set(group, true);
-                            for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
-                                sccRowsAsBitVector.set(row, true);
+                if (env.solver().topological().isParallelSet() && storm::utility::parallel::getNumberOfThreads() > 1) {
+                    returnValue = solveSccsInParallel(sccSolverEnvironment, dir, x, b);
+                } else {
+                    storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
+                    storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
+                    uint64_t sccIndex = 0;
+                    storm::utility::ProgressMeasurement progress("states");
+                    progress.setMaxCount(x.size());
+                    progress.startNewMeasurement(0);
+                    for (auto const& scc : *this->sortedSccDecomposition) {
+                        if (scc.size() == 1) {
+                            returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
+                        } else {
+                            STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+                            sccRowGroupsAsBitVector.clear();
+                            sccRowsAsBitVector.clear();
+                            for (auto const& group : scc) {
+                                sccRowGroupsAsBitVector.set(group, true);
+                                for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                                    sccRowsAsBitVector.set(row, true);
+                                }
                             }
+                            returnValue = solveScc(sccSolverEnvironment, dir, this->sccSolver, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
+                        }
+                        ++sccIndex;
+                        progress.updateProgress(sccIndex);
+                        if (storm::utility::resources::isTerminate()) {
+                            STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+                            break;
                         }
-                        returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
-                    }
-                    ++sccIndex;
-                    progress.updateProgress(sccIndex);
-                    if (storm::utility::resources::isTerminate()) {
-                        STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                        break;
                     }
                 }
                 
@@ -230,21 +243,21 @@ namespace storm {
         }
         
         template<typename ValueType>
-        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
             
             // Set up the SCC solver
-            if (!this->sccSolver) {
-                this->sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-                this->sccSolver->setCachingEnabled(true);
+            if (!sccSolver) {
+                sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+                sccSolver->setCachingEnabled(true);
             }
-            this->sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
-            this->sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
-            this->sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
+            sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
+            sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
+            sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
             
             // SCC Matrix
             storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, sccRowGroups, sccRowGroups);
             //std::cout << "Matrix is " << sccA << std::endl;
-            this->sccSolver->setMatrix(std::move(sccA));
+            sccSolver->setMatrix(std::move(sccA));
             
             // x Vector
             auto sccX = storm::utility::vector::filterVector(globalX, sccRowGroups);
@@ -265,23 +278,23 @@ namespace storm {
             // initial scheduler
             if (this->hasInitialScheduler()) {
                 auto sccInitChoices = storm::utility::vector::filterVector(this->getInitialScheduler(), sccRowGroups);
-                this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+                sccSolver->setInitialScheduler(std::move(sccInitChoices));
             }
             
             // lower/upper bounds
             if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setLowerBound(this->getLowerBound());
+                sccSolver->setLowerBound(this->getLowerBound());
             } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
+                sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
             }
             if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setUpperBound(this->getUpperBound());
+                sccSolver->setUpperBound(this->getUpperBound());
             } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
+                sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
             }
             
             // Requirements
-            auto req = this->sccSolver->getRequirements(sccSolverEnvironment, dir);
+            auto req = sccSolver->getRequirements(sccSolverEnvironment, dir);
             if (req.upperBounds() && this->hasUpperBound()) {
                 req.clearUpperBounds();
             }
@@ -295,16 +308,16 @@ namespace storm {
                 req.clearUniqueSolution();
             }
             STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-            this->sccSolver->setRequirementsChecked(true);
+            sccSolver->setRequirementsChecked(true);
 
             // Invoke scc solver
-            bool res = this->sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
+            bool res = sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
             //std::cout << "rhs is " << storm::utility::vector::toString(sccB) << std::endl;
             //std::cout << "x is " << storm::utility::vector::toString(sccX) << std::endl;
             
             // Set Scheduler choices
             if (this->isTrackSchedulerSet()) {
-                storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, this->sccSolver->getSchedulerChoices());
+                storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, sccSolver->getSchedulerChoices());
             }
             
             // Set solution
@@ -313,6 +326,69 @@ namespace storm {
             return res;
         }
         
+        template<typename ValueType>
+        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveSccsInParallel(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            storm::solver::helper::TopologicalSccScheduler<ValueType> scheduler(*this->A, *this->sortedSccDecomposition);
+            STORM_LOG_INFO("Solving SCCs with " << scheduler.getNumberOfWorkers() << " workers.");
+
+            // Every worker has its own solver and its own auxiliary data. The environment is copied as well, because
+            // its sub-environments are created lazily on first access, which must not happen concurrently.
+            struct WorkerData {
+                WorkerData(storm::Environment const& environment, uint64_t rowGroupCount, uint64_t rowCount) : environment(environment), sccRowGroups(rowGroupCount, false), sccRows(rowCount, false), returnValue(true) {
+                    // Intentionally left empty.
+                }
+
+                storm::Environment environment;
+                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> sccSolver;
+                storm::storage::BitVector sccRowGroups;
+                storm::storage::BitVector sccRows;
+                bool returnValue;
+            };
+            std::vector<WorkerData> workerData;
+            workerData.reserve(scheduler.getNumberOfWorkers());
+            for (uint64_t worker = 0; worker < scheduler.getNumberOfWorkers(); ++worker) {
+                workerData.emplace_back(sccSolverEnvironment, x.size(), b.size());
+            }
+
+            storm::utility::ProgressMeasurement progress("states");
+            progress.setMaxCount(x.size());
+            progress.startNewMeasurement(0);
+            uint64_t processedSccs = scheduler.execute([&] (uint64_t worker, uint64_t sccIndex) {
+                auto const& scc = this->sortedSccDecomposition->getBlock(sccIndex);
+                WorkerData& data = workerData[worker];
+                if (scc.size() == 1) {
+                    data.returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && data.returnValue;
+                } else {
+                    STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+                    for (auto const& group : scc) {
+                        data.sccRowGroups.set(group, true);
+                        for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                            data.sccRows.set(row, true);
+                        }
+                    }
+                    data.returnValue = solveScc(data.environment, dir, data.sccSolver, data.sccRowGroups, data.sccRows, x, b) && data.returnValue;
+                    // Only reset the bits of this SCC, which is cheaper than clearing the whole bit vectors.
+                    for (auto const& group : scc) {
+                        data.sccRowGroups.set(group, false);
+                        for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                            data.sccRows.set(row, false);
+                        }
+                    }
+                }
+                return !storm::utility::resources::isTerminate();
+            }, [&progress] (uint64_t processedSccs) { progress.updateProgress(processedSccs); });
+
+            if (processedSccs < this->sortedSccDecomposition->size()) {
+                STORM_LOG_WARN("Topological solver aborted after analyzing " << processedSccs << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+            }
+
+            bool returnValue = true;
+            for (auto const& data : workerData) {
+                returnValue = data.returnValue && returnValue;
+            }
+            return returnValue;
+        }
+
         template<typename ValueType>
         MinMaxLinearEquationSolverRequirements TopologicalMinMaxLinearEquationSolver<ValueType>::getRequirements(Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& direction, bool const& hasInitialScheduler) const {
             // Return the requirements of the underlying solver
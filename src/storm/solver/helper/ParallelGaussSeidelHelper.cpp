@@ -0,0 +1,288 @@
+#include "storm/solver/helper/ParallelGaussSeidelHelper.h"
+
+#include "storm-config.h"
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            namespace detail {
+                // A comparison that never prefers a new row. Used for matrices with trivial row grouping.
+                template<typename ValueType>
+                struct NoCompare {
+                    bool operator()(ValueType const&, ValueType const&) const {
+                        return false;
+                    }
+                };
+            }
+
+            template<typename ValueType>
+            ParallelGaussSeidelHelper<ValueType>::ParallelGaussSeidelHelper(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t blockSize) : matrix(matrix) {
+                STORM_LOG_ASSERT(matrix.getRowGroupCount() == matrix.getColumnCount(), "Expecting a matrix that is square in terms of row groups.");
+                STORM_LOG_ASSERT(blockSize > 0, "Invalid block size.");
+
+                storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccDecomposition(matrix, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths());
+
+                // Sort the SCCs by their depth. SCCs of the same depth do not have transitions between each other.
+                uint64_t numberOfLevels = sccDecomposition.empty() ? 0 : sccDecomposition.getMaxSccDepth() + 1;
+                std::vector<std::vector<uint64_t>> sccsOfLevel(numberOfLevels);
+                for (uint64_t sccIndex = 0; sccIndex < sccDecomposition.size(); ++sccIndex) {
+                    sccsOfLevel[sccDecomposition.getSccDepth(sccIndex)].push_back(sccIndex);
+                }
+
+                groups.reserve(matrix.getRowGroupCount());
+                blockStarts.push_back(0);
+                levelStarts.push_back(0);
+                std::vector<uint64_t> splitBlockIndices;
+                for (auto const& sccIndices : sccsOfLevel) {
+                    for (auto const& sccIndex : sccIndices) {
+                        auto const& scc = sccDecomposition.getBlock(sccIndex);
+                        if (scc.size() > blockSize) {
+                            // Close the block that collects the small SCCs of this level (if any).
+                            if (groups.size() > blockStarts.back()) {
+                                blockStarts.push_back(groups.size());
+                            }
+                            // Split the SCC into blocks of (almost) equal size.
+                            uint64_t numberOfParts = (scc.size() + blockSize - 1) / blockSize;
+                            uint64_t partSize = (scc.size() + numberOfParts - 1) / numberOfParts;
+                            uint64_t inPart = 0;
+                            for (auto const& group : scc) {
+                                groups.push_back(group);
+                                if (++inPart == partSize) {
+                                    splitBlockIndices.push_back(blockStarts.size() - 1);
+                                    blockStarts.push_back(groups.size());
+                                    inPart = 0;
+                                }
+                            }
+                            if (inPart > 0) {
+                                splitBlockIndices.push_back(blockStarts.size() - 1);
+                                blockStarts.push_back(groups.size());
+                            }
+                        } else {
+                            groups.insert(groups.end(), scc.begin(), scc.end());
+                            if (groups.size() - blockStarts.back() >= blockSize) {
+                                blockStarts.push_back(groups.size());
+                            }
+                        }
+                    }
+                    if (groups.size() > blockStarts.back()) {
+                        blockStarts.push_back(groups.size());
+                    }
+                    levelStarts.push_back(blockStarts.size() - 1);
+                }
+                STORM_LOG_ASSERT(groups.size() == matrix.getRowGroupCount(), "Unexpected number of row groups in the partition.");
+
+                splitBlocks = storm::storage::BitVector(getNumberOfBlocks());
+                for (auto const& block : splitBlockIndices) {
+                    splitBlocks.set(block);
+                }
+                if (!splitBlocks.empty()) {
+                    groupToBlock.resize(matrix.getRowGroupCount());
+                    for (uint64_t block = 0; block < getNumberOfBlocks(); ++block) {
+                        for (uint64_t position = blockStarts[block]; position < blockStarts[block + 1]; ++position) {
+                            groupToBlock[groups[position]] = block;
+                        }
+                    }
+                }
+                STORM_LOG_DEBUG("Partitioned " << groups.size() << " row groups into " << getNumberOfBlocks() << " blocks (" << getNumberOfSplitBlocks() << " of them belong to split SCCs) on " << getNumberOfLevels() << " levels.");
+            }
+
+            template<typename ValueType>
+            uint64_t ParallelGaussSeidelHelper<ValueType>::getNumberOfLevels() const {
+                return levelStarts.size() - 1;
+            }
+
+            template<typename ValueType>
+            uint64_t ParallelGaussSeidelHelper<ValueType>::getNumberOfBlocks() const {
+                return blockStarts.size() - 1;
+            }
+
+            template<typename ValueType>
+            uint64_t ParallelGaussSeidelHelper<ValueType>::getNumberOfSplitBlocks() const {
+                return splitBlocks.getNumberOfSetBits();
+            }
+
+            template<typename ValueType>
+            void ParallelGaussSeidelHelper<ValueType>::multiplyGaussSeidel(std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const {
+                STORM_LOG_ASSERT(matrix.hasTrivialRowGrouping(), "Expecting a matrix with trivial row grouping.");
+                sweep<detail::NoCompare<ValueType>>(x, nullptr, b, nullptr, backwards);
+            }
+
+            template<typename ValueType>
+            void ParallelGaussSeidelHelper<ValueType>::multiplyAndReduceGaussSeidel(OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint64_t>* choices, bool backwards) const {
+                if (dir == storm::OptimizationDirection::Minimize) {
+                    sweep<storm::utility::ElementLess<ValueType>>(x, nullptr, b, choices, backwards);
+                } else {
+                    sweep<storm::utility::ElementGreater<ValueType>>(x, nullptr, b, choices, backwards);
+                }
+            }
+
+            template<typename ValueType>
+            void ParallelGaussSeidelHelper<ValueType>::multiplyAndReduceGaussSeidel2(OptimizationDirection const& dir, std::vector<ValueType>& x1, std::vector<ValueType>& x2, std::vector<ValueType> const* b, bool backwards) const {
+                if (dir == storm::OptimizationDirection::Minimize) {
+                    sweep<storm::utility::ElementLess<ValueType>>(x1, &x2, b, nullptr, backwards);
+                } else {
+                    sweep<storm::utility::ElementGreater<ValueType>>(x1, &x2, b, nullptr, backwards);
+                }
+            }
+
+#ifdef STORM_HAVE_CARL
+            template<>
+            void ParallelGaussSeidelHelper<storm::RationalFunction>::multiplyAndReduceGaussSeidel(OptimizationDirection const&, std::vector<storm::RationalFunction>&, std::vector<storm::RationalFunction> const*, std::vector<uint64_t>*, bool) const {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+            }
+
+            template<>
+            void ParallelGaussSeidelHelper<storm::RationalFunction>::multiplyAndReduceGaussSeidel2(OptimizationDirection const&, std::vector<storm::RationalFunction>&, std::vector<storm::RationalFunction>&, std::vector<storm::RationalFunction> const*, bool) const {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+            }
+#endif
+
+            template<typename ValueType>
+            template<typename Compare>
+            void ParallelGaussSeidelHelper<ValueType>::sweep(std::vector<ValueType>& x, std::vector<ValueType>* x2, std::vector<ValueType> const* b, std::vector<uint64_t>* choices, bool backwards) const {
+                for (uint64_t level = 0; level < getNumberOfLevels(); ++level) {
+                    uint64_t firstBlock = levelStarts[level];
+                    uint64_t lastBlock = levelStarts[level + 1];
+
+                    // Blocks of split SCCs read the values of their sibling blocks from the beginning of the level.
+                    for (uint64_t block = splitBlocks.getNextSetIndex(firstBlock); block < lastBlock; block = splitBlocks.getNextSetIndex(block + 1)) {
+                        if (levelStartValues.size() != x.size()) {
+                            levelStartValues.resize(x.size());
+                        }
+                        for (uint64_t position = blockStarts[block]; position < blockStarts[block + 1]; ++position) {
+                            levelStartValues[groups[position]] = x[groups[position]];
+                        }
+                        if (x2) {
+                            if (levelStartValues2.size() != x2->size()) {
+                                levelStartValues2.resize(x2->size());
+                            }
+                            for (uint64_t position = blockStarts[block]; position < blockStarts[block + 1]; ++position) {
+                                levelStartValues2[groups[position]] = (*x2)[groups[position]];
+                            }
+                        }
+                    }
+
+                    auto processBlock = [&] (uint64_t block) {
+                        if (splitBlocks.get(block)) {
+                            sweepBlock<Compare, true>(block, firstBlock, x, x2, b, choices, backwards);
+                        } else {
+                            sweepBlock<Compare, false>(block, firstBlock, x, x2, b, choices, backwards);
+                        }
+                    };
+                    if (lastBlock - firstBlock > 1) {
+                        storm::utility::parallel::parallelFor(firstBlock, lastBlock, 1, [&] (auto const& range) {
+                            for (uint64_t block = range.begin(); block < range.end(); ++block) {
+                                processBlock(block);
+                            }
+                        });
+                    } else if (lastBlock > firstBlock) {
+                        processBlock(firstBlock);
+                    }
+                }
+            }
+
+            template<typename ValueType>
+            template<typename Compare, bool Split>
+            void ParallelGaussSeidelHelper<ValueType>::sweepBlock(uint64_t block, uint64_t firstBlockOfLevel, std::vector<ValueType>& x, std::vector<ValueType>* x2, std::vector<ValueType> const* b, std::vector<uint64_t>* choices, bool backwards) const {
+                Compare compare;
+                std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+
+                auto multiplyRow = [&] (uint64_t row) {
+                    ValueType result = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                    for (auto entryIt = matrix.begin(row), entryIte = matrix.end(row); entryIt != entryIte; ++entryIt) {
+                        uint64_t column = entryIt->getColumn();
+                        if (Split && groupToBlock[column] != block && groupToBlock[column] >= firstBlockOfLevel) {
+                            result += entryIt->getValue() * levelStartValues[column];
+                        } else {
+                            result += entryIt->getValue() * x[column];
+                        }
+                    }
+                    return result;
+                };
+
+                auto multiplyRow2 = [&] (uint64_t row, ValueType& result1, ValueType& result2) {
+                    result1 = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                    result2 = result1;
+                    for (auto entryIt = matrix.begin(row), entryIte = matrix.end(row); entryIt != entryIte; ++entryIt) {
+                        uint64_t column = entryIt->getColumn();
+                        if (Split && groupToBlock[column] != block && groupToBlock[column] >= firstBlockOfLevel) {
+                            result1 += entryIt->getValue() * levelStartValues[column];
+                            result2 += entryIt->getValue() * levelStartValues2[column];
+                        } else {
+                            result1 += entryIt->getValue() * x[column];
+                            result2 += entryIt->getValue() * (*x2)[column];
+                        }
+                    }
+                };
+
+                uint64_t const blockStart = blockStarts[block];
+                uint64_t const blockEnd = blockStarts[block + 1];
+                for (uint64_t step = 0; step < blockEnd - blockStart; ++step) {
+                    uint64_t group = groups[backwards ? blockEnd - 1 - step : blockStart + step];
+                    uint64_t const groupStart = rowGroupIndices[group];
+                    uint64_t const groupEnd = rowGroupIndices[group + 1];
+
+                    // Only multiply and reduce if there is at least one row in the group.
+                    if (groupStart == groupEnd) {
+                        continue;
+                    }
+
+                    if (x2) {
+                        ValueType currentValue1, currentValue2, newValue1, newValue2;
+                        multiplyRow2(groupStart, currentValue1, currentValue2);
+                        for (uint64_t row = groupStart + 1; row < groupEnd; ++row) {
+                            multiplyRow2(row, newValue1, newValue2);
+                            if (compare(newValue1, currentValue1)) {
+                                currentValue1 = newValue1;
+                            }
+                            if (compare(newValue2, currentValue2)) {
+                                currentValue2 = newValue2;
+                            }
+                        }
+                        x[group] = currentValue1;
+                        (*x2)[group] = currentValue2;
+                        continue;
+                    }
+
+                    ValueType currentValue = multiplyRow(groupStart);
+                    uint64_t selectedChoice = 0;
+                    ValueType oldSelectedChoiceValue = currentValue;
+                    for (uint64_t row = groupStart + 1; row < groupEnd; ++row) {
+                        ValueType newValue = multiplyRow(row);
+                        if (choices && row - groupStart == (*choices)[group]) {
+                            oldSelectedChoiceValue = newValue;
+                        }
+                        if (compare(newValue, currentValue)) {
+                            currentValue = newValue;
+                            selectedChoice = row - groupStart;
+                        }
+                    }
+
+                    x[group] = currentValue;
+                    if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+                        (*choices)[group] = selectedChoice;
+                    }
+                }
+            }
+
+            template class ParallelGaussSeidelHelper<double>;
+#ifdef STORM_HAVE_CARL
+            template class ParallelGaussSeidelHelper<storm::RationalNumber>;
+            template class ParallelGaussSeidelHelper<storm::RationalFunction>;
+#endif
+        }
+    }
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+
+    namespace storage {
+        template<typename ValueType>
+        class SparseMatrix;
+    }
+
+    namespace solver {
+        namespace helper {
+
+            /*!
+             * Performs Gauss-Seidel sweeps in parallel. For this, the row groups of the (square) matrix are partitioned
+             * into blocks using the topological structure of the SCC decomposition: SCCs with the same depth do not depend
+             * on each other, so the blocks of one level can be swept concurrently (e.g. by the work-stealing scheduler of
+             * TBB) once the levels below have been processed. Within a block, the row groups are updated in Gauss-Seidel
+             * style.
+             *
+             * SCCs that are larger than the block size are split into several blocks. Whenever a block of a split SCC
+             * reads a value of another block of the same SCC, it uses the value from the beginning of the current level
+             * (Jacobi style) in order to avoid races. All other values are read in Gauss-Seidel style, so the result is
+             * identical to a sequential Gauss-Seidel sweep (in topological order) if no SCC needs to be split.
+             */
+            template<typename ValueType>
+            class ParallelGaussSeidelHelper {
+            public:
+                /*!
+                 * Computes the partition of the row groups of the given matrix.
+                 *
+                 * @param matrix The matrix. Needs to be square in terms of row groups.
+                 * @param blockSize The (approximate) number of row groups per block.
+                 */
+                ParallelGaussSeidelHelper(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t blockSize = 1024);
+
+                /*!
+                 * Performs one sweep x' = A*x + b where the rows are updated in place.
+                 */
+                void multiplyGaussSeidel(std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const;
+
+                /*!
+                 * Performs one sweep x' = min/max(A*x + b) where the row groups are updated in place. As for the other
+                 * reduce operations, a choice is only updated if the new choice is strictly better.
+                 */
+                void multiplyAndReduceGaussSeidel(OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint64_t>* choices, bool backwards) const;
+
+                /*!
+                 * Performs the sweeps x1' = min/max(A*x1 + b) and x2' = min/max(A*x2 + b) in a single pass over the
+                 * matrix, where the row groups of both vectors are updated in place.
+                 */
+                void multiplyAndReduceGaussSeidel2(OptimizationDirection const& dir, std::vector<ValueType>& x1, std::vector<ValueType>& x2, std::vector<ValueType> const* b, bool backwards) const;
+
+                /*!
+                 * Retrieves the number of levels, i.e., the number of sweeps that need to happen one after another.
+                 */
+                uint64_t getNumberOfLevels() const;
+
+                /*!
+                 * Retrieves the number of blocks.
+                 */
+                uint64_t getNumberOfBlocks() const;
+
+                /*!
+                 * Retrieves the number of blocks that belong to a split SCC.
+                 */
+                uint64_t getNumberOfSplitBlocks() const;
+
+            private:
+                // If the second vector is given, it is updated along with the first one (and no choices are tracked).
+                template<typename Compare, bool Split>
+                void sweepBlock(uint64_t block, uint64_t firstBlockOfLevel, std::vector<ValueType>& x, std::vector<ValueType>* x2, std::vector<ValueType> const* b, std::vector<uint64_t>* choices, bool backwards) const;
+
+                template<typename Compare>
+                void sweep(std::vector<ValueType>& x, std::vector<ValueType>* x2, std::vector<ValueType> const* b, std::vector<uint64_t>* choices, bool backwards) const;
+
+                // The matrix.
+                storm::storage::SparseMatrix<ValueType> const& matrix;
+
+                // The row groups, ordered by the blocks they belong to.
+                std::vector<uint64_t> groups;
+
+                // For each block the position of its first row group in the vector above (plus one past-the-end position).
+                std::vector<uint64_t> blockStarts;
+
+                // For each level the index of its first block (plus one past-the-end position).
+                std::vector<uint64_t> levelStarts;
+
+                // The blocks that belong to a split SCC.
+                storm::storage::BitVector splitBlocks;
+
+                // For each row group the block it belongs to. Only needed (and filled) if there are split blocks.
+                std::vector<uint64_t> groupToBlock;
+
+                // Holds the values of the split blocks at the beginning of the current level (for both vectors).
+                mutable std::vector<ValueType> levelStartValues;
+                mutable std::vector<ValueType> levelStartValues2;
+            };
+
+        }
+    }
+}
@@ -0,0 +1,185 @@
+#include "storm/solver/helper/TopologicalSccScheduler.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+
+#include "storm-config.h"
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            template<typename ValueType>
+            TopologicalSccScheduler<ValueType>::TopologicalSccScheduler(storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& decomposition, uint64_t batchSize) : decomposition(decomposition), batchSize(std::max<uint64_t>(batchSize, 1)) {
+                STORM_LOG_ASSERT(matrix.getRowGroupCount() == matrix.getColumnCount(), "Expecting a matrix that is square in terms of row groups.");
+                uint64_t const numberOfSccs = decomposition.size();
+                numberOfWorkers = std::max<uint64_t>(1, std::min<uint64_t>(storm::utility::parallel::getNumberOfThreads(), numberOfSccs));
+
+                std::vector<uint64_t> stateToScc(matrix.getRowGroupCount());
+                for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+                    for (auto const& state : decomposition.getBlock(sccIndex)) {
+                        stateToScc[state] = sccIndex;
+                    }
+                }
+
+                // Collect the distinct successor SCCs of each SCC. The marker avoids that an SCC is collected twice.
+                // Note that this also creates the row group indices of matrices with trivial row grouping (which are
+                // created on the fly otherwise), so the workers do not race on their construction.
+                auto const& rowGroupIndices = matrix.getRowGroupIndices();
+                numberOfSuccessorSccs.assign(numberOfSccs, 0);
+                dependentSccStarts.assign(numberOfSccs + 1, 0);
+                std::vector<uint64_t> successorSccs;
+                std::vector<uint64_t> marker(numberOfSccs, numberOfSccs);
+                for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+                    marker[sccIndex] = sccIndex;
+                    for (auto const& state : decomposition.getBlock(sccIndex)) {
+                        for (auto const& entry : matrix.getRows(rowGroupIndices[state], rowGroupIndices[state + 1])) {
+                            uint64_t successorScc = stateToScc[entry.getColumn()];
+                            if (marker[successorScc] != sccIndex) {
+                                marker[successorScc] = sccIndex;
+                                successorSccs.push_back(successorScc);
+                                ++numberOfSuccessorSccs[sccIndex];
+                                ++dependentSccStarts[successorScc + 1];
+                            }
+                        }
+                    }
+                }
+
+                // Invert the successor relation.
+                for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+                    dependentSccStarts[sccIndex + 1] += dependentSccStarts[sccIndex];
+                }
+                dependentSccs.resize(successorSccs.size());
+                std::vector<uint64_t> nextPositions(dependentSccStarts.begin(), dependentSccStarts.end() - 1);
+                auto successorIt = successorSccs.begin();
+                for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+                    for (uint64_t successor = 0; successor < numberOfSuccessorSccs[sccIndex]; ++successor, ++successorIt) {
+                        dependentSccs[nextPositions[*successorIt]++] = sccIndex;
+                    }
+                }
+            }
+
+            template<typename ValueType>
+            uint64_t TopologicalSccScheduler<ValueType>::getNumberOfWorkers() const {
+                return numberOfWorkers;
+            }
+
+            template<typename ValueType>
+            uint64_t TopologicalSccScheduler<ValueType>::execute(std::function<bool(uint64_t, uint64_t)> const& function, std::function<void(uint64_t)> const& progress) const {
+                uint64_t const numberOfSccs = decomposition.size();
+
+                // The fields below are guarded by the mutex.
+                std::mutex mutex;
+                std::condition_variable wakeUp;
+                std::vector<uint64_t> remainingSuccessorSccs = numberOfSuccessorSccs;
+                std::vector<uint64_t> readySccs;
+                for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+                    if (remainingSuccessorSccs[sccIndex] == 0) {
+                        readySccs.push_back(sccIndex);
+                    }
+                }
+                uint64_t processedSccs = 0;
+                bool aborted = false;
+
+                auto processScc = [&function] (uint64_t worker, uint64_t sccIndex) {
+#ifdef STORM_HAVE_INTELTBB
+                    // Nested parallel loops within the function must not make the thread pick up another worker, as
+                    // that worker might wait for the SCC that is currently processed.
+                    bool result = true;
+                    tbb::this_task_arena::isolate([&] () { result = function(worker, sccIndex); });
+                    return result;
+#else
+                    return function(worker, sccIndex);
+#endif
+                };
+
+                auto work = [&] (uint64_t worker) {
+                    std::vector<uint64_t> batch;
+                    while (true) {
+                        batch.clear();
+                        {
+                            // A worker only waits if no SCC is ready. As the SCCs form a DAG, some other worker is
+                            // then busy with an SCC, so waiting can not deadlock.
+                            std::unique_lock<std::mutex> lock(mutex);
+                            wakeUp.wait(lock, [&] () { return aborted || !readySccs.empty() || processedSccs == numberOfSccs; });
+                            if (aborted || readySccs.empty()) {
+                                return;
+                            }
+                            // Take small SCCs in a batch, but leave a share of the ready SCCs for the other workers.
+                            uint64_t maxBatchSccs = std::max<uint64_t>(1, readySccs.size() / numberOfWorkers);
+                            uint64_t batchStates = 0;
+                            while (!readySccs.empty() && batch.size() < maxBatchSccs && batchStates < batchSize) {
+                                batch.push_back(readySccs.back());
+                                readySccs.pop_back();
+                                batchStates += decomposition.getBlock(batch.back()).size();
+                            }
+                        }
+
+                        bool proceed = true;
+                        uint64_t processedInBatch = 0;
+                        try {
+                            for (auto const& sccIndex : batch) {
+                                ++processedInBatch;
+                                if (!processScc(worker, sccIndex)) {
+                                    proceed = false;
+                                    break;
+                                }
+                            }
+                        } catch (...) {
+                            {
+                                std::unique_lock<std::mutex> lock(mutex);
+                                aborted = true;
+                            }
+                            wakeUp.notify_all();
+                            throw;
+                        }
+
+                        {
+                            std::unique_lock<std::mutex> lock(mutex);
+                            for (uint64_t batchIndex = 0; batchIndex < processedInBatch; ++batchIndex) {
+                                uint64_t sccIndex = batch[batchIndex];
+                                for (uint64_t position = dependentSccStarts[sccIndex]; position < dependentSccStarts[sccIndex + 1]; ++position) {
+                                    uint64_t dependentScc = dependentSccs[position];
+                                    if (--remainingSuccessorSccs[dependentScc] == 0) {
+                                        readySccs.push_back(dependentScc);
+                                    }
+                                }
+                            }
+                            processedSccs += processedInBatch;
+                            aborted |= !proceed;
+                            if (progress) {
+                                progress(processedSccs);
+                            }
+                        }
+                        wakeUp.notify_all();
+                    }
+                };
+
+                storm::utility::parallel::parallelFor(0, numberOfWorkers, 1, [&work] (auto const& range) {
+                    for (uint64_t worker = range.begin(); worker < range.end(); ++worker) {
+                        work(worker);
+                    }
+                });
+
+                STORM_LOG_ASSERT(aborted || processedSccs == numberOfSccs, "Not all SCCs have been processed.");
+                return processedSccs;
+            }
+
+            template class TopologicalSccScheduler<double>;
+#ifdef STORM_HAVE_CARL
+            template class TopologicalSccScheduler<storm::RationalNumber>;
+            template class TopologicalSccScheduler<storm::RationalFunction>;
+#endif
+        }
+    }
+}
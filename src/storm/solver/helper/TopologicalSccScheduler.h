@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace storm {
+
+    namespace storage {
+        template<typename ValueType>
+        class SparseMatrix;
+
+        template<typename ValueType>
+        class StronglyConnectedComponentDecomposition;
+    }
+
+    namespace solver {
+        namespace helper {
+
+            /*!
+             * Schedules the SCCs of a matrix on several workers along the DAG of the SCC decomposition. An SCC becomes
+             * ready as soon as all SCCs that contain a successor of one of its states have been processed. In contrast
+             * to processing the SCCs level by level (according to their depth), there is no barrier between the levels:
+             * a worker never waits for unrelated SCCs of the same depth. To reduce the synchronization overhead, small
+             * SCCs are handed out in batches.
+             */
+            template<typename ValueType>
+            class TopologicalSccScheduler {
+            public:
+                /*!
+                 * Computes the dependencies between the SCCs.
+                 *
+                 * @param matrix The matrix. Needs to be square in terms of row groups.
+                 * @param decomposition The SCC decomposition of the matrix.
+                 * @param batchSize The (approximate) number of states that are handed out to a worker at once.
+                 */
+                TopologicalSccScheduler(storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& decomposition, uint64_t batchSize = 256);
+
+                /*!
+                 * Retrieves the number of workers, i.e., the number of SCCs that are processed concurrently (at most).
+                 */
+                uint64_t getNumberOfWorkers() const;
+
+                /*!
+                 * Processes all SCCs. The given function is called with the index of a worker (in the range
+                 * [0, getNumberOfWorkers())) and the index of the SCC to process. Calls with the same worker index never
+                 * happen concurrently, so the worker index can be used to access data that is local to the worker.
+                 *
+                 * @param function The function that processes an SCC. If it returns false, no further SCCs are handed
+                 * out and the remaining calls of the current batches are skipped.
+                 * @param progress If given, this function is called with the number of processed SCCs after each batch.
+                 * The calls never happen concurrently.
+                 * @return The number of processed SCCs.
+                 */
+                uint64_t execute(std::function<bool(uint64_t, uint64_t)> const& function, std::function<void(uint64_t)> const& progress = std::function<void(uint64_t)>()) const;
+
+            private:
+                // The SCC decomposition.
+                storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& decomposition;
+
+                // The (approximate) number of states per batch.
+                uint64_t batchSize;
+
+                // The number of workers.
+                uint64_t numberOfWorkers;
+
+                // For each SCC the number of distinct other SCCs that contain a successor of one of its states.
+                std::vector<uint64_t> numberOfSuccessorSccs;
+
+                // For each SCC the SCCs that depend on it. The dependent SCCs of SCC i are stored at the positions
+                // dependentSccStarts[i] to dependentSccStarts[i+1] (exclusive).
+                std::vector<uint64_t> dependentSccStarts;
+                std::vector<uint64_t> dependentSccs;
+            };
+
+        }
+    }
+}
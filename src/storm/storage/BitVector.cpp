@@ -8,7 +8,13 @@
 #include "storm/utility/OsDetection.h"
 #include "storm/utility/Hash.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/simd.h"
 
+#ifdef STORM_HAVE_X86_SIMD_DISPATCH
+#include <immintrin.h>
+#elif defined WINDOWS
+#include <nmmintrin.h>
+#endif
 
 #ifdef STORM_DEV
 #define ASSERT_BITVECTOR
@@ -17,6 +23,244 @@
 namespace storm {
     namespace storage {
 
+        namespace detail {
+
+            // The operations on pairs of buckets for which bulk kernels are provided. The second operand is ignored
+            // for the negation.
+            enum class BucketOperation { And, Or, Xor, AndNot, Implies, Not };
+
+            // Bulk kernels are only used for bit vectors with at least this many buckets.
+            static const uint64_t minimalNumberOfBucketsForSimd = 8;
+
+            template<BucketOperation Operation>
+            inline uint64_t combineBucket(uint64_t a, uint64_t b) {
+                switch (Operation) {
+                    case BucketOperation::And: return a & b;
+                    case BucketOperation::Or: return a | b;
+                    case BucketOperation::Xor: return a ^ b;
+                    case BucketOperation::AndNot: return a & ~b;
+                    case BucketOperation::Implies: return ~a | b;
+                    case BucketOperation::Not: return ~a;
+                }
+                return 0;
+            }
+
+            inline uint64_t countSetBits(uint64_t bucket) {
+                // Check if we are using g++ or clang++ and, if so, use the built-in function
+#if (defined (__GNUG__) || defined(__clang__))
+                return __builtin_popcountll(bucket);
+#elif defined WINDOWS
+                // If the target machine does not support SSE4, this will fail.
+                return _mm_popcnt_u64(bucket);
+#else
+                uint_fast32_t cnt;
+                for (cnt = 0; bucket; cnt++) {
+                    bucket &= bucket - 1;
+                }
+                return cnt;
+#endif
+            }
+
+            // Retrieves the offset of the first set bit in the given (non-zero) bucket. As the bits are stored with the
+            // most significant bit first, this is the number of leading zeros.
+            inline uint64_t getFirstSetBitInBucket(uint64_t bucket) {
+                STORM_LOG_ASSERT(bucket != 0, "Expected non-zero bucket.");
+#if (defined (__GNUG__) || defined(__clang__))
+                return __builtin_clzll(bucket);
+#else
+                uint64_t offset = 0;
+                while ((bucket & (1ull << (63 - offset))) == 0) {
+                    ++offset;
+                }
+                return offset;
+#endif
+            }
+
+#ifdef STORM_HAVE_X86_SIMD_DISPATCH
+            namespace avx2 {
+                template<BucketOperation Operation>
+                STORM_SIMD_TARGET_AVX2 inline __m256i combine(__m256i a, __m256i b) {
+                    switch (Operation) {
+                        case BucketOperation::And: return _mm256_and_si256(a, b);
+                        case BucketOperation::Or: return _mm256_or_si256(a, b);
+                        case BucketOperation::Xor: return _mm256_xor_si256(a, b);
+                        case BucketOperation::AndNot: return _mm256_andnot_si256(b, a);
+                        case BucketOperation::Implies: return _mm256_or_si256(_mm256_xor_si256(a, _mm256_set1_epi64x(-1ll)), b);
+                        case BucketOperation::Not: return _mm256_xor_si256(a, _mm256_set1_epi64x(-1ll));
+                    }
+                    return _mm256_setzero_si256();
+                }
+
+                template<BucketOperation Operation>
+                STORM_SIMD_TARGET_AVX2 void combineBuckets(uint64_t const* a, uint64_t const* b, uint64_t* result, uint64_t size) {
+                    uint64_t i = 0;
+                    for (; i + 4 <= size; i += 4) {
+                        __m256i first = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(a + i));
+                        __m256i second = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(b + i));
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + i), combine<Operation>(first, second));
+                    }
+                    for (; i < size; ++i) {
+                        result[i] = combineBucket<Operation>(a[i], b[i]);
+                    }
+                }
+
+                template<BucketOperation Operation>
+                STORM_SIMD_TARGET_AVX2 bool isZero(uint64_t const* a, uint64_t const* b, uint64_t size) {
+                    uint64_t i = 0;
+                    for (; i + 4 <= size; i += 4) {
+                        __m256i first = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(a + i));
+                        __m256i second = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(b + i));
+                        __m256i combined = combine<Operation>(first, second);
+                        if (!_mm256_testz_si256(combined, combined)) {
+                            return false;
+                        }
+                    }
+                    for (; i < size; ++i) {
+                        if (combineBucket<Operation>(a[i], b[i]) != 0) {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+                // Counts the set bits of each 64-bit lane by looking up the counts of the nibbles.
+                STORM_SIMD_TARGET_AVX2 inline __m256i countSetBits(__m256i v) {
+                    __m256i const lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+                    __m256i const lowNibbles = _mm256_set1_epi8(0x0f);
+                    __m256i low = _mm256_and_si256(v, lowNibbles);
+                    __m256i high = _mm256_and_si256(_mm256_srli_epi16(v, 4), lowNibbles);
+                    __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low), _mm256_shuffle_epi8(lookup, high));
+                    return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+                }
+
+                template<BucketOperation Operation>
+                STORM_SIMD_TARGET_AVX2 uint64_t countSetBits(uint64_t const* a, uint64_t const* b, uint64_t size) {
+                    __m256i sums = _mm256_setzero_si256();
+                    uint64_t i = 0;
+                    for (; i + 4 <= size; i += 4) {
+                        __m256i first = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(a + i));
+                        __m256i second = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(b + i));
+                        sums = _mm256_add_epi64(sums, countSetBits(combine<Operation>(first, second)));
+                    }
+                    uint64_t result = _mm256_extract_epi64(sums, 0) + _mm256_extract_epi64(sums, 1) + _mm256_extract_epi64(sums, 2) + _mm256_extract_epi64(sums, 3);
+                    for (; i < size; ++i) {
+                        result += detail::countSetBits(combineBucket<Operation>(a[i], b[i]));
+                    }
+                    return result;
+                }
+            }
+
+            namespace avx512 {
+                template<BucketOperation Operation>
+                STORM_SIMD_TARGET_AVX512 inline __m512i combine(__m512i a, __m512i b) {
+                    switch (Operation) {
+                        case BucketOperation::And: return _mm512_and_si512(a, b);
+                        case BucketOperation::Or: return _mm512_or_si512(a, b);
+                        case BucketOperation::Xor: return _mm512_xor_si512(a, b);
+                        case BucketOperation::AndNot: return _mm512_andnot_si512(b, a);
+                        case BucketOperation::Implies: return _mm512_or_si512(_mm512_xor_si512(a, _mm512_set1_epi64(-1ll)), b);
+                        case BucketOperation::Not: return _mm512_xor_si512(a, _mm512_set1_epi64(-1ll));
+                    }
+                    return _mm512_setzero_si512();
+                }
+
+                template<BucketOperation Operation>
+                STORM_SIMD_TARGET_AVX512 void combineBuckets(uint64_t const* a, uint64_t const* b, uint64_t* result, uint64_t size) {
+                    uint64_t i = 0;
+                    for (; i + 8 <= size; i += 8) {
+                        __m512i first = _mm512_loadu_si512(a + i);
+                        __m512i second = _mm512_loadu_si512(b + i);
+                        _mm512_storeu_si512(result + i, combine<Operation>(first, second));
+                    }
+                    for (; i < size; ++i) {
+                        result[i] = combineBucket<Operation>(a[i], b[i]);
+                    }
+                }
+
+                template<BucketOperation Operation>
+                STORM_SIMD_TARGET_AVX512 bool isZero(uint64_t const* a, uint64_t const* b, uint64_t size) {
+                    uint64_t i = 0;
+                    for (; i + 8 <= size; i += 8) {
+                        __m512i combined = combine<Operation>(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i));
+                        if (_mm512_test_epi64_mask(combined, combined) != 0) {
+                            return false;
+                        }
+                    }
+                    for (; i < size; ++i) {
+                        if (combineBucket<Operation>(a[i], b[i]) != 0) {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+            }
+#endif
+
+            /*!
+             * Computes result[i] = a[i] op b[i] for all buckets. The result may coincide with one of the operands.
+             */
+            template<BucketOperation Operation>
+            void combineBuckets(uint64_t const* a, uint64_t const* b, uint64_t* result, uint64_t size) {
+#ifdef STORM_HAVE_X86_SIMD_DISPATCH
+                if (size >= minimalNumberOfBucketsForSimd) {
+                    storm::utility::simd::SimdLevel level = storm::utility::simd::getSupportedSimdLevel();
+                    if (level == storm::utility::simd::SimdLevel::Avx512) {
+                        avx512::combineBuckets<Operation>(a, b, result, size);
+                        return;
+                    } else if (level == storm::utility::simd::SimdLevel::Avx2) {
+                        avx2::combineBuckets<Operation>(a, b, result, size);
+                        return;
+                    }
+                }
+#endif
+                for (uint64_t i = 0; i < size; ++i) {
+                    result[i] = combineBucket<Operation>(a[i], b[i]);
+                }
+            }
+
+            /*!
+             * Checks whether a[i] op b[i] is zero for all buckets.
+             */
+            template<BucketOperation Operation>
+            bool isZero(uint64_t const* a, uint64_t const* b, uint64_t size) {
+#ifdef STORM_HAVE_X86_SIMD_DISPATCH
+                if (size >= minimalNumberOfBucketsForSimd) {
+                    storm::utility::simd::SimdLevel level = storm::utility::simd::getSupportedSimdLevel();
+                    if (level == storm::utility::simd::SimdLevel::Avx512) {
+                        return avx512::isZero<Operation>(a, b, size);
+                    } else if (level == storm::utility::simd::SimdLevel::Avx2) {
+                        return avx2::isZero<Operation>(a, b, size);
+                    }
+                }
+#endif
+                for (uint64_t i = 0; i < size; ++i) {
+                    if (combineBucket<Operation>(a[i], b[i]) != 0) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            /*!
+             * Counts the set bits of a[i] op b[i] over all buckets.
+             */
+            template<BucketOperation Operation>
+            uint64_t countSetBits(uint64_t const* a, uint64_t const* b, uint64_t size) {
+#ifdef STORM_HAVE_X86_SIMD_DISPATCH
+                // AVX-512F itself has no instructions for counting bits (or shuffling bytes), so we use the AVX2 kernel
+                // on both levels.
+                if (size >= minimalNumberOfBucketsForSimd && storm::utility::simd::getSupportedSimdLevel() != storm::utility::simd::SimdLevel::Scalar) {
+                    return avx2::countSetBits<Operation>(a, b, size);
+                }
+#endif
+                uint64_t result = 0;
+                for (uint64_t i = 0; i < size; ++i) {
+                    result += countSetBits(combineBucket<Operation>(a[i], b[i]));
+                }
+                return result;
+            }
+        }
+
         BitVector::const_iterator::const_iterator(uint64_t const* dataPtr, uint_fast64_t startIndex, uint_fast64_t endIndex, bool setOnFirstBit) : dataPtr(dataPtr), endIndex(endIndex) {
             if (setOnFirstBit) {
                 // Set the index of the first set bit in the vector.
@@ -46,9 +290,34 @@ namespace storm {
         }
 
         BitVector::const_iterator& BitVector::const_iterator::operator+=(size_t n) {
-            for(size_t i = 0; i < n; ++i) {
-                currentIndex = getNextIndexWithValue(true, dataPtr, ++currentIndex, endIndex);
+            if (n == 0) {
+                return *this;
+            }
+            ++currentIndex;
+            while (currentIndex < endIndex) {
+                // Consider the bits of the current bucket from the current index on.
+                uint64_t offset = currentIndex & mod64mask;
+                uint64_t remainingInBucket = dataPtr[currentIndex >> 6];
+                if (offset != 0) {
+                    remainingInBucket &= (1ull << (64 - offset)) - 1ull;
+                }
+
+                // Skip the whole bucket if it does not contain enough set bits.
+                uint64_t setBitsInBucket = detail::countSetBits(remainingInBucket);
+                if (setBitsInBucket < n) {
+                    n -= setBitsInBucket;
+                    currentIndex = (currentIndex | mod64mask) + 1;
+                    continue;
+                }
+
+                // Otherwise, drop the first n-1 set bits of the bucket.
+                for (; n > 1; --n) {
+                    remainingInBucket ^= (1ull << 63) >> detail::getFirstSetBitInBucket(remainingInBucket);
+                }
+                currentIndex = std::min<uint_fast64_t>((currentIndex & ~static_cast<uint_fast64_t>(mod64mask)) + detail::getFirstSetBitInBucket(remainingInBucket), endIndex);
+                return *this;
             }
+            currentIndex = endIndex;
             return *this;
         }
 
@@ -294,33 +563,33 @@ namespace storm {
         BitVector BitVector::operator&(BitVector const& other) const {
             STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
             BitVector result(bitCount);
-            std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, result.buckets, [] (uint64_t const& a, uint64_t const& b) { return a & b; });
+            detail::combineBuckets<detail::BucketOperation::And>(this->buckets, other.buckets, result.buckets, this->bucketCount());
             return result;
         }
 
         BitVector& BitVector::operator&=(BitVector const& other) {
             STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
-            std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, this->buckets, [] (uint64_t const& a, uint64_t const& b) { return a & b; });
+            detail::combineBuckets<detail::BucketOperation::And>(this->buckets, other.buckets, this->buckets, this->bucketCount());
             return *this;
         }
 
         BitVector BitVector::operator|(BitVector const& other) const {
             STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
             BitVector result(bitCount);
-            std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, result.buckets, [] (uint64_t const& a, uint64_t const& b) { return a | b; });
+            detail::combineBuckets<detail::BucketOperation::Or>(this->buckets, other.buckets, result.buckets, this->bucketCount());
             return result;
         }
 
         BitVector& BitVector::operator|=(BitVector const& other) {
             STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
-            std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, this->buckets, [] (uint64_t const& a, uint64_t const& b) { return a | b; });
+            detail::combineBuckets<detail::BucketOperation::Or>(this->buckets, other.buckets, this->buckets, this->bucketCount());
             return *this;
         }
 
         BitVector BitVector::operator^(BitVector const& other) const {
             STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
             BitVector result(bitCount);
-            std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, result.buckets, [] (uint64_t const& a, uint64_t const& b) { return a ^ b; });
+            detail::combineBuckets<detail::BucketOperation::Xor>(this->buckets, other.buckets, result.buckets, this->bucketCount());
             result.truncateLastBucket();
             return result;
         }
@@ -355,13 +624,13 @@ namespace storm {
 
         BitVector BitVector::operator~() const {
             BitVector result(this->bitCount);
-            std::transform(this->buckets, this->buckets + this->bucketCount(), result.buckets, [] (uint64_t const& a) { return ~a; });
+            detail::combineBuckets<detail::BucketOperation::Not>(this->buckets, this->buckets, result.buckets, this->bucketCount());
             result.truncateLastBucket();
             return result;
         }
 
         void BitVector::complement() {
-            std::transform(this->buckets, this->buckets + this->bucketCount(), this->buckets, [] (uint64_t const& a) { return ~a; });
+            detail::combineBuckets<detail::BucketOperation::Not>(this->buckets, this->buckets, this->buckets, this->bucketCount());
             truncateLastBucket();
         }
         
@@ -396,39 +665,38 @@ namespace storm {
             STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
 
             BitVector result(bitCount);
-            std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, result.buckets, [] (uint64_t const& a, uint64_t const& b) { return (~a | b); });
+            detail::combineBuckets<detail::BucketOperation::Implies>(this->buckets, other.buckets, result.buckets, this->bucketCount());
             result.truncateLastBucket();
             return result;
         }
 
-        bool BitVector::isSubsetOf(BitVector const& other) const {
+        BitVector BitVector::andNot(BitVector const& other) const {
             STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
 
-            uint64_t const* it1 = buckets;
-            uint64_t const* ite1 = buckets + bucketCount();
-            uint64_t const* it2 = other.buckets;
-            
-            for (; it1 != ite1; ++it1, ++it2) {
-                if ((*it1 & *it2) != *it1) {
-                    return false;
-                }
-            }
-            return true;
+            BitVector result(bitCount);
+            detail::combineBuckets<detail::BucketOperation::AndNot>(this->buckets, other.buckets, result.buckets, this->bucketCount());
+            return result;
+        }
+
+        BitVector& BitVector::andNotAssign(BitVector const& other) {
+            STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+            detail::combineBuckets<detail::BucketOperation::AndNot>(this->buckets, other.buckets, this->buckets, this->bucketCount());
+            return *this;
+        }
+
+        bool BitVector::isSubsetOf(BitVector const& other) const {
+            STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+            return detail::isZero<detail::BucketOperation::AndNot>(this->buckets, other.buckets, this->bucketCount());
         }
 
         bool BitVector::isDisjointFrom(BitVector const& other) const {
             STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+            return detail::isZero<detail::BucketOperation::And>(this->buckets, other.buckets, this->bucketCount());
+        }
 
-            uint64_t const* it1 = buckets;
-            uint64_t const* ite1 = buckets + bucketCount();
-            uint64_t const* it2 = other.buckets;
-            
-            for (; it1 != ite1; ++it1, ++it2) {
-                if ((*it1 & *it2) != 0) {
-                    return false;
-                }
-            }
-            return true;
+        uint_fast64_t BitVector::getNumberOfSetBitsInIntersection(BitVector const& other) const {
+            STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+            return detail::countSetBits<detail::BucketOperation::And>(this->buckets, other.buckets, this->bucketCount());
         }
 
         bool BitVector::matches(uint_fast64_t bitIndex, BitVector const& other) const {
@@ -631,40 +899,14 @@ namespace storm {
 
             // First, count all full buckets.
             uint_fast64_t bucket = index >> 6;
-            for (uint_fast64_t i = 0; i < bucket; ++i) {
-                // Check if we are using g++ or clang++ and, if so, use the built-in function
-#if (defined (__GNUG__) || defined(__clang__))
-                result += __builtin_popcountll(buckets[i]);
-#elif defined WINDOWS
-#include <nmmintrin.h>
-                // If the target machine does not support SSE4, this will fail.
-                result += _mm_popcnt_u64(bucketVector[i]);
-#else
-                uint_fast32_t cnt;
-                uint_fast64_t bitset = buckets[i];
-                for (cnt = 0; bitset; cnt++) {
-                    bitset &= bitset - 1;
-                }
-                result += cnt;
-#endif
-            }
+            result += detail::countSetBits<detail::BucketOperation::And>(buckets, buckets, bucket);
 
             // Now check if we have to count part of a bucket.
             uint64_t tmp = index & mod64mask;
             if (tmp != 0) {
                 tmp = ~((1ll << (64 - (tmp & mod64mask))) - 1ll);
                 tmp &= buckets[bucket];
-                // Check if we are using g++ or clang++ and, if so, use the built-in function
-#if (defined (__GNUG__) || defined(__clang__))
-                result += __builtin_popcountll(tmp);
-#else
-                uint_fast32_t cnt;
-                uint64_t bitset = tmp;
-                for (cnt = 0; bitset; cnt++) {
-                    bitset &= bitset - 1;
-                }
-                result += cnt;
-#endif
+                result += detail::countSetBits(tmp);
             }
 
             return result;
@@ -701,6 +943,41 @@ namespace storm {
             return const_iterator(buckets, bitCount, bitCount, false);
         }
 
+        std::vector<uint_fast64_t> BitVector::getSetIndices() const {
+            std::vector<uint_fast64_t> result(getNumberOfSetBits());
+            uint_fast64_t numberOfIndices = getSetIndices(0, result.data(), result.size());
+            STORM_LOG_ASSERT(numberOfIndices == result.size(), "Unexpected number of set indices.");
+            return result;
+        }
+
+        uint_fast64_t BitVector::getSetIndices(uint_fast64_t startingIndex, uint_fast64_t* indices, uint_fast64_t maximalNumberOfIndices) const {
+            uint_fast64_t numberOfIndices = 0;
+            if (startingIndex >= bitCount || maximalNumberOfIndices == 0) {
+                return numberOfIndices;
+            }
+
+            uint64_t bucket = startingIndex >> 6;
+            uint64_t remainingInBucket = buckets[bucket];
+            if ((startingIndex & mod64mask) != 0) {
+                remainingInBucket &= (1ull << (64 - (startingIndex & mod64mask))) - 1ull;
+            }
+            for (uint64_t const lastBucket = bucketCount(); ; ) {
+                // Extract the set bits of the current bucket by repeatedly clearing the first one.
+                while (remainingInBucket != 0) {
+                    uint64_t offset = detail::getFirstSetBitInBucket(remainingInBucket);
+                    indices[numberOfIndices] = (bucket << 6) + offset;
+                    if (++numberOfIndices == maximalNumberOfIndices) {
+                        return numberOfIndices;
+                    }
+                    remainingInBucket ^= (1ull << 63) >> offset;
+                }
+                if (++bucket == lastBucket) {
+                    return numberOfIndices;
+                }
+                remainingInBucket = buckets[bucket];
+            }
+        }
+
         uint_fast64_t BitVector::getNextSetIndex(uint_fast64_t startingIndex) const {
             return getNextIndexWithValue(true, buckets, startingIndex, bitCount);
         }
@@ -732,10 +1009,7 @@ namespace storm {
     
                     // Check if there is at least one bit in the remainder of the bucket that is set to true.
                     if (remainingInBucket != 0) {
-                        // As long as the current bit is not set, move the current bit.
-                        while ((remainingInBucket & (1ull << (63 - currentBitInByte))) == 0) {
-                            ++currentBitInByte;
-                        }
+                        currentBitInByte = detail::getFirstSetBitInBucket(remainingInBucket);
     
                         // Only return the index of the set bit if we are still in the valid range.
                         if (startingIndex + currentBitInByte < endIndex) {
@@ -758,10 +1032,7 @@ namespace storm {
     
                     // Check if there is at least one bit in the remainder of the bucket that is set to false.
                     if (remainingInBucket != (-1ull & mask)) {
-                        // As long as the current bit is not false, move the current bit.
-                        while ((remainingInBucket & (1ull << (63 - currentBitInByte))) != 0) {
-                            ++currentBitInByte;
-                        }
+                        currentBitInByte = detail::getFirstSetBitInBucket(~remainingInBucket & mask);
     
                         // Only return the index of the set bit if we are still in the valid range.
                         if (startingIndex + currentBitInByte < endIndex) {
@@ -348,6 +348,24 @@ namespace storm {
              */
             BitVector implies(BitVector const& other) const;
 
+            /*!
+             * Performs a logical "and" with the negation of the given bit vector, i.e., computes this & ~other without
+             * creating the negation as a temporary bit vector.
+             *
+             * @param other A reference to the bit vector whose negation to use for the operation.
+             * @return A bit vector corresponding to the logical "and" of this bit vector and the negation of the given one.
+             */
+            BitVector andNot(BitVector const& other) const;
+
+            /*!
+             * Performs a logical "and" with the negation of the given bit vector and assigns the result to the current
+             * bit vector, i.e., clears all bits that are set in the given bit vector.
+             *
+             * @param other A reference to the bit vector whose negation to use for the operation.
+             * @return A reference to the current bit vector.
+             */
+            BitVector& andNotAssign(BitVector const& other);
+
             /*!
              * Checks whether all bits that are set in the current bit vector are also set in the given bit vector.
              *
@@ -472,6 +490,15 @@ namespace storm {
              */
             uint_fast64_t getNumberOfSetBitsBeforeIndex(uint_fast64_t index) const;
 
+            /*!
+             * Retrieves the number of bits that are set in both this and the given bit vector. This is equivalent to
+             * (*this & other).getNumberOfSetBits(), but avoids the temporary bit vector.
+             *
+             * @param other A reference to the other bit vector.
+             * @return The number of bits set in both bit vectors.
+             */
+            uint_fast64_t getNumberOfSetBitsInIntersection(BitVector const& other) const;
+
             /*!
              * Retrieves a vector that holds at position i the number of bits set before index i.
              *
@@ -503,6 +530,27 @@ namespace storm {
              */
             const_iterator end() const;
 
+            /*!
+             * Retrieves the (ascending) indices of all set bits. This is equivalent to copying the range [begin(), end())
+             * but reserves the required memory beforehand.
+             *
+             * @return The indices of the set bits.
+             */
+            std::vector<uint_fast64_t> getSetIndices() const;
+
+            /*!
+             * Writes the (ascending) indices of the set bits to the given buffer, starting at the given index. This
+             * allows to process the set bits in chunks. The next chunk starts after the last index that was written.
+             *
+             * @param startingIndex The index at which to start the search for set bits. The bit at this index itself is
+             * included in the search range.
+             * @param indices The buffer to write the indices to. Needs to have space for at least the given number of
+             * indices.
+             * @param maximalNumberOfIndices The maximal number of indices to write.
+             * @return The number of indices that were written.
+             */
+            uint_fast64_t getSetIndices(uint_fast64_t startingIndex, uint_fast64_t* indices, uint_fast64_t maximalNumberOfIndices) const;
+
             /*!
              * Retrieves the index of the bit that is the next bit set to true in the bit vector. If there is none,
              * this function returns the number of bits this vector holds in total. Put differently, if the return
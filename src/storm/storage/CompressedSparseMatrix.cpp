@@ -0,0 +1,355 @@
+#include "storm/storage/CompressedSparseMatrix.h"
+
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace storage {
+
+        namespace detail {
+            // Appends the given number with seven bits per byte, where the highest bit of a byte indicates whether
+            // another byte follows.
+            inline void encodeVarint(uint64_t number, std::vector<uint8_t>& data) {
+                while (number >= 0x80) {
+                    data.push_back(static_cast<uint8_t>(number | 0x80));
+                    number >>= 7;
+                }
+                data.push_back(static_cast<uint8_t>(number));
+            }
+
+            // Decodes the number at the given position and moves the position behind it.
+            inline uint64_t decodeVarint(uint8_t const*& data) {
+                uint64_t number = *data & 0x7f;
+                uint64_t shift = 7;
+                while (*data & 0x80) {
+                    ++data;
+                    number |= static_cast<uint64_t>(*data & 0x7f) << shift;
+                    shift += 7;
+                }
+                ++data;
+                return number;
+            }
+
+            // Computes the distinct values (in the order of their first occurrence) and the index of every value if
+            // there are at most the given number of distinct values. Values are only deduplicated for types whose
+            // values can be compared bitwise.
+            template<typename ValueType>
+            bool createValueDictionary(std::vector<ValueType> const&, uint64_t, std::vector<ValueType>&, std::vector<uint64_t>&) {
+                return false;
+            }
+
+            template<>
+            bool createValueDictionary(std::vector<double> const& values, uint64_t maximalSize, std::vector<double>& dictionary, std::vector<uint64_t>& indices) {
+                std::unordered_map<uint64_t, uint64_t> valueToIndex;
+                indices.reserve(values.size());
+                for (auto const& value : values) {
+                    // Use the bit pattern as key to distinguish values that compare equal (such as 0 and -0).
+                    uint64_t key;
+                    std::memcpy(&key, &value, sizeof(key));
+                    auto insertionResult = valueToIndex.emplace(key, dictionary.size());
+                    if (insertionResult.second) {
+                        if (dictionary.size() == maximalSize) {
+                            dictionary.clear();
+                            indices.clear();
+                            return false;
+                        }
+                        dictionary.push_back(value);
+                    }
+                    indices.push_back(insertionResult.first->second);
+                }
+                return true;
+            }
+
+            template<typename ValueType>
+            struct PlainValueAccess {
+                ValueType const& operator()(uint64_t entry) const {
+                    return values[entry];
+                }
+
+                ValueType const* values;
+            };
+
+            template<typename ValueType, typename IndexType>
+            struct DictionaryValueAccess {
+                ValueType const& operator()(uint64_t entry) const {
+                    return dictionary[indices[entry]];
+                }
+
+                ValueType const* dictionary;
+                IndexType const* indices;
+            };
+        }
+
+        template<typename ValueType>
+        CompressedSparseMatrix<ValueType>::CompressedSparseMatrix(SparseMatrix<ValueType> const& matrix, bool allowValueDictionary) : columnCount(matrix.getColumnCount()) {
+            index_type entryCount = matrix.getEntryCount();
+            values.reserve(entryCount);
+            rowIndications.reserve(matrix.getRowCount() + 1);
+            rowColumnDataOffsets.reserve(matrix.getRowCount() + 1);
+
+            rowIndications.push_back(0);
+            rowColumnDataOffsets.push_back(0);
+            for (index_type row = 0; row < matrix.getRowCount(); ++row) {
+                index_type previousColumn = 0;
+                for (auto const& entry : matrix.getRow(row)) {
+                    STORM_LOG_ASSERT(entry.getColumn() >= previousColumn, "The columns of a row are expected to be sorted.");
+                    detail::encodeVarint(entry.getColumn() - previousColumn, columnData);
+                    previousColumn = entry.getColumn();
+                    values.push_back(entry.getValue());
+                }
+                rowIndications.push_back(values.size());
+                rowColumnDataOffsets.push_back(columnData.size());
+            }
+            columnData.shrink_to_fit();
+
+            std::vector<uint64_t> indices;
+            if (allowValueDictionary && detail::createValueDictionary(values, std::numeric_limits<uint16_t>::max() + 1ull, valueDictionary, indices)) {
+                if (valueDictionary.size() <= std::numeric_limits<uint8_t>::max() + 1ull) {
+                    narrowValueIndices.assign(indices.begin(), indices.end());
+                } else {
+                    wideValueIndices.assign(indices.begin(), indices.end());
+                }
+                values.clear();
+                values.shrink_to_fit();
+            }
+        }
+
+        template<typename ValueType>
+        typename CompressedSparseMatrix<ValueType>::index_type CompressedSparseMatrix<ValueType>::getRowCount() const {
+            return rowIndications.size() - 1;
+        }
+
+        template<typename ValueType>
+        typename CompressedSparseMatrix<ValueType>::index_type CompressedSparseMatrix<ValueType>::getColumnCount() const {
+            return columnCount;
+        }
+
+        template<typename ValueType>
+        typename CompressedSparseMatrix<ValueType>::index_type CompressedSparseMatrix<ValueType>::getEntryCount() const {
+            return rowIndications.back();
+        }
+
+        template<typename ValueType>
+        bool CompressedSparseMatrix<ValueType>::hasValueDictionary() const {
+            return !valueDictionary.empty();
+        }
+
+        template<typename ValueType>
+        uint64_t CompressedSparseMatrix<ValueType>::getValueDictionarySize() const {
+            return valueDictionary.size();
+        }
+
+        template<typename ValueType>
+        uint64_t CompressedSparseMatrix<ValueType>::getSizeInMemory() const {
+            return columnData.size() + (rowColumnDataOffsets.size() + rowIndications.size()) * sizeof(uint64_t) + (valueDictionary.size() + values.size()) * sizeof(value_type) + narrowValueIndices.size() * sizeof(uint8_t) + wideValueIndices.size() * sizeof(uint16_t);
+        }
+
+        template<typename ValueType>
+        template<typename Function>
+        void CompressedSparseMatrix<ValueType>::applyWithValueAccess(Function const& function) const {
+            if (!narrowValueIndices.empty()) {
+                function(detail::DictionaryValueAccess<ValueType, uint8_t>{valueDictionary.data(), narrowValueIndices.data()});
+            } else if (!wideValueIndices.empty()) {
+                function(detail::DictionaryValueAccess<ValueType, uint16_t>{valueDictionary.data(), wideValueIndices.data()});
+            } else {
+                function(detail::PlainValueAccess<ValueType>{values.data()});
+            }
+        }
+
+        template<typename ValueType>
+        void CompressedSparseMatrix<ValueType>::multiplyWithVector(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const {
+            STORM_LOG_ASSERT(&vector != &result, "Vectors are aliased but are not allowed to be.");
+            multiplyWithVectorForward(vector, result, summand);
+        }
+
+        template<typename ValueType>
+        void CompressedSparseMatrix<ValueType>::multiplyWithVectorForward(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const {
+            applyWithValueAccess([&] (auto const& access) { this->multiplyWithVectorForward(access, vector, result, summand); });
+        }
+
+        template<typename ValueType>
+        void CompressedSparseMatrix<ValueType>::multiplyWithVectorBackward(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const {
+            applyWithValueAccess([&] (auto const& access) { this->multiplyWithVectorBackward(access, vector, result, summand); });
+        }
+
+        template<typename ValueType>
+        template<typename ValueAccess>
+        typename CompressedSparseMatrix<ValueType>::value_type CompressedSparseMatrix<ValueType>::multiplyRow(ValueAccess const& access, index_type row, std::vector<value_type> const& vector, value_type const* summand) const {
+            value_type result = summand ? *summand : storm::utility::zero<value_type>();
+            uint8_t const* data = columnData.data() + rowColumnDataOffsets[row];
+            uint64_t const entryEnd = rowIndications[row + 1];
+            uint64_t column = 0;
+            for (uint64_t entry = rowIndications[row]; entry < entryEnd; ++entry) {
+                column += detail::decodeVarint(data);
+                result += access(entry) * vector[column];
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        template<typename ValueAccess>
+        void CompressedSparseMatrix<ValueType>::multiplyWithVectorForward(ValueAccess const& access, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const {
+            index_type const rowCount = getRowCount();
+            for (index_type row = 0; row < rowCount; ++row) {
+                result[row] = multiplyRow(access, row, vector, summand ? &(*summand)[row] : nullptr);
+            }
+        }
+
+        template<typename ValueType>
+        template<typename ValueAccess>
+        void CompressedSparseMatrix<ValueType>::multiplyWithVectorBackward(ValueAccess const& access, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const {
+            for (index_type row = getRowCount(); row > 0;) {
+                --row;
+                result[row] = multiplyRow(access, row, vector, summand ? &(*summand)[row] : nullptr);
+            }
+        }
+
+        template<typename ValueType>
+        void CompressedSparseMatrix<ValueType>::multiplyAndReduceForward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            applyWithValueAccess([&] (auto const& access) {
+                if (dir == storm::OptimizationDirection::Minimize) {
+                    this->template multiplyAndReduceForward<storm::utility::ElementLess<ValueType>>(access, rowGroupIndices, vector, summand, result, choices);
+                } else {
+                    this->template multiplyAndReduceForward<storm::utility::ElementGreater<ValueType>>(access, rowGroupIndices, vector, summand, result, choices);
+                }
+            });
+        }
+
+        template<typename ValueType>
+        void CompressedSparseMatrix<ValueType>::multiplyAndReduceBackward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            applyWithValueAccess([&] (auto const& access) {
+                if (dir == storm::OptimizationDirection::Minimize) {
+                    this->template multiplyAndReduceBackward<storm::utility::ElementLess<ValueType>>(access, rowGroupIndices, vector, summand, result, choices);
+                } else {
+                    this->template multiplyAndReduceBackward<storm::utility::ElementGreater<ValueType>>(access, rowGroupIndices, vector, summand, result, choices);
+                }
+            });
+        }
+
+#ifdef STORM_HAVE_CARL
+        template<>
+        void CompressedSparseMatrix<storm::RationalFunction>::multiplyAndReduceForward(storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&, std::vector<uint_fast64_t>*) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+
+        template<>
+        void CompressedSparseMatrix<storm::RationalFunction>::multiplyAndReduceBackward(storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&, std::vector<uint_fast64_t>*) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+
+        template<typename ValueType>
+        template<typename Compare, typename ValueAccess>
+        void CompressedSparseMatrix<ValueType>::multiplyAndReduceForward(ValueAccess const& access, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            Compare compare;
+            uint64_t const groupCount = rowGroupIndices.size() - 1;
+            for (uint64_t group = 0; group < groupCount; ++group) {
+                uint64_t const groupStart = rowGroupIndices[group];
+                uint64_t const groupEnd = rowGroupIndices[group + 1];
+
+                // Only multiply and reduce if there is at least one row in the group.
+                if (groupStart == groupEnd) {
+                    continue;
+                }
+
+                ValueType currentValue = multiplyRow(access, groupStart, vector, summand ? &(*summand)[groupStart] : nullptr);
+
+                // Variables for correctly tracking choices (only update if new choice is strictly better).
+                uint64_t selectedChoice = 0;
+                ValueType oldSelectedChoiceValue = currentValue;
+
+                for (uint64_t row = groupStart + 1; row < groupEnd; ++row) {
+                    ValueType newValue = multiplyRow(access, row, vector, summand ? &(*summand)[row] : nullptr);
+                    if (choices && row - groupStart == (*choices)[group]) {
+                        oldSelectedChoiceValue = newValue;
+                    }
+                    if (compare(newValue, currentValue)) {
+                        currentValue = newValue;
+                        selectedChoice = row - groupStart;
+                    }
+                }
+
+                // Finally write value to target vector.
+                result[group] = currentValue;
+                if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+                    (*choices)[group] = selectedChoice;
+                }
+            }
+        }
+
+        template<typename ValueType>
+        template<typename Compare, typename ValueAccess>
+        void CompressedSparseMatrix<ValueType>::multiplyAndReduceBackward(ValueAccess const& access, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            Compare compare;
+            for (uint64_t group = rowGroupIndices.size() - 1; group > 0;) {
+                --group;
+                uint64_t const groupStart = rowGroupIndices[group];
+                uint64_t const groupEnd = rowGroupIndices[group + 1];
+
+                // Only multiply and reduce if there is at least one row in the group.
+                if (groupStart == groupEnd) {
+                    continue;
+                }
+
+                ValueType currentValue = multiplyRow(access, groupEnd - 1, vector, summand ? &(*summand)[groupEnd - 1] : nullptr);
+
+                // Variables for correctly tracking choices (only update if new choice is strictly better).
+                uint64_t selectedChoice = groupEnd - 1 - groupStart;
+                ValueType oldSelectedChoiceValue = currentValue;
+
+                for (uint64_t row = groupEnd - 1; row > groupStart;) {
+                    --row;
+                    ValueType newValue = multiplyRow(access, row, vector, summand ? &(*summand)[row] : nullptr);
+                    if (choices && row - groupStart == (*choices)[group]) {
+                        oldSelectedChoiceValue = newValue;
+                    }
+                    if (compare(newValue, currentValue)) {
+                        currentValue = newValue;
+                        selectedChoice = row - groupStart;
+                    }
+                }
+
+                // Finally write value to target vector.
+                result[group] = currentValue;
+                if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+                    (*choices)[group] = selectedChoice;
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void CompressedSparseMatrix<ValueType>::multiplyRow(index_type row, std::vector<value_type> const& vector, value_type& value) const {
+            applyWithValueAccess([&] (auto const& access) { value += this->multiplyRow(access, row, vector, nullptr); });
+        }
+
+        template<typename ValueType>
+        void CompressedSparseMatrix<ValueType>::multiplyRow2(index_type row, std::vector<value_type> const& vector1, value_type& value1, std::vector<value_type> const& vector2, value_type& value2) const {
+            applyWithValueAccess([&] (auto const& access) {
+                uint8_t const* data = columnData.data() + rowColumnDataOffsets[row];
+                uint64_t const entryEnd = rowIndications[row + 1];
+                uint64_t column = 0;
+                for (uint64_t entry = rowIndications[row]; entry < entryEnd; ++entry) {
+                    column += detail::decodeVarint(data);
+                    value1 += access(entry) * vector1[column];
+                    value2 += access(entry) * vector2[column];
+                }
+            });
+        }
+
+        template class CompressedSparseMatrix<double>;
+#ifdef STORM_HAVE_CARL
+        template class CompressedSparseMatrix<storm::RationalNumber>;
+        template class CompressedSparseMatrix<storm::RationalFunction>;
+#endif
+    }
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+    namespace storage {
+
+        template<typename ValueType>
+        class SparseMatrix;
+
+        /*!
+         * A read-only representation of a sparse matrix that reduces the number of bytes per entry. The column indices
+         * of each row are stored as a byte stream in which the first column and the differences between consecutive
+         * columns are encoded with a variable number of bytes (seven bits per byte), which exploits that the columns
+         * of a row are sorted and often close to each other. If the matrix only has few distinct values (as it is
+         * typical for transition matrices), the values are stored in a dictionary and each entry only refers to its
+         * value by an 8 or 16 bit index. The entries are decoded on the fly during the multiplication.
+         */
+        template<typename ValueType>
+        class CompressedSparseMatrix {
+        public:
+            typedef uint_fast64_t index_type;
+            typedef ValueType value_type;
+
+            /*!
+             * Creates the compressed representation of the given matrix.
+             *
+             * @param matrix The matrix whose entries are copied.
+             * @param allowValueDictionary If set, the values are stored in a dictionary whenever the number of distinct
+             * values permits it.
+             */
+            CompressedSparseMatrix(SparseMatrix<ValueType> const& matrix, bool allowValueDictionary = true);
+
+            index_type getRowCount() const;
+            index_type getColumnCount() const;
+            index_type getEntryCount() const;
+
+            /*!
+             * Retrieves whether the values are stored in a dictionary.
+             */
+            bool hasValueDictionary() const;
+
+            /*!
+             * Retrieves the number of values in the dictionary (or zero if there is none).
+             */
+            uint64_t getValueDictionarySize() const;
+
+            /*!
+             * Retrieves the (approximate) number of bytes occupied by the entries and the row indications.
+             */
+            uint64_t getSizeInMemory() const;
+
+            /*!
+             * Multiplies the matrix with the given vector and writes the result to the given result vector.
+             * The vector and the result must not be the same.
+             *
+             * @param vector The vector with which to multiply the matrix.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             */
+            void multiplyWithVector(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+
+            /*!
+             * Multiplies the matrix with the given vector processing the rows in ascending (descending) order. The vector
+             * and the result may be the same, in which case the multiplication is performed in Gauss-Seidel style.
+             */
+            void multiplyWithVectorForward(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+            void multiplyWithVectorBackward(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+
+            /*!
+             * Multiplies the matrix with the given vector, adds the summand and reduces the result over the given row
+             * groups. This mirrors the corresponding operations of the sparse matrix, including the choice tracking
+             * (choices are only updated if the new choice is strictly better). The vector and the result may be the
+             * same, in which case the multiplication is performed in Gauss-Seidel style.
+             */
+            void multiplyAndReduceForward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+            void multiplyAndReduceBackward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+
+            /*!
+             * Multiplies the given row with the given vector and adds the result to the given value.
+             */
+            void multiplyRow(index_type row, std::vector<value_type> const& vector, value_type& value) const;
+
+            /*!
+             * Multiplies the given row with both given vectors and adds the results to the given values.
+             */
+            void multiplyRow2(index_type row, std::vector<value_type> const& vector1, value_type& value1, std::vector<value_type> const& vector2, value_type& value2) const;
+
+        private:
+            /*!
+             * Calls the given function with an object that yields the value of an entry given its index, depending on
+             * how the values are stored.
+             */
+            template<typename Function>
+            void applyWithValueAccess(Function const& function) const;
+
+            template<typename ValueAccess>
+            void multiplyWithVectorForward(ValueAccess const& access, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const;
+            template<typename ValueAccess>
+            void multiplyWithVectorBackward(ValueAccess const& access, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const;
+
+            template<typename Compare, typename ValueAccess>
+            void multiplyAndReduceForward(ValueAccess const& access, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+            template<typename Compare, typename ValueAccess>
+            void multiplyAndReduceBackward(ValueAccess const& access, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+
+            template<typename ValueAccess>
+            value_type multiplyRow(ValueAccess const& access, index_type row, std::vector<value_type> const& vector, value_type const* summand) const;
+
+            // The number of columns of the matrix.
+            index_type columnCount;
+
+            // The encoded column indices of all entries.
+            std::vector<uint8_t> columnData;
+
+            // The positions in the column data at which the rows start (plus one past-the-end position).
+            std::vector<uint64_t> rowColumnDataOffsets;
+
+            // A vector indicating the index of the first entry of each row (plus one past-the-end position).
+            std::vector<uint64_t> rowIndications;
+
+            // The distinct values of the matrix (if they are stored in a dictionary).
+            std::vector<value_type> valueDictionary;
+
+            // The indices of the values of the entries in the dictionary. At most one of these is non-empty.
+            std::vector<uint8_t> narrowValueIndices;
+            std::vector<uint16_t> wideValueIndices;
+
+            // The values of the entries if there is no dictionary.
+            std::vector<value_type> values;
+        };
+
+    }
+}
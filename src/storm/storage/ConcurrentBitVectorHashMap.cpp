@@ -0,0 +1,374 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/OutOfRangeException.h"
+
+namespace storm {
+    namespace storage {
+
+        template<class ValueType, class Hash>
+        const uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::slotsPerMigrationChunk;
+
+        template<class ValueType, class Hash>
+        const uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::entryBits;
+
+        template<class ValueType, class Hash>
+        const uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::entryMask;
+
+        template<class ValueType, class Hash>
+        const uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::tagMask;
+
+        template<class ValueType, class Hash>
+        const uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::movedFlag;
+
+        template<class ValueType, class Hash>
+        const uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::firstSegmentBits;
+
+        template<class ValueType, class Hash>
+        const uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::numberOfSegments;
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map, Table const* table, uint64_t slot) : map(map), table(table), slot(slot) {
+            skipEmptySlots();
+        }
+
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator==(ConcurrentBitVectorHashMapIterator const& other) const {
+            return &map == &other.map && table == other.table && slot == other.slot;
+        }
+
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator!=(ConcurrentBitVectorHashMapIterator const& other) const {
+            return !(*this == other);
+        }
+
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator& ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator++(int) {
+            ++slot;
+            skipEmptySlots();
+            return *this;
+        }
+
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator& ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator++() {
+            ++slot;
+            skipEmptySlots();
+            return *this;
+        }
+
+        template<class ValueType, class Hash>
+        std::pair<storm::storage::BitVector, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator*() const {
+            return map.getBucketAndValue((table->slots[slot].load(std::memory_order_relaxed) & entryMask) - 1);
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::skipEmptySlots() {
+            uint64_t numberOfSlots = 1ull << table->sizeExponent;
+            while (slot < numberOfSlots && (table->slots[slot].load(std::memory_order_relaxed) & entryMask) == 0) {
+                ++slot;
+            }
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::Table::Table(uint64_t sizeExponent) : sizeExponent(sizeExponent), slots(new std::atomic<uint64_t>[1ull << sizeExponent]), next(nullptr), nextChunkToMigrate(0), numberOfMigratedChunks(0) {
+            for (uint64_t slot = 0; slot < (1ull << sizeExponent); ++slot) {
+                slots[slot].store(0, std::memory_order_relaxed);
+            }
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::Segment::Segment(uint64_t numberOfEntries, uint64_t wordsPerKey) : keys(new uint64_t[numberOfEntries * wordsPerKey]), values(new ValueType[numberOfEntries]), hashes(new uint64_t[numberOfEntries]) {
+            // Intentionally left empty.
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor) : loadFactor(loadFactor), bucketSize(bucketSize), wordsPerKey(bucketSize / 64), numberOfEntries(0), numberOfElements(0) {
+            STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+            STORM_LOG_ASSERT(loadFactor > 0 && loadFactor < 1, "Load factor must be in (0,1).");
+
+            uint64_t sizeExponent = 1;
+            while (initialSize > 0) {
+                ++sizeExponent;
+                initialSize >>= 1;
+            }
+            firstTable = new Table(sizeExponent);
+            currentTable.store(firstTable);
+            for (auto& segment : segments) {
+                segment.store(nullptr);
+            }
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::~ConcurrentBitVectorHashMap() {
+            Table* table = firstTable;
+            while (table != nullptr) {
+                Table* next = table->next.load();
+                delete table;
+                table = next;
+            }
+            for (auto& segment : segments) {
+                delete segment.load();
+            }
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::size() const {
+            return numberOfElements.load();
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::capacity() const {
+            return 1ull << currentTable.load()->sizeExponent;
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getFirstSlot(Table const* table, uint64_t hash) {
+            return hash >> (64 - table->sizeExponent);
+        }
+
+        template<class ValueType, class Hash>
+        std::pair<typename ConcurrentBitVectorHashMap<ValueType, Hash>::Segment*, uint64_t> ConcurrentBitVectorHashMap<ValueType, Hash>::getSegmentAndOffset(uint64_t entry) const {
+            // Segment i holds the entries [2^(i+f) - 2^f, 2^(i+f+1) - 2^f) where f is the number of bits of the first
+            // segment. Hence, the segment of an entry is determined by the highest set bit of entry + 2^f.
+            uint64_t shiftedEntry = entry + (1ull << firstSegmentBits);
+            uint64_t highestBit = 63 - __builtin_clzll(shiftedEntry);
+            uint64_t segmentIndex = highestBit - firstSegmentBits;
+            Segment* segment = segments[segmentIndex].load(std::memory_order_acquire);
+            if (segment == nullptr) {
+                // Allocate the segment unless another thread was faster.
+                Segment* newSegment = new Segment(1ull << highestBit, wordsPerKey);
+                if (segments[segmentIndex].compare_exchange_strong(segment, newSegment, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    segment = newSegment;
+                } else {
+                    delete newSegment;
+                }
+            }
+            return std::make_pair(segment, shiftedEntry - (1ull << highestBit));
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::createEntry(storm::storage::BitVector const& key, ValueType const& value, uint64_t hash) {
+            uint64_t entry = numberOfEntries.fetch_add(1, std::memory_order_relaxed);
+            STORM_LOG_THROW(entry < entryMask, storm::exceptions::OutOfRangeException, "Too many entries in concurrent hash map.");
+            auto segmentAndOffset = getSegmentAndOffset(entry);
+            uint64_t* keyWords = segmentAndOffset.first->keys.get() + segmentAndOffset.second * wordsPerKey;
+            for (uint64_t word = 0; word < wordsPerKey; ++word) {
+                keyWords[word] = key.getAsInt(word * 64, 64);
+            }
+            segmentAndOffset.first->values[segmentAndOffset.second] = value;
+            segmentAndOffset.first->hashes[segmentAndOffset.second] = hash;
+            return entry;
+        }
+
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::entryMatches(uint64_t entry, storm::storage::BitVector const& key) const {
+            auto segmentAndOffset = getSegmentAndOffset(entry);
+            uint64_t const* keyWords = segmentAndOffset.first->keys.get() + segmentAndOffset.second * wordsPerKey;
+            for (uint64_t word = 0; word < wordsPerKey; ++word) {
+                if (keyWords[word] != key.getAsInt(word * 64, 64)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template<class ValueType, class Hash>
+        ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+            return findOrAddAndGetBucket(key, value).first;
+        }
+
+        template<class ValueType, class Hash>
+        std::pair<ValueType, uint64_t> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value) {
+            STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+            uint64_t hash = hasher(key);
+            uint64_t tag = (hash << entryBits) & tagMask;
+
+            // The entry holding the key is only created once an empty slot was found. If the key is inserted by another
+            // thread in the meantime, the entry remains unused.
+            uint64_t newEntry = entryMask;
+
+            Table* table = currentTable.load(std::memory_order_acquire);
+            while (true) {
+                // Entries may only be added to a table that is not being migrated.
+                if (table->next.load(std::memory_order_acquire) != nullptr) {
+                    table = helpMigration(table);
+                    continue;
+                }
+
+                uint64_t mask = (1ull << table->sizeExponent) - 1;
+                uint64_t slot = getFirstSlot(table, hash);
+                uint64_t content = table->slots[slot].load(std::memory_order_acquire);
+                while (!(content & movedFlag)) {
+                    if (content == 0) {
+                        if (newEntry == entryMask) {
+                            newEntry = createEntry(key, value, hash);
+                        }
+                        // Try to claim the slot. If this fails, content holds the new content of the slot, which is
+                        // then inspected again.
+                        if (table->slots[slot].compare_exchange_strong(content, tag | (newEntry + 1), std::memory_order_acq_rel, std::memory_order_acquire)) {
+                            uint64_t newNumberOfElements = numberOfElements.fetch_add(1, std::memory_order_relaxed) + 1;
+                            if (newNumberOfElements >= loadFactor * (1ull << table->sizeExponent)) {
+                                startMigration(table);
+                            }
+                            return std::make_pair(value, newEntry);
+                        }
+                        continue;
+                    }
+                    if ((content & tagMask) == tag && entryMatches((content & entryMask) - 1, key)) {
+                        uint64_t entry = (content & entryMask) - 1;
+                        return std::make_pair(getValue(entry), entry);
+                    }
+                    slot = (slot + 1) & mask;
+                    content = table->slots[slot].load(std::memory_order_acquire);
+                }
+
+                // The table is being migrated.
+                table = helpMigration(table);
+            }
+        }
+
+        template<class ValueType, class Hash>
+        std::pair<bool, uint64_t> ConcurrentBitVectorHashMap<ValueType, Hash>::findEntry(storm::storage::BitVector const& key) const {
+            STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+            uint64_t hash = hasher(key);
+            uint64_t tag = (hash << entryBits) & tagMask;
+
+            Table* table = currentTable.load(std::memory_order_acquire);
+            while (true) {
+                uint64_t mask = (1ull << table->sizeExponent) - 1;
+                uint64_t slot = getFirstSlot(table, hash);
+                uint64_t content = table->slots[slot].load(std::memory_order_acquire);
+                while (!(content & movedFlag)) {
+                    if (content == 0) {
+                        return std::make_pair(false, 0);
+                    }
+                    if ((content & tagMask) == tag && entryMatches((content & entryMask) - 1, key)) {
+                        return std::make_pair(true, (content & entryMask) - 1);
+                    }
+                    slot = (slot + 1) & mask;
+                    content = table->slots[slot].load(std::memory_order_acquire);
+                }
+
+                // The table is being migrated, so the key may only be found reliably after the migration.
+                table = helpMigration(table);
+            }
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::startMigration(Table* table) {
+            Table* next = nullptr;
+            if (table->next.load(std::memory_order_acquire) == nullptr) {
+                Table* newTable = new Table(table->sizeExponent + 1);
+                if (!table->next.compare_exchange_strong(next, newTable, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    delete newTable;
+                }
+                STORM_LOG_TRACE("Increasing size of concurrent hash map from " << (1ull << table->sizeExponent) << " to " << (1ull << (table->sizeExponent + 1)) << ".");
+            }
+            helpMigration(table);
+        }
+
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::Table* ConcurrentBitVectorHashMap<ValueType, Hash>::helpMigration(Table* table) const {
+            Table* next = table->next.load(std::memory_order_acquire);
+            STORM_LOG_ASSERT(next != nullptr, "Expected table to be migrated.");
+
+            uint64_t numberOfSlots = 1ull << table->sizeExponent;
+            uint64_t numberOfChunks = (numberOfSlots + slotsPerMigrationChunk - 1) / slotsPerMigrationChunk;
+            uint64_t chunk = table->nextChunkToMigrate.fetch_add(1, std::memory_order_relaxed);
+            while (chunk < numberOfChunks) {
+                uint64_t lastSlot = std::min(numberOfSlots, (chunk + 1) * slotsPerMigrationChunk);
+                for (uint64_t slot = chunk * slotsPerMigrationChunk; slot < lastSlot; ++slot) {
+                    // Mark the slot as moved such that no entry can be inserted into it any more.
+                    uint64_t content = table->slots[slot].fetch_or(movedFlag, std::memory_order_acq_rel);
+                    if (content != 0) {
+                        insertMigratedSlot(next, content);
+                    }
+                }
+                table->numberOfMigratedChunks.fetch_add(1, std::memory_order_acq_rel);
+                chunk = table->nextChunkToMigrate.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            // Wait for the other threads to finish their chunks.
+            while (table->numberOfMigratedChunks.load(std::memory_order_acquire) < numberOfChunks) {
+                std::this_thread::yield();
+            }
+
+            Table* expected = table;
+            currentTable.compare_exchange_strong(expected, next, std::memory_order_acq_rel, std::memory_order_acquire);
+            return next;
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::insertMigratedSlot(Table* table, uint64_t content) const {
+            auto segmentAndOffset = getSegmentAndOffset((content & entryMask) - 1);
+            uint64_t mask = (1ull << table->sizeExponent) - 1;
+            uint64_t slot = getFirstSlot(table, segmentAndOffset.first->hashes[segmentAndOffset.second]);
+            while (true) {
+                uint64_t expected = 0;
+                if (table->slots[slot].compare_exchange_strong(expected, content, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                    return;
+                }
+                slot = (slot + 1) & mask;
+            }
+        }
+
+        template<class ValueType, class Hash>
+        std::pair<storm::storage::BitVector, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::getBucketAndValue(uint64_t bucket) const {
+            auto segmentAndOffset = getSegmentAndOffset(bucket);
+            uint64_t const* keyWords = segmentAndOffset.first->keys.get() + segmentAndOffset.second * wordsPerKey;
+            storm::storage::BitVector key(bucketSize);
+            for (uint64_t word = 0; word < wordsPerKey; ++word) {
+                key.setFromInt(word * 64, 64, keyWords[word]);
+            }
+            return std::make_pair(std::move(key), segmentAndOffset.first->values[segmentAndOffset.second]);
+        }
+
+        template<class ValueType, class Hash>
+        ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(storm::storage::BitVector const& key) const {
+            std::pair<bool, uint64_t> flagEntryPair = this->findEntry(key);
+            STORM_LOG_ASSERT(flagEntryPair.first, "Unknown key.");
+            return getValue(flagEntryPair.second);
+        }
+
+        template<class ValueType, class Hash>
+        ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(uint64_t bucket) const {
+            auto segmentAndOffset = getSegmentAndOffset(bucket);
+            return segmentAndOffset.first->values[segmentAndOffset.second];
+        }
+
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
+            return findEntry(key).first;
+        }
+
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash>::begin() const {
+            return const_iterator(*this, currentTable.load(), 0);
+        }
+
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash>::end() const {
+            Table const* table = currentTable.load();
+            return const_iterator(*this, table, 1ull << table->sizeExponent);
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::remap(std::function<ValueType(ValueType const&)> const& remapping) {
+            Table const* table = currentTable.load();
+            for (uint64_t slot = 0; slot < (1ull << table->sizeExponent); ++slot) {
+                uint64_t content = table->slots[slot].load(std::memory_order_relaxed);
+                if (content != 0) {
+                    auto segmentAndOffset = getSegmentAndOffset((content & entryMask) - 1);
+                    ValueType& value = segmentAndOffset.first->values[segmentAndOffset.second];
+                    value = remapping(value);
+                }
+            }
+        }
+
+        template class ConcurrentBitVectorHashMap<uint64_t>;
+        template class ConcurrentBitVectorHashMap<uint32_t>;
+    }
+}
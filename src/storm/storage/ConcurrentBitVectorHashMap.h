@@ -0,0 +1,302 @@
+#ifndef STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+#define STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * This class represents a hash-map whose keys are bit vectors that may be queried and extended by several
+         * threads concurrently. It offers the same queries and insertions as BitVectorHashMap. Like there, the keys
+         * must be bit vectors with a length that is a multiple of 64.
+         *
+         * The keys and values are stored in an append-only storage that is never relocated. The hash table itself only
+         * consists of 64-bit slots (referring to an entry of the storage), into which new entries are inserted via
+         * compare-and-swap. If the load of the table becomes too high, a table of twice the size is allocated and the
+         * slots are migrated in chunks by all threads that access the map, i.e. there is no global lock. Note that the
+         * tables that were replaced are only released on destruction of the map (their overall size is bounded by the
+         * size of the current table).
+         *
+         * Unless noted otherwise, all methods may be called concurrently.
+         */
+        template<typename ValueType, typename Hash = Murmur3BitVectorHash<uint64_t>>
+        class ConcurrentBitVectorHashMap {
+        private:
+            struct Table;
+
+        public:
+            class ConcurrentBitVectorHashMapIterator {
+            public:
+                /*!
+                 * Creates an iterator that points to the first occupied slot (starting from the given one) of the given
+                 * table of the given map.
+                 *
+                 * @param map The map of the iterator.
+                 * @param table The table of the map over whose slots to iterate.
+                 * @param slot The index of the slot at which to start.
+                 */
+                ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map, Table const* table, uint64_t slot);
+
+                // Methods to compare two iterators.
+                bool operator==(ConcurrentBitVectorHashMapIterator const& other) const;
+                bool operator!=(ConcurrentBitVectorHashMapIterator const& other) const;
+
+                // Methods to move iterator forward.
+                ConcurrentBitVectorHashMapIterator& operator++(int);
+                ConcurrentBitVectorHashMapIterator& operator++();
+
+                // Method to retrieve the currently pointed-to bit vector and its mapped-to value.
+                std::pair<storm::storage::BitVector, ValueType> operator*() const;
+
+            private:
+                // Moves the iterator to the next occupied slot (including the current one).
+                void skipEmptySlots();
+
+                // The map this iterator refers to.
+                ConcurrentBitVectorHashMap const& map;
+
+                // The table whose slots are traversed.
+                Table const* table;
+
+                // The slot this iterator points to.
+                uint64_t slot;
+            };
+
+            typedef ConcurrentBitVectorHashMapIterator const_iterator;
+
+            /*!
+             * Creates a new hash map with the given bucket size and initial size.
+             *
+             * @param bucketSize The size of the buckets that this map can hold. This value must be a multiple of 64.
+             * @param initialSize The number of buckets that is initially available.
+             * @param loadFactor The load factor that determines at which point the size of the underlying storage is
+             * increased.
+             */
+            ConcurrentBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75);
+
+            ConcurrentBitVectorHashMap(ConcurrentBitVectorHashMap const&) = delete;
+            ConcurrentBitVectorHashMap& operator=(ConcurrentBitVectorHashMap const&) = delete;
+
+            ~ConcurrentBitVectorHashMap();
+
+            /*!
+             * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+             * key is inserted with the given value.
+             *
+             * @param key The key to search or insert.
+             * @param value The value that is inserted if the key is not already found in the map.
+             * @return The found value if the key is already contained in the map and the provided new value otherwise.
+             */
+            ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+            /*!
+             * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+             * key is inserted with the given value.
+             *
+             * @param key The key to search or insert.
+             * @param value The value that is inserted if the key is not already found in the map.
+             * @return A pair whose first component is the found value if the key is already contained in the map and
+             * the provided new value otherwise and whose second component is the index of the bucket in which the key
+             * is stored. Other than for BitVectorHashMap, the index of the bucket never changes.
+             */
+            std::pair<ValueType, uint64_t> findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value);
+
+            /*!
+             * Retrieves the key stored in the given bucket and the value it is mapped to.
+             *
+             * @param bucket The index of the bucket.
+             * @return The content and value of the named bucket.
+             */
+            std::pair<storm::storage::BitVector, ValueType> getBucketAndValue(uint64_t bucket) const;
+
+            /*!
+             * Retrieves the value associated with the given key (if any). If the key does not exist, the behaviour is
+             * undefined.
+             *
+             * @return The value associated with the given key (if any).
+             */
+            ValueType getValue(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Retrieves the value associated with the given bucket.
+             *
+             * @return The value associated with the given bucket.
+             */
+            ValueType getValue(uint64_t bucket) const;
+
+            /*!
+             * Checks if the given key is already contained in the map.
+             *
+             * @param key The key to search
+             * @return True if the key is already contained in the map
+             */
+            bool contains(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Retrieves an iterator to the elements of the map. Must not be called while the map is modified.
+             *
+             * @return The iterator.
+             */
+            const_iterator begin() const;
+
+            /*!
+             * Retrieves an iterator that points one past the elements of the map. Must not be called while the map is
+             * modified.
+             *
+             * @return The iterator.
+             */
+            const_iterator end() const;
+
+            /*!
+             * Retrieves the size of the map in terms of the number of key-value pairs it stores.
+             *
+             * @return The size of the map.
+             */
+            uint64_t size() const;
+
+            /*!
+             * Retrieves the capacity of the underlying container.
+             *
+             * @return The capacity of the underlying container.
+             */
+            uint64_t capacity() const;
+
+            /*!
+             * Performs a remapping of all values stored by applying the given remapping. Must not be called while the
+             * map is accessed by other threads.
+             *
+             * @param remapping The remapping to apply.
+             */
+            void remap(std::function<ValueType(ValueType const&)> const& remapping);
+
+        private:
+            // The number of slots that a thread migrates at once. This determines the granularity of the load balancing
+            // during migrations.
+            static const uint64_t slotsPerMigrationChunk = 4096;
+
+            // The layout of the slots: the lower bits hold the index of the entry plus one (zero marks an empty slot),
+            // followed by some bits of the hash value of the key (to avoid comparing keys of other entries) and a flag
+            // that indicates that the slot was migrated to the next table.
+            static const uint64_t entryBits = 40;
+            static const uint64_t entryMask = (1ull << entryBits) - 1;
+            static const uint64_t tagMask = ((1ull << 63) - 1) & ~entryMask;
+            static const uint64_t movedFlag = 1ull << 63;
+
+            // The first segment of the entry storage holds 2^firstSegmentBits entries and each further one twice as
+            // many as the previous one.
+            static const uint64_t firstSegmentBits = 10;
+            static const uint64_t numberOfSegments = entryBits - firstSegmentBits + 1;
+
+            struct Table {
+                Table(uint64_t sizeExponent);
+
+                // The number of slots is 2^sizeExponent.
+                uint64_t sizeExponent;
+
+                // The slots of the table.
+                std::unique_ptr<std::atomic<uint64_t>[]> slots;
+
+                // The table into which the slots are migrated (if any).
+                std::atomic<Table*> next;
+
+                // The next chunk of slots that is to be migrated and the number of chunks that were migrated.
+                std::atomic<uint64_t> nextChunkToMigrate;
+                std::atomic<uint64_t> numberOfMigratedChunks;
+            };
+
+            struct Segment {
+                Segment(uint64_t numberOfEntries, uint64_t wordsPerKey);
+
+                std::unique_ptr<uint64_t[]> keys;
+                std::unique_ptr<ValueType[]> values;
+                std::unique_ptr<uint64_t[]> hashes;
+            };
+
+            /*!
+             * Stores the given key-value pair in a new entry of the storage (without making it visible in the table).
+             *
+             * @return The index of the new entry.
+             */
+            uint64_t createEntry(storm::storage::BitVector const& key, ValueType const& value, uint64_t hash);
+
+            /*!
+             * Retrieves the segment and the offset within the segment of the given entry.
+             */
+            std::pair<Segment*, uint64_t> getSegmentAndOffset(uint64_t entry) const;
+
+            /*!
+             * Checks whether the given entry holds the given key.
+             */
+            bool entryMatches(uint64_t entry, storm::storage::BitVector const& key) const;
+
+            /*!
+             * Searches the given key in the current table.
+             *
+             * @return A pair whose first component indicates whether the key is contained in the map and whose second
+             * component is the index of the corresponding entry.
+             */
+            std::pair<bool, uint64_t> findEntry(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Allocates the next table for the given table (unless another thread did so already) and helps migrating
+             * the slots.
+             */
+            void startMigration(Table* table);
+
+            /*!
+             * Migrates chunks of the given table until all chunks have been migrated (possibly by other threads).
+             *
+             * @return The table into which the slots were migrated.
+             */
+            Table* helpMigration(Table* table) const;
+
+            /*!
+             * Inserts the given slot (which refers to an entry that is not yet contained in the table) into the table.
+             */
+            void insertMigratedSlot(Table* table, uint64_t slot) const;
+
+            /*!
+             * Retrieves the index of the slot at which the search for a key with the given hash value starts.
+             */
+            static uint64_t getFirstSlot(Table const* table, uint64_t hash);
+
+            // The load factor determining when the size of the map is increased.
+            double loadFactor;
+
+            // The size of one bucket.
+            uint64_t bucketSize;
+
+            // The number of 64-bit words of one bucket.
+            uint64_t wordsPerKey;
+
+            // The first table of the map. All later tables are linked from there.
+            Table* firstTable;
+
+            // The table in which all entries are currently found.
+            mutable std::atomic<Table*> currentTable;
+
+            // The segments of the storage of entries (allocated on demand).
+            mutable std::array<std::atomic<Segment*>, numberOfSegments> segments;
+
+            // The number of entries created so far (including the ones that turned out to be superfluous as the key was
+            // concurrently inserted by a different thread).
+            std::atomic<uint64_t> numberOfEntries;
+
+            // The number of elements in this map.
+            std::atomic<uint64_t> numberOfElements;
+
+            // Functor object that are used to perform the actual hashing.
+            Hash hasher;
+        };
+
+    }
+}
+
+#endif /* STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_ */
@@ -0,0 +1,272 @@
+#include "storm/storage/ExternalBitVectorMap.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace storage {
+
+        template<typename ValueType>
+        const uint64_t ExternalBitVectorMap<ValueType>::recordsPerBlock;
+
+        template<typename ValueType>
+        const uint64_t ExternalBitVectorMap<ValueType>::numberOfBloomFilterHashes;
+
+        template<typename ValueType>
+        ExternalBitVectorMap<ValueType>::Run::Run(std::string const& directory) : file(std::make_unique<storm::io::TemporaryFile>(directory)), numberOfRecords(0) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        ExternalBitVectorMap<ValueType>::ExternalBitVectorMap(uint64_t bucketSize, uint64_t bloomFilterSize, std::string const& directory) : wordsPerKey(bucketSize / 64), directory(directory), bloomFilter(std::max<uint64_t>(bloomFilterSize * 8, 64)), numberOfElements(0) {
+            STORM_LOG_THROW(bucketSize % 64 == 0, storm::exceptions::InvalidArgumentException, "Bucket size must be a multiple of 64.");
+        }
+
+        template<typename ValueType>
+        void ExternalBitVectorMap<ValueType>::add(BitVectorHashMap<ValueType> const& map) {
+            if (map.size() == 0) {
+                return;
+            }
+
+            // Gather the records of the map and sort them.
+            uint64_t const recordSize = wordsPerKey + 1;
+            std::vector<uint64_t> records;
+            records.reserve(map.size() * recordSize);
+            uint64_t positions[numberOfBloomFilterHashes];
+            for (auto const& keyValuePair : map) {
+                for (uint64_t word = 0; word < wordsPerKey; ++word) {
+                    records.push_back(keyValuePair.first.getAsInt(word * 64, 64));
+                }
+                records.push_back(static_cast<uint64_t>(keyValuePair.second));
+
+                getBloomFilterPositions(keyValuePair.first, positions);
+                for (uint64_t const& position : positions) {
+                    bloomFilter.set(position);
+                }
+            }
+
+            std::vector<uint64_t> order(map.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::sort(order.begin(), order.end(), [&] (uint64_t const& first, uint64_t const& second) { return compareKeys(&records[first * recordSize], &records[second * recordSize]) < 0; });
+            std::vector<uint64_t> sortedRecords;
+            sortedRecords.reserve(records.size());
+            for (auto const& index : order) {
+                sortedRecords.insert(sortedRecords.end(), records.begin() + index * recordSize, records.begin() + (index + 1) * recordSize);
+            }
+            records.clear();
+            records.shrink_to_fit();
+            order.clear();
+            order.shrink_to_fit();
+
+            addRun(sortedRecords);
+            numberOfElements += map.size();
+        }
+
+        template<typename ValueType>
+        void ExternalBitVectorMap<ValueType>::addRun(std::vector<uint64_t> const& sortedRecords) {
+            runs.emplace_back(directory);
+            appendToRun(runs.back(), sortedRecords.data(), sortedRecords.size() / (wordsPerKey + 1));
+
+            // Merge runs as long as the last run is not considerably smaller than the one before. This way, the sizes of
+            // the runs (at least) halve from one run to the next, so there are only logarithmically many.
+            while (runs.size() > 1 && 2 * runs.back().numberOfRecords >= runs[runs.size() - 2].numberOfRecords) {
+                mergeLastRuns();
+            }
+        }
+
+        template<typename ValueType>
+        void ExternalBitVectorMap<ValueType>::appendToRun(Run& run, uint64_t const* records, uint64_t numberOfRecords) const {
+            uint64_t const recordSize = wordsPerKey + 1;
+            for (uint64_t record = 0; record < numberOfRecords; ++record) {
+                if ((run.numberOfRecords + record) % recordsPerBlock == 0) {
+                    run.blockKeys.insert(run.blockKeys.end(), records + record * recordSize, records + record * recordSize + wordsPerKey);
+                }
+            }
+            run.file->append(records, numberOfRecords * recordSize * sizeof(uint64_t));
+            run.numberOfRecords += numberOfRecords;
+        }
+
+        template<typename ValueType>
+        void ExternalBitVectorMap<ValueType>::mergeLastRuns() {
+            uint64_t const recordSize = wordsPerKey + 1;
+            uint64_t const bufferRecords = 16 * recordsPerBlock;
+
+            Run merged(directory);
+            Run const& first = runs[runs.size() - 2];
+            Run const& second = runs.back();
+
+            // Reads the next records of the given run into the given buffer.
+            auto refill = [&] (Run const& run, uint64_t& nextRecord, std::vector<uint64_t>& buffer, uint64_t& position) {
+                uint64_t count = std::min(bufferRecords, run.numberOfRecords - nextRecord);
+                buffer.resize(count * recordSize);
+                if (count > 0) {
+                    run.file->read(nextRecord * recordSize * sizeof(uint64_t), buffer.data(), count * recordSize * sizeof(uint64_t));
+                }
+                nextRecord += count;
+                position = 0;
+            };
+
+            std::vector<uint64_t> firstBuffer, secondBuffer, outputBuffer;
+            uint64_t firstNext = 0, secondNext = 0, firstPosition = 0, secondPosition = 0;
+            refill(first, firstNext, firstBuffer, firstPosition);
+            refill(second, secondNext, secondBuffer, secondPosition);
+            outputBuffer.reserve(bufferRecords * recordSize);
+
+            while (!firstBuffer.empty() || !secondBuffer.empty()) {
+                bool takeFirst = secondBuffer.empty() || (!firstBuffer.empty() && compareKeys(&firstBuffer[firstPosition], &secondBuffer[secondPosition]) < 0);
+                if (takeFirst) {
+                    outputBuffer.insert(outputBuffer.end(), firstBuffer.begin() + firstPosition, firstBuffer.begin() + firstPosition + recordSize);
+                    firstPosition += recordSize;
+                    if (firstPosition == firstBuffer.size()) {
+                        refill(first, firstNext, firstBuffer, firstPosition);
+                    }
+                } else {
+                    outputBuffer.insert(outputBuffer.end(), secondBuffer.begin() + secondPosition, secondBuffer.begin() + secondPosition + recordSize);
+                    secondPosition += recordSize;
+                    if (secondPosition == secondBuffer.size()) {
+                        refill(second, secondNext, secondBuffer, secondPosition);
+                    }
+                }
+                if (outputBuffer.size() == bufferRecords * recordSize) {
+                    appendToRun(merged, outputBuffer.data(), bufferRecords);
+                    outputBuffer.clear();
+                }
+            }
+            appendToRun(merged, outputBuffer.data(), outputBuffer.size() / recordSize);
+
+            runs.pop_back();
+            runs.back() = std::move(merged);
+        }
+
+        template<typename ValueType>
+        int ExternalBitVectorMap<ValueType>::compareKeys(uint64_t const* first, uint64_t const* second) const {
+            for (uint64_t word = 0; word < wordsPerKey; ++word) {
+                if (first[word] != second[word]) {
+                    return first[word] < second[word] ? -1 : 1;
+                }
+            }
+            return 0;
+        }
+
+        template<typename ValueType>
+        void ExternalBitVectorMap<ValueType>::getBloomFilterPositions(storm::storage::BitVector const& key, uint64_t* positions) const {
+            // Derive the positions from one hash value by double hashing.
+            uint64_t hash = hasher(key);
+            uint64_t step = (hash >> 32) | 1;
+            for (uint64_t index = 0; index < numberOfBloomFilterHashes; ++index) {
+                positions[index] = (hash + index * step) % bloomFilter.size();
+            }
+        }
+
+        template<typename ValueType>
+        std::pair<bool, ValueType> ExternalBitVectorMap<ValueType>::find(storm::storage::BitVector const& key) const {
+            uint64_t positions[numberOfBloomFilterHashes];
+            getBloomFilterPositions(key, positions);
+            for (uint64_t const& position : positions) {
+                if (!bloomFilter.get(position)) {
+                    return std::make_pair(false, ValueType());
+                }
+            }
+
+            std::vector<uint64_t> keyWords(wordsPerKey);
+            for (uint64_t word = 0; word < wordsPerKey; ++word) {
+                keyWords[word] = key.getAsInt(word * 64, 64);
+            }
+            for (auto const& run : runs) {
+                auto result = findInRun(run, keyWords.data());
+                if (result.first) {
+                    return result;
+                }
+            }
+            return std::make_pair(false, ValueType());
+        }
+
+        template<typename ValueType>
+        std::pair<bool, ValueType> ExternalBitVectorMap<ValueType>::findInRun(Run const& run, uint64_t const* key) const {
+            uint64_t const recordSize = wordsPerKey + 1;
+            uint64_t numberOfBlocks = run.blockKeys.size() / wordsPerKey;
+
+            // Find the last block whose first key is not larger than the given key.
+            uint64_t lowerBlock = 0;
+            uint64_t upperBlock = numberOfBlocks;
+            while (upperBlock - lowerBlock > 1) {
+                uint64_t middle = (lowerBlock + upperBlock) / 2;
+                if (compareKeys(&run.blockKeys[middle * wordsPerKey], key) <= 0) {
+                    lowerBlock = middle;
+                } else {
+                    upperBlock = middle;
+                }
+            }
+            if (numberOfBlocks == 0 || compareKeys(&run.blockKeys[lowerBlock * wordsPerKey], key) > 0) {
+                return std::make_pair(false, ValueType());
+            }
+
+            // Read the block and search the key therein.
+            uint64_t firstRecord = lowerBlock * recordsPerBlock;
+            uint64_t numberOfRecords = std::min(recordsPerBlock, run.numberOfRecords - firstRecord);
+            std::vector<uint64_t> block(numberOfRecords * recordSize);
+            run.file->read(firstRecord * recordSize * sizeof(uint64_t), block.data(), block.size() * sizeof(uint64_t));
+
+            uint64_t lower = 0;
+            uint64_t upper = numberOfRecords;
+            while (lower < upper) {
+                uint64_t middle = (lower + upper) / 2;
+                int comparison = compareKeys(&block[middle * recordSize], key);
+                if (comparison == 0) {
+                    return std::make_pair(true, static_cast<ValueType>(block[middle * recordSize + wordsPerKey]));
+                } else if (comparison < 0) {
+                    lower = middle + 1;
+                } else {
+                    upper = middle;
+                }
+            }
+            return std::make_pair(false, ValueType());
+        }
+
+        template<typename ValueType>
+        bool ExternalBitVectorMap<ValueType>::contains(storm::storage::BitVector const& key) const {
+            return find(key).first;
+        }
+
+        template<typename ValueType>
+        ValueType ExternalBitVectorMap<ValueType>::getValue(storm::storage::BitVector const& key) const {
+            return find(key).second;
+        }
+
+        template<typename ValueType>
+        void ExternalBitVectorMap<ValueType>::forEach(std::function<void(storm::storage::BitVector const&, ValueType const&)> const& function) const {
+            uint64_t const recordSize = wordsPerKey + 1;
+            storm::storage::BitVector key(wordsPerKey * 64);
+            std::vector<uint64_t> buffer;
+            for (auto const& run : runs) {
+                for (uint64_t firstRecord = 0; firstRecord < run.numberOfRecords; firstRecord += recordsPerBlock) {
+                    uint64_t numberOfRecords = std::min(recordsPerBlock, run.numberOfRecords - firstRecord);
+                    buffer.resize(numberOfRecords * recordSize);
+                    run.file->read(firstRecord * recordSize * sizeof(uint64_t), buffer.data(), buffer.size() * sizeof(uint64_t));
+                    for (uint64_t record = 0; record < numberOfRecords; ++record) {
+                        for (uint64_t word = 0; word < wordsPerKey; ++word) {
+                            key.setFromInt(word * 64, 64, buffer[record * recordSize + word]);
+                        }
+                        function(key, static_cast<ValueType>(buffer[record * recordSize + wordsPerKey]));
+                    }
+                }
+            }
+        }
+
+        template<typename ValueType>
+        uint64_t ExternalBitVectorMap<ValueType>::size() const {
+            return numberOfElements;
+        }
+
+        template<typename ValueType>
+        uint64_t ExternalBitVectorMap<ValueType>::getNumberOfRuns() const {
+            return runs.size();
+        }
+
+        template class ExternalBitVectorMap<uint64_t>;
+        template class ExternalBitVectorMap<uint32_t>;
+    }
+}
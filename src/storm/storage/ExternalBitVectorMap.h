@@ -0,0 +1,156 @@
+#ifndef STORM_STORAGE_EXTERNALBITVECTORMAP_H_
+#define STORM_STORAGE_EXTERNALBITVECTORMAP_H_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/io/TemporaryFile.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * This class represents a map whose keys are bit vectors and that resides in temporary files (except for a
+         * small index and a Bloom filter). It is meant to hold the elements that do not fit into an in-memory
+         * BitVectorHashMap: the elements of such a map are moved to the external map in bulk and are then only queried.
+         *
+         * Every bulk of elements is stored as a run of records sorted by key. Lookups first consult the Bloom filter
+         * (which, for elements not contained in the map, mostly avoids to access the files at all) and then search the
+         * runs, where the in-memory index of every run allows to read only one block of records per run. To keep the
+         * number of runs logarithmic in the number of elements, runs of similar size are merged.
+         *
+         * Lookups may be performed concurrently (but not concurrently to adding elements).
+         */
+        template<typename ValueType>
+        class ExternalBitVectorMap {
+        public:
+            /*!
+             * Creates an empty external map.
+             *
+             * @param bucketSize The size of the keys. This value must be a multiple of 64.
+             * @param bloomFilterSize The number of bytes used for the Bloom filter.
+             * @param directory The directory in which the temporary files are created (if empty, the default directory
+             * for temporary files is used).
+             */
+            ExternalBitVectorMap(uint64_t bucketSize, uint64_t bloomFilterSize, std::string const& directory = "");
+
+            /*!
+             * Adds all elements of the given map. None of the keys must be contained in this map already.
+             *
+             * @param map The map whose elements to add.
+             */
+            void add(BitVectorHashMap<ValueType> const& map);
+
+            /*!
+             * Searches for the given key.
+             *
+             * @param key The key to search for.
+             * @return A pair whose first component indicates whether the key is contained in the map and whose second
+             * component is the value the key is mapped to (if it is contained).
+             */
+            std::pair<bool, ValueType> find(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Checks if the given key is contained in the map.
+             */
+            bool contains(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Retrieves the value associated with the given key. If the key does not exist, the behaviour is undefined.
+             */
+            ValueType getValue(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Applies the given function to all elements of the map (in no particular order).
+             */
+            void forEach(std::function<void(storm::storage::BitVector const&, ValueType const&)> const& function) const;
+
+            /*!
+             * Retrieves the number of elements of the map.
+             */
+            uint64_t size() const;
+
+            /*!
+             * Retrieves the number of runs that currently make up the map.
+             */
+            uint64_t getNumberOfRuns() const;
+
+        private:
+            // A sorted sequence of records in a temporary file, where each record consists of the words of the key
+            // followed by the value (as a 64-bit word).
+            struct Run {
+                Run(std::string const& directory);
+
+                std::unique_ptr<storm::io::TemporaryFile> file;
+
+                // The number of records in this run.
+                uint64_t numberOfRecords;
+
+                // The keys of the first records of all blocks of the run.
+                std::vector<uint64_t> blockKeys;
+            };
+
+            /*!
+             * Compares the given (raw) keys lexicographically.
+             */
+            int compareKeys(uint64_t const* first, uint64_t const* second) const;
+
+            /*!
+             * Writes the given sorted records as a new run.
+             */
+            void addRun(std::vector<uint64_t> const& sortedRecords);
+
+            /*!
+             * Appends the given records to the given run (and updates the index of the run).
+             */
+            void appendToRun(Run& run, uint64_t const* records, uint64_t numberOfRecords) const;
+
+            /*!
+             * Merges the last two runs into one.
+             */
+            void mergeLastRuns();
+
+            /*!
+             * Searches the given (raw) key in the given run.
+             */
+            std::pair<bool, ValueType> findInRun(Run const& run, uint64_t const* key) const;
+
+            /*!
+             * Retrieves the positions of the given key in the Bloom filter.
+             */
+            void getBloomFilterPositions(storm::storage::BitVector const& key, uint64_t* positions) const;
+
+            // The number of records per block of a run.
+            static const uint64_t recordsPerBlock = 256;
+
+            // The number of hash functions of the Bloom filter.
+            static const uint64_t numberOfBloomFilterHashes = 3;
+
+            // The number of words of one key.
+            uint64_t wordsPerKey;
+
+            // The directory for temporary files.
+            std::string directory;
+
+            // The runs making up this map.
+            std::vector<Run> runs;
+
+            // The Bloom filter of all keys.
+            storm::storage::BitVector bloomFilter;
+
+            // The number of elements of the map.
+            uint64_t numberOfElements;
+
+            // Functor object that is used for hashing.
+            Murmur3BitVectorHash<uint64_t> hasher;
+        };
+
+    }
+}
+
+#endif /* STORM_STORAGE_EXTERNALBITVECTORMAP_H_ */
@@ -0,0 +1,82 @@
+#include "storm/storage/ExternalBitVectorQueue.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace storage {
+
+        template<typename ValueType>
+        ExternalBitVectorQueue<ValueType>::ExternalBitVectorQueue(uint64_t bucketSize, uint64_t bufferSize, std::string const& directory) : wordsPerKey(bucketSize / 64), bufferSize(std::max<uint64_t>(bufferSize, 1)), file(directory), nextRecordInFile(0), readPosition(0), numberOfElements(0) {
+            STORM_LOG_THROW(bucketSize % 64 == 0, storm::exceptions::InvalidArgumentException, "Bucket size must be a multiple of 64.");
+        }
+
+        template<typename ValueType>
+        void ExternalBitVectorQueue<ValueType>::push(storm::storage::BitVector const& key, ValueType const& value) {
+            for (uint64_t word = 0; word < wordsPerKey; ++word) {
+                writeBuffer.push_back(key.getAsInt(word * 64, 64));
+            }
+            writeBuffer.push_back(static_cast<uint64_t>(value));
+            ++numberOfElements;
+
+            if (writeBuffer.size() >= bufferSize * (wordsPerKey + 1)) {
+                flush();
+            }
+        }
+
+        template<typename ValueType>
+        void ExternalBitVectorQueue<ValueType>::flush() {
+            file.append(writeBuffer.data(), writeBuffer.size() * sizeof(uint64_t));
+            writeBuffer.clear();
+        }
+
+        template<typename ValueType>
+        std::pair<storm::storage::BitVector, ValueType> ExternalBitVectorQueue<ValueType>::pop() {
+            STORM_LOG_ASSERT(!empty(), "Cannot pop from empty queue.");
+            uint64_t const recordSize = wordsPerKey + 1;
+
+            if (readPosition == readBuffer.size()) {
+                uint64_t recordsInFile = file.getSize() / (recordSize * sizeof(uint64_t));
+                if (nextRecordInFile < recordsInFile) {
+                    // Read the next elements from the file.
+                    uint64_t count = std::min(bufferSize, recordsInFile - nextRecordInFile);
+                    readBuffer.resize(count * recordSize);
+                    file.read(nextRecordInFile * recordSize * sizeof(uint64_t), readBuffer.data(), readBuffer.size() * sizeof(uint64_t));
+                    nextRecordInFile += count;
+                } else {
+                    // All elements of the file were read, so the remaining ones are in the write buffer and the file
+                    // can be emptied.
+                    file.clear();
+                    nextRecordInFile = 0;
+                    std::swap(readBuffer, writeBuffer);
+                    writeBuffer.clear();
+                }
+                readPosition = 0;
+            }
+
+            storm::storage::BitVector key(wordsPerKey * 64);
+            for (uint64_t word = 0; word < wordsPerKey; ++word) {
+                key.setFromInt(word * 64, 64, readBuffer[readPosition + word]);
+            }
+            ValueType value = static_cast<ValueType>(readBuffer[readPosition + wordsPerKey]);
+            readPosition += recordSize;
+            --numberOfElements;
+            return std::make_pair(std::move(key), value);
+        }
+
+        template<typename ValueType>
+        bool ExternalBitVectorQueue<ValueType>::empty() const {
+            return numberOfElements == 0;
+        }
+
+        template<typename ValueType>
+        uint64_t ExternalBitVectorQueue<ValueType>::size() const {
+            return numberOfElements;
+        }
+
+        template class ExternalBitVectorQueue<uint64_t>;
+        template class ExternalBitVectorQueue<uint32_t>;
+    }
+}
@@ -0,0 +1,83 @@
+#ifndef STORM_STORAGE_EXTERNALBITVECTORQUEUE_H_
+#define STORM_STORAGE_EXTERNALBITVECTORQUEUE_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/io/TemporaryFile.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * A FIFO queue of pairs of bit vectors (of fixed size) and values that keeps only a bounded number of elements
+         * in memory and stores all others in a temporary file.
+         */
+        template<typename ValueType>
+        class ExternalBitVectorQueue {
+        public:
+            /*!
+             * Creates an empty queue.
+             *
+             * @param bucketSize The size of the bit vectors. This value must be a multiple of 64.
+             * @param bufferSize The number of elements that are buffered when writing to (and reading from) the file.
+             * @param directory The directory in which the temporary file is created (if empty, the default directory
+             * for temporary files is used).
+             */
+            ExternalBitVectorQueue(uint64_t bucketSize, uint64_t bufferSize, std::string const& directory = "");
+
+            /*!
+             * Appends the given element to the queue.
+             */
+            void push(storm::storage::BitVector const& key, ValueType const& value);
+
+            /*!
+             * Removes the first element of the queue and returns it. The queue must not be empty.
+             */
+            std::pair<storm::storage::BitVector, ValueType> pop();
+
+            /*!
+             * Checks whether the queue is empty.
+             */
+            bool empty() const;
+
+            /*!
+             * Retrieves the number of elements in the queue.
+             */
+            uint64_t size() const;
+
+        private:
+            /*!
+             * Writes the elements of the write buffer to the file.
+             */
+            void flush();
+
+            // The number of words of one bit vector.
+            uint64_t wordsPerKey;
+
+            // The number of elements that are buffered.
+            uint64_t bufferSize;
+
+            // The file holding the elements between the read and the write buffer.
+            storm::io::TemporaryFile file;
+
+            // The offset (in records) of the first element in the file that is not yet read.
+            uint64_t nextRecordInFile;
+
+            // The buffer of the first elements of the queue and the position of the first element in this buffer.
+            std::vector<uint64_t> readBuffer;
+            uint64_t readPosition;
+
+            // The buffer of the last elements of the queue.
+            std::vector<uint64_t> writeBuffer;
+
+            // The number of elements in the queue.
+            uint64_t numberOfElements;
+        };
+
+    }
+}
+
+#endif /* STORM_STORAGE_EXTERNALBITVECTORQUEUE_H_ */
@@ -0,0 +1,151 @@
+#include "storm/storage/ExternalSparseMatrixBuilder.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidStateException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace storage {
+
+        namespace detail {
+            // The entries are written to the file as they are laid out in memory, which is only valid for values of
+            // primitive type.
+            template<typename ValueType>
+            void checkExternalStorageSupported() {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Storing matrix entries externally is only supported for double precision values.");
+            }
+
+            template<>
+            void checkExternalStorageSupported<double>() {
+                // Intentionally left empty.
+            }
+        }
+
+        template<typename ValueType>
+        ExternalSparseMatrixBuilder<ValueType>::ExternalSparseMatrixBuilder(bool hasCustomRowGrouping, uint64_t bufferSize, std::string const& directory) : hasCustomRowGrouping(hasCustomRowGrouping), bufferSize(std::max<uint64_t>(bufferSize, 1)), file(directory), entryCount(0), highestColumn(0) {
+            detail::checkExternalStorageSupported<ValueType>();
+            if (hasCustomRowGrouping) {
+                rowGroupIndices = std::vector<index_type>();
+            }
+            buffer.reserve(this->bufferSize);
+        }
+
+        template<typename ValueType>
+        void ExternalSparseMatrixBuilder<ValueType>::addNextValue(index_type row, index_type column, value_type const& value) {
+            STORM_LOG_THROW(rowIndications.empty() || row + 1 >= rowIndications.size(), storm::exceptions::InvalidStateException, "Illegal call to ExternalSparseMatrixBuilder::addNextValue: adding entry to invalid row " << row << ".");
+
+            // Open all rows up to the given one.
+            while (rowIndications.size() <= row) {
+                rowIndications.push_back(entryCount);
+            }
+
+            buffer.emplace_back(column, value);
+            ++entryCount;
+            highestColumn = std::max(highestColumn, column);
+
+            if (buffer.size() == bufferSize) {
+                flush();
+            }
+        }
+
+        template<typename ValueType>
+        void ExternalSparseMatrixBuilder<ValueType>::flush() {
+            file.append(buffer.data(), buffer.size() * sizeof(MatrixEntry<index_type, value_type>));
+            buffer.clear();
+        }
+
+        template<typename ValueType>
+        void ExternalSparseMatrixBuilder<ValueType>::newRowGroup(index_type startingRow) {
+            STORM_LOG_THROW(hasCustomRowGrouping, storm::exceptions::InvalidStateException, "Matrix was not created to have a custom row grouping.");
+            STORM_LOG_THROW(rowGroupIndices->empty() || startingRow >= rowGroupIndices->back(), storm::exceptions::InvalidStateException, "Illegal row group with negative size.");
+            rowGroupIndices->push_back(startingRow);
+
+            // Close all rows before the new group (which may be empty).
+            while (rowIndications.size() < startingRow) {
+                rowIndications.push_back(entryCount);
+            }
+        }
+
+        template<typename ValueType>
+        typename ExternalSparseMatrixBuilder<ValueType>::index_type ExternalSparseMatrixBuilder<ValueType>::getCurrentRowGroupCount() const {
+            if (hasCustomRowGrouping) {
+                return rowGroupIndices->size();
+            } else {
+                return rowIndications.size();
+            }
+        }
+
+        template<typename ValueType>
+        void ExternalSparseMatrixBuilder<ValueType>::replaceColumns(std::vector<index_type> const&, index_type) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Replacing columns is not supported when storing matrix entries externally.");
+        }
+
+        template<typename ValueType>
+        SparseMatrix<ValueType> ExternalSparseMatrixBuilder<ValueType>::build(index_type overriddenRowCount, index_type overriddenColumnCount, index_type overriddenRowGroupCount) {
+            // Read back all entries.
+            flush();
+            std::vector<MatrixEntry<index_type, value_type>> columnsAndValues(entryCount);
+            if (entryCount > 0) {
+                file.read(0, columnsAndValues.data(), entryCount * sizeof(MatrixEntry<index_type, value_type>));
+            }
+            file.clear();
+            buffer.clear();
+            buffer.shrink_to_fit();
+
+            index_type rowCount = rowIndications.size();
+            if (hasCustomRowGrouping && !rowGroupIndices->empty() && rowGroupIndices->back() >= rowCount) {
+                // The last row group is empty.
+                rowCount = rowGroupIndices->back() + 1;
+            }
+            rowCount = std::max(rowCount, overriddenRowCount);
+            rowIndications.resize(rowCount + 1, entryCount);
+
+            // Sort the entries of every row and sum up entries in the same column.
+            index_type nextPosition = 0;
+            for (index_type row = 0; row < rowCount; ++row) {
+                auto rowBegin = columnsAndValues.begin() + rowIndications[row];
+                auto rowEnd = columnsAndValues.begin() + rowIndications[row + 1];
+                auto compareColumns = [] (MatrixEntry<index_type, value_type> const& first, MatrixEntry<index_type, value_type> const& second) { return first.getColumn() < second.getColumn(); };
+                if (!std::is_sorted(rowBegin, rowEnd, compareColumns)) {
+                    std::sort(rowBegin, rowEnd, compareColumns);
+                }
+
+                rowIndications[row] = nextPosition;
+                for (auto entryIt = rowBegin; entryIt != rowEnd; ++entryIt) {
+                    if (nextPosition > rowIndications[row] && columnsAndValues[nextPosition - 1].getColumn() == entryIt->getColumn()) {
+                        columnsAndValues[nextPosition - 1].setValue(columnsAndValues[nextPosition - 1].getValue() + entryIt->getValue());
+                    } else {
+                        columnsAndValues[nextPosition] = *entryIt;
+                        ++nextPosition;
+                    }
+                }
+            }
+            rowIndications[rowCount] = nextPosition;
+            columnsAndValues.resize(nextPosition);
+
+            index_type columnCount = entryCount > 0 ? highestColumn + 1 : 0;
+            columnCount = std::max(columnCount, overriddenColumnCount);
+
+            if (hasCustomRowGrouping) {
+                index_type currentRowGroupCount = rowGroupIndices->size();
+                index_type rowGroupCount = std::max(currentRowGroupCount, overriddenRowGroupCount);
+                for (index_type i = currentRowGroupCount; i <= rowGroupCount; ++i) {
+                    rowGroupIndices->push_back(rowCount);
+                }
+            }
+
+            return SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+        }
+
+        template class ExternalSparseMatrixBuilder<double>;
+
+#ifdef STORM_HAVE_CARL
+        template class ExternalSparseMatrixBuilder<storm::RationalNumber>;
+        template class ExternalSparseMatrixBuilder<storm::RationalFunction>;
+#endif
+    }
+}
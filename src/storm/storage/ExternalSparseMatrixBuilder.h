@@ -0,0 +1,122 @@
+#ifndef STORM_STORAGE_EXTERNALSPARSEMATRIXBUILDER_H_
+#define STORM_STORAGE_EXTERNALSPARSEMATRIXBUILDER_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/io/TemporaryFile.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * A builder for sparse matrices that offers the same interface as SparseMatrixBuilder for the linear
+         * construction of a matrix, but streams the entries to a temporary file instead of keeping them in memory.
+         * Only the row (group) indications are kept in memory. Upon building, the entries are read back into a matrix
+         * of exactly the required size, so the memory of the entries is needed only once (and not for the builder and
+         * the matrix at the same time).
+         *
+         * Other than for SparseMatrixBuilder, the columns within a row may be added in any order. The entries of each
+         * row are sorted (and entries in the same column are summed up) when building the matrix.
+         *
+         * Currently, only matrices with double precision values are supported.
+         */
+        template<typename ValueType>
+        class ExternalSparseMatrixBuilder {
+        public:
+            typedef SparseMatrixIndexType index_type;
+            typedef ValueType value_type;
+
+            /*!
+             * Constructs an external sparse matrix builder.
+             *
+             * @param hasCustomRowGrouping A flag indicating whether the builder is used to create a non-canonical
+             * grouping of rows for this matrix.
+             * @param bufferSize The number of entries that are buffered in memory before they are written to the file.
+             * @param directory The directory in which the temporary file is created (if empty, the default directory
+             * for temporary files is used).
+             */
+            ExternalSparseMatrixBuilder(bool hasCustomRowGrouping = false, uint64_t bufferSize = 1ull << 16, std::string const& directory = "");
+
+            /*!
+             * Adds the given entry to the matrix. The rows have to be given in (weakly) increasing order. If rows are
+             * skipped entirely, the corresponding rows are treated as empty.
+             *
+             * @param row The row in which the matrix entry is to be set.
+             * @param column The column in which the matrix entry is to be set.
+             * @param value The value that is to be set at the specified row and column.
+             */
+            void addNextValue(index_type row, index_type column, value_type const& value);
+
+            /*!
+             * Starts a new row group in the matrix. Note that this needs to be called before any entries in the new row
+             * group are added.
+             *
+             * @param startingRow The starting row of the new row group.
+             */
+            void newRowGroup(index_type startingRow);
+
+            /*!
+             * Retrieves the current row group count.
+             *
+             * @return The current row group count.
+             */
+            index_type getCurrentRowGroupCount() const;
+
+            /*!
+             * Replacing columns is not supported by this builder, as the entries are not accessible anymore once they
+             * have been written. Calling this method throws an exception.
+             */
+            void replaceColumns(std::vector<index_type> const& replacements, index_type offset);
+
+            /*!
+             * Builds the matrix from the added entries. Afterwards, the builder must not be used anymore.
+             *
+             * @param overriddenRowCount If this is greater than the current number of rows, empty rows are added at the
+             * end of the matrix until the given row count has been matched.
+             * @param overriddenColumnCount If this is greater than the current number of columns, the number of columns
+             * is set to the given value.
+             * @param overriddenRowGroupCount If this is greater than the current number of row groups, empty row groups
+             * are added at the end until the given count has been matched.
+             */
+            SparseMatrix<value_type> build(index_type overriddenRowCount = 0, index_type overriddenColumnCount = 0, index_type overriddenRowGroupCount = 0);
+
+        private:
+            /*!
+             * Writes the buffered entries to the file.
+             */
+            void flush();
+
+            // A flag indicating whether the builder is to construct a custom row grouping for the matrix.
+            bool hasCustomRowGrouping;
+
+            // The number of entries that are buffered before they are written to the file.
+            uint64_t bufferSize;
+
+            // The file that holds all entries (except for the buffered ones).
+            storm::io::TemporaryFile file;
+
+            // The buffered entries.
+            std::vector<MatrixEntry<index_type, value_type>> buffer;
+
+            // The indices at which each given row begins (the last row is still open).
+            std::vector<index_type> rowIndications;
+
+            // The vector that stores the row-group indices (if they are non-trivial).
+            boost::optional<std::vector<index_type>> rowGroupIndices;
+
+            // The number of entries added so far.
+            index_type entryCount;
+
+            // The highest column at which an entry was inserted into the matrix.
+            index_type highestColumn;
+        };
+
+    }
+}
+
+#endif /* STORM_STORAGE_EXTERNALSPARSEMATRIXBUILDER_H_ */
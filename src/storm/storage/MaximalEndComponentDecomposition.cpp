@@ -63,6 +63,57 @@ namespace storm {
             return *this;
         }
         
+        /*!
+         * Computes the non-naive SCCs of the given MEC candidate. For this, the submatrix of the candidate is built
+         * explicitly, such that the costs only depend on the size of the candidate.
+         *
+         * @param transitionMatrix The transition matrix of the system.
+         * @param candidate The states of the candidate.
+         * @param candidateAsBitVector The states of the candidate as a bit vector.
+         * @param includedChoices The choices that are (still) considered.
+         * @param stateToLocalIndex A vector of size of the number of states that is used to store the indices of the
+         * candidate's states in the submatrix.
+         * @return The SCCs of the candidate (in terms of the original states).
+         */
+        template <typename ValueType>
+        std::vector<StronglyConnectedComponent> getLocalSccs(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, StateBlock const& candidate, storm::storage::BitVector const& candidateAsBitVector, storm::storage::BitVector const& includedChoices, std::vector<uint_fast64_t>& stateToLocalIndex) {
+            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
+            uint_fast64_t localIndex = 0;
+            for (auto state : candidate) {
+                stateToLocalIndex[state] = localIndex++;
+            }
+            
+            storm::storage::SparseMatrixBuilder<ValueType> builder(0, candidate.size(), 0, false, true, candidate.size());
+            uint_fast64_t localRow = 0;
+            for (auto state : candidate) {
+                builder.newRowGroup(localRow);
+                for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+                    if (!includedChoices.get(choice)) {
+                        continue;
+                    }
+                    // As the local indices preserve the order of the states, the columns of the local row are sorted.
+                    for (auto const& entry : transitionMatrix.getRow(choice)) {
+                        if (candidateAsBitVector.get(entry.getColumn()) && !storm::utility::isZero(entry.getValue())) {
+                            builder.addNextValue(localRow, stateToLocalIndex[entry.getColumn()], storm::utility::one<ValueType>());
+                        }
+                    }
+                    ++localRow;
+                }
+            }
+            storm::storage::SparseMatrix<ValueType> localMatrix = builder.build(localRow, candidate.size(), candidate.size());
+            
+            std::vector<StronglyConnectedComponent> result;
+            StronglyConnectedComponentDecomposition<ValueType> localSccs(localMatrix, StronglyConnectedComponentDecompositionOptions().dropNaiveSccs());
+            result.reserve(localSccs.size());
+            for (auto const& localScc : localSccs) {
+                result.emplace_back();
+                for (auto localState : localScc) {
+                    result.back().insert(*(candidate.begin() + localState));
+                }
+            }
+            return result;
+        }
+        
         template <typename ValueType>
         void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> backwardTransitions, storm::storage::BitVector const* states, storm::storage::BitVector const* choices) {
             // Get some data for convenient access.
@@ -79,7 +130,6 @@ namespace storm {
                 std::iota(allStates.begin(), allStates.end(), 0);
                 endComponentStateSets.emplace_back(allStates.begin(), allStates.end(), true);
             }
-            storm::storage::BitVector statesToCheck(numberOfStates);
             storm::storage::BitVector includedChoices;
             if (choices) {
                 includedChoices = *choices;
@@ -94,17 +144,32 @@ namespace storm {
                 includedChoices = storm::storage::BitVector(transitionMatrix.getRowCount(), true);
             }
             storm::storage::BitVector currMecAsBitVector(transitionMatrix.getRowGroupCount());
-                        
+            
+            // Local data that is reused for all candidates. To keep the costs of processing a candidate proportional to
+            // its size (rather than to the size of the whole system), we only ever reset the entries of the candidate.
+            std::vector<uint_fast64_t> stateToLocalIndex(numberOfStates);
+            std::vector<uint_fast64_t> statesToCheck;
+            std::vector<uint_fast64_t> statesToRemove;
+            storm::storage::BitVector isStateToCheck(numberOfStates);
+            
+            bool isFirstCandidate = true;
             for (std::list<StateBlock>::const_iterator mecIterator = endComponentStateSets.begin(); mecIterator != endComponentStateSets.end();) {
                 StateBlock const& mec = *mecIterator;
-                currMecAsBitVector.clear();
                 currMecAsBitVector.set(mec.begin(), mec.end(), true);
                 // Keep track of whether the MEC changed during this iteration.
                 bool mecChanged = false;
                 
-                // Get an SCC decomposition of the current MEC candidate.
-                
-                StronglyConnectedComponentDecomposition<ValueType> sccs(transitionMatrix, StronglyConnectedComponentDecompositionOptions().subsystem(&currMecAsBitVector).choices(&includedChoices).dropNaiveSccs());
+                // Get an SCC decomposition of the current MEC candidate. The first candidate is (typically) the largest
+                // one, so we decompose it on the original matrix (possibly in parallel). For all further candidates,
+                // the decomposition is done on the submatrix of the candidate.
+                std::vector<StronglyConnectedComponent> sccs;
+                if (isFirstCandidate) {
+                    StronglyConnectedComponentDecomposition<ValueType> decomposition(transitionMatrix, StronglyConnectedComponentDecompositionOptions().subsystem(&currMecAsBitVector).choices(&includedChoices).dropNaiveSccs());
+                    sccs.assign(std::make_move_iterator(decomposition.begin()), std::make_move_iterator(decomposition.end()));
+                    isFirstCandidate = false;
+                } else {
+                    sccs = getLocalSccs(transitionMatrix, mec, currMecAsBitVector, includedChoices, stateToLocalIndex);
+                }
                 
                 // We need to do another iteration in case we have either more than once SCC or the SCC is smaller than
                 // the MEC canditate itself.
@@ -112,12 +177,13 @@ namespace storm {
                 
                 // Check for each of the SCCs whether there is at least one action for each state that does not leave the SCC.
                 for (auto& scc : sccs) {
-                    statesToCheck.set(scc.begin(), scc.end());
+                    statesToCheck.assign(scc.begin(), scc.end());
                     
                     while (!statesToCheck.empty()) {
-                        storm::storage::BitVector statesToRemove(numberOfStates);
+                        statesToRemove.clear();
                         
                         for (auto state : statesToCheck) {
+                            isStateToCheck.set(state, false);
                             bool keepStateInMEC = false;
                             
                             for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
@@ -152,7 +218,7 @@ namespace storm {
                             }
                             
                             if (!keepStateInMEC) {
-                                statesToRemove.set(state, true);
+                                statesToRemove.push_back(state);
                             }
                         }
                         
@@ -166,14 +232,20 @@ namespace storm {
                         statesToCheck.clear();
                         for (auto state : statesToRemove) {
                             for (auto const& entry : backwardTransitions.getRow(state)) {
-                                if (scc.containsState(entry.getColumn())) {
-                                    statesToCheck.set(entry.getColumn());
+                                if (!isStateToCheck.get(entry.getColumn()) && scc.containsState(entry.getColumn())) {
+                                    isStateToCheck.set(entry.getColumn(), true);
+                                    statesToCheck.push_back(entry.getColumn());
                                 }
                             }
                         }
                     }
                 }
                 
+                // Only reset the states of the current candidate.
+                for (auto state : mec) {
+                    currMecAsBitVector.set(state, false);
+                }
+                
                 // If the MEC changed, we delete it from the list of MECs and append the possible new MEC candidates to
                 // the list instead.
                 if (mecChanged) {
@@ -0,0 +1,299 @@
+#include "storm/storage/SoaSparseMatrix.h"
+
+#include <limits>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace storage {
+
+        template<typename ValueType>
+        SoaSparseMatrix<ValueType>::SoaSparseMatrix(SparseMatrix<ValueType> const& matrix, bool allowNarrowColumnIndices) : columnCount(matrix.getColumnCount()) {
+            bool narrow = allowNarrowColumnIndices && columnCount <= static_cast<index_type>(std::numeric_limits<uint32_t>::max());
+            index_type entryCount = matrix.getEntryCount();
+            if (narrow) {
+                narrowColumns.reserve(entryCount);
+            } else {
+                wideColumns.reserve(entryCount);
+            }
+            values.reserve(entryCount);
+            rowIndications.reserve(matrix.getRowCount() + 1);
+
+            rowIndications.push_back(0);
+            for (index_type row = 0; row < matrix.getRowCount(); ++row) {
+                for (auto const& entry : matrix.getRow(row)) {
+                    if (narrow) {
+                        narrowColumns.push_back(static_cast<uint32_t>(entry.getColumn()));
+                    } else {
+                        wideColumns.push_back(entry.getColumn());
+                    }
+                    values.push_back(entry.getValue());
+                }
+                rowIndications.push_back(values.size());
+            }
+        }
+
+        template<typename ValueType>
+        typename SoaSparseMatrix<ValueType>::index_type SoaSparseMatrix<ValueType>::getRowCount() const {
+            return rowIndications.size() - 1;
+        }
+
+        template<typename ValueType>
+        typename SoaSparseMatrix<ValueType>::index_type SoaSparseMatrix<ValueType>::getColumnCount() const {
+            return columnCount;
+        }
+
+        template<typename ValueType>
+        typename SoaSparseMatrix<ValueType>::index_type SoaSparseMatrix<ValueType>::getEntryCount() const {
+            return values.size();
+        }
+
+        template<typename ValueType>
+        bool SoaSparseMatrix<ValueType>::hasNarrowColumnIndices() const {
+            return wideColumns.empty() && narrowColumns.size() == values.size();
+        }
+
+        template<typename ValueType>
+        uint64_t SoaSparseMatrix<ValueType>::getSizeInMemory() const {
+            return narrowColumns.size() * sizeof(uint32_t) + wideColumns.size() * sizeof(uint64_t) + values.size() * sizeof(value_type) + rowIndications.size() * sizeof(uint64_t);
+        }
+
+        template<typename ValueType>
+        std::vector<uint64_t> const& SoaSparseMatrix<ValueType>::getRowIndications() const {
+            return rowIndications;
+        }
+
+        template<typename ValueType>
+        std::vector<uint32_t> const& SoaSparseMatrix<ValueType>::getNarrowColumns() const {
+            return narrowColumns;
+        }
+
+        template<typename ValueType>
+        std::vector<uint64_t> const& SoaSparseMatrix<ValueType>::getWideColumns() const {
+            return wideColumns;
+        }
+
+        template<typename ValueType>
+        std::vector<ValueType> const& SoaSparseMatrix<ValueType>::getValues() const {
+            return values;
+        }
+
+        template<typename ValueType>
+        void SoaSparseMatrix<ValueType>::multiplyWithVector(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const {
+            STORM_LOG_ASSERT(&vector != &result, "Vectors are aliased but are not allowed to be.");
+            multiplyWithVectorForward(vector, result, summand);
+        }
+
+        template<typename ValueType>
+        void SoaSparseMatrix<ValueType>::multiplyWithVectorForward(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const {
+            if (hasNarrowColumnIndices()) {
+                multiplyWithVectorForward(narrowColumns, vector, result, summand);
+            } else {
+                multiplyWithVectorForward(wideColumns, vector, result, summand);
+            }
+        }
+
+        template<typename ValueType>
+        void SoaSparseMatrix<ValueType>::multiplyWithVectorBackward(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const {
+            if (hasNarrowColumnIndices()) {
+                multiplyWithVectorBackward(narrowColumns, vector, result, summand);
+            } else {
+                multiplyWithVectorBackward(wideColumns, vector, result, summand);
+            }
+        }
+
+        template<typename ValueType>
+        template<typename ColumnType>
+        typename SoaSparseMatrix<ValueType>::value_type SoaSparseMatrix<ValueType>::multiplyRow(std::vector<ColumnType> const& columns, index_type row, std::vector<value_type> const& vector, value_type const* summand) const {
+            value_type result = summand ? *summand : storm::utility::zero<value_type>();
+            ColumnType const* columnIt = columns.data() + rowIndications[row];
+            value_type const* valueIt = values.data() + rowIndications[row];
+            value_type const* valueIte = values.data() + rowIndications[row + 1];
+            for (; valueIt != valueIte; ++valueIt, ++columnIt) {
+                result += *valueIt * vector[*columnIt];
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        template<typename ColumnType>
+        void SoaSparseMatrix<ValueType>::multiplyWithVectorForward(std::vector<ColumnType> const& columns, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const {
+            index_type const rowCount = getRowCount();
+            for (index_type row = 0; row < rowCount; ++row) {
+                result[row] = multiplyRow(columns, row, vector, summand ? &(*summand)[row] : nullptr);
+            }
+        }
+
+        template<typename ValueType>
+        template<typename ColumnType>
+        void SoaSparseMatrix<ValueType>::multiplyWithVectorBackward(std::vector<ColumnType> const& columns, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const {
+            for (index_type row = getRowCount(); row > 0;) {
+                --row;
+                result[row] = multiplyRow(columns, row, vector, summand ? &(*summand)[row] : nullptr);
+            }
+        }
+
+        template<typename ValueType>
+        void SoaSparseMatrix<ValueType>::multiplyAndReduceForward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (dir == storm::OptimizationDirection::Minimize) {
+                if (hasNarrowColumnIndices()) {
+                    multiplyAndReduceForward<storm::utility::ElementLess<ValueType>>(narrowColumns, rowGroupIndices, vector, summand, result, choices);
+                } else {
+                    multiplyAndReduceForward<storm::utility::ElementLess<ValueType>>(wideColumns, rowGroupIndices, vector, summand, result, choices);
+                }
+            } else {
+                if (hasNarrowColumnIndices()) {
+                    multiplyAndReduceForward<storm::utility::ElementGreater<ValueType>>(narrowColumns, rowGroupIndices, vector, summand, result, choices);
+                } else {
+                    multiplyAndReduceForward<storm::utility::ElementGreater<ValueType>>(wideColumns, rowGroupIndices, vector, summand, result, choices);
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void SoaSparseMatrix<ValueType>::multiplyAndReduceBackward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (dir == storm::OptimizationDirection::Minimize) {
+                if (hasNarrowColumnIndices()) {
+                    multiplyAndReduceBackward<storm::utility::ElementLess<ValueType>>(narrowColumns, rowGroupIndices, vector, summand, result, choices);
+                } else {
+                    multiplyAndReduceBackward<storm::utility::ElementLess<ValueType>>(wideColumns, rowGroupIndices, vector, summand, result, choices);
+                }
+            } else {
+                if (hasNarrowColumnIndices()) {
+                    multiplyAndReduceBackward<storm::utility::ElementGreater<ValueType>>(narrowColumns, rowGroupIndices, vector, summand, result, choices);
+                } else {
+                    multiplyAndReduceBackward<storm::utility::ElementGreater<ValueType>>(wideColumns, rowGroupIndices, vector, summand, result, choices);
+                }
+            }
+        }
+
+#ifdef STORM_HAVE_CARL
+        template<>
+        void SoaSparseMatrix<storm::RationalFunction>::multiplyAndReduceForward(storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&, std::vector<uint_fast64_t>*) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+
+        template<>
+        void SoaSparseMatrix<storm::RationalFunction>::multiplyAndReduceBackward(storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&, std::vector<uint_fast64_t>*) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+
+        template<typename ValueType>
+        template<typename Compare, typename ColumnType>
+        void SoaSparseMatrix<ValueType>::multiplyAndReduceForward(std::vector<ColumnType> const& columns, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            Compare compare;
+            uint64_t const groupCount = rowGroupIndices.size() - 1;
+            for (uint64_t group = 0; group < groupCount; ++group) {
+                uint64_t const groupStart = rowGroupIndices[group];
+                uint64_t const groupEnd = rowGroupIndices[group + 1];
+
+                // Only multiply and reduce if there is at least one row in the group.
+                if (groupStart == groupEnd) {
+                    continue;
+                }
+
+                ValueType currentValue = multiplyRow(columns, groupStart, vector, summand ? &(*summand)[groupStart] : nullptr);
+
+                // Variables for correctly tracking choices (only update if new choice is strictly better).
+                uint64_t selectedChoice = 0;
+                ValueType oldSelectedChoiceValue = currentValue;
+
+                for (uint64_t row = groupStart + 1; row < groupEnd; ++row) {
+                    ValueType newValue = multiplyRow(columns, row, vector, summand ? &(*summand)[row] : nullptr);
+                    if (choices && row - groupStart == (*choices)[group]) {
+                        oldSelectedChoiceValue = newValue;
+                    }
+                    if (compare(newValue, currentValue)) {
+                        currentValue = newValue;
+                        selectedChoice = row - groupStart;
+                    }
+                }
+
+                // Finally write value to target vector.
+                result[group] = currentValue;
+                if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+                    (*choices)[group] = selectedChoice;
+                }
+            }
+        }
+
+        template<typename ValueType>
+        template<typename Compare, typename ColumnType>
+        void SoaSparseMatrix<ValueType>::multiplyAndReduceBackward(std::vector<ColumnType> const& columns, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            Compare compare;
+            for (uint64_t group = rowGroupIndices.size() - 1; group > 0;) {
+                --group;
+                uint64_t const groupStart = rowGroupIndices[group];
+                uint64_t const groupEnd = rowGroupIndices[group + 1];
+
+                // Only multiply and reduce if there is at least one row in the group.
+                if (groupStart == groupEnd) {
+                    continue;
+                }
+
+                ValueType currentValue = multiplyRow(columns, groupEnd - 1, vector, summand ? &(*summand)[groupEnd - 1] : nullptr);
+
+                // Variables for correctly tracking choices (only update if new choice is strictly better).
+                uint64_t selectedChoice = groupEnd - 1 - groupStart;
+                ValueType oldSelectedChoiceValue = currentValue;
+
+                for (uint64_t row = groupEnd - 1; row > groupStart;) {
+                    --row;
+                    ValueType newValue = multiplyRow(columns, row, vector, summand ? &(*summand)[row] : nullptr);
+                    if (choices && row - groupStart == (*choices)[group]) {
+                        oldSelectedChoiceValue = newValue;
+                    }
+                    if (compare(newValue, currentValue)) {
+                        currentValue = newValue;
+                        selectedChoice = row - groupStart;
+                    }
+                }
+
+                // Finally write value to target vector.
+                result[group] = currentValue;
+                if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+                    (*choices)[group] = selectedChoice;
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void SoaSparseMatrix<ValueType>::multiplyRow(index_type row, std::vector<value_type> const& vector, value_type& value) const {
+            if (hasNarrowColumnIndices()) {
+                value += multiplyRow(narrowColumns, row, vector, nullptr);
+            } else {
+                value += multiplyRow(wideColumns, row, vector, nullptr);
+            }
+        }
+
+        template<typename ValueType>
+        void SoaSparseMatrix<ValueType>::multiplyRow2(index_type row, std::vector<value_type> const& vector1, value_type& value1, std::vector<value_type> const& vector2, value_type& value2) const {
+            uint64_t const rowEnd = rowIndications[row + 1];
+            if (hasNarrowColumnIndices()) {
+                for (uint64_t entry = rowIndications[row]; entry < rowEnd; ++entry) {
+                    value1 += values[entry] * vector1[narrowColumns[entry]];
+                    value2 += values[entry] * vector2[narrowColumns[entry]];
+                }
+            } else {
+                for (uint64_t entry = rowIndications[row]; entry < rowEnd; ++entry) {
+                    value1 += values[entry] * vector1[wideColumns[entry]];
+                    value2 += values[entry] * vector2[wideColumns[entry]];
+                }
+            }
+        }
+
+        template class SoaSparseMatrix<double>;
+#ifdef STORM_HAVE_CARL
+        template class SoaSparseMatrix<storm::RationalNumber>;
+        template class SoaSparseMatrix<storm::RationalFunction>;
+#endif
+    }
+}
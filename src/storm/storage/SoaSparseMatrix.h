@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+    namespace storage {
+
+        template<typename ValueType>
+        class SparseMatrix;
+
+        /*!
+         * A read-only representation of a sparse matrix that stores the column indices and the values of the entries in
+         * two separate arrays (structure of arrays) instead of one array of column-value pairs. If the number of columns
+         * permits it, the column indices are stored with 32 bits. This reduces the number of bytes that need to be
+         * streamed per entry in matrix-vector multiplications.
+         */
+        template<typename ValueType>
+        class SoaSparseMatrix {
+        public:
+            typedef uint_fast64_t index_type;
+            typedef ValueType value_type;
+
+            /*!
+             * Creates the structure-of-arrays representation of the given matrix.
+             *
+             * @param matrix The matrix whose entries are copied.
+             * @param allowNarrowColumnIndices If set, the column indices are stored with 32 bits whenever the column count
+             * of the matrix allows this.
+             */
+            SoaSparseMatrix(SparseMatrix<ValueType> const& matrix, bool allowNarrowColumnIndices = true);
+
+            index_type getRowCount() const;
+            index_type getColumnCount() const;
+            index_type getEntryCount() const;
+
+            /*!
+             * Retrieves whether the column indices are stored with 32 bits.
+             */
+            bool hasNarrowColumnIndices() const;
+
+            /*!
+             * Retrieves the (approximate) number of bytes occupied by the entries and the row indications.
+             */
+            uint64_t getSizeInMemory() const;
+            
+            /*!
+             * Retrieves the underlying arrays. This is intended for specialized multiplication kernels. Only one of the
+             * column arrays is non-empty (unless the matrix has no entries).
+             */
+            std::vector<uint64_t> const& getRowIndications() const;
+            std::vector<uint32_t> const& getNarrowColumns() const;
+            std::vector<uint64_t> const& getWideColumns() const;
+            std::vector<value_type> const& getValues() const;
+
+            /*!
+             * Multiplies the matrix with the given vector and writes the result to the given result vector.
+             * The vector and the result must not be the same.
+             *
+             * @param vector The vector with which to multiply the matrix.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             */
+            void multiplyWithVector(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+
+            /*!
+             * Multiplies the matrix with the given vector processing the rows in ascending (descending) order. The vector
+             * and the result may be the same, in which case the multiplication is performed in Gauss-Seidel style.
+             */
+            void multiplyWithVectorForward(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+            void multiplyWithVectorBackward(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+
+            /*!
+             * Multiplies the matrix with the given vector, adds the summand and reduces the result over the given row
+             * groups. This mirrors the corresponding operations of the sparse matrix, including the choice tracking
+             * (choices are only updated if the new choice is strictly better). The vector and the result may be the
+             * same, in which case the multiplication is performed in Gauss-Seidel style.
+             */
+            void multiplyAndReduceForward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+            void multiplyAndReduceBackward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+
+            /*!
+             * Multiplies the given row with the given vector and adds the result to the given value.
+             */
+            void multiplyRow(index_type row, std::vector<value_type> const& vector, value_type& value) const;
+
+            /*!
+             * Multiplies the given row with both given vectors and adds the results to the given values.
+             */
+            void multiplyRow2(index_type row, std::vector<value_type> const& vector1, value_type& value1, std::vector<value_type> const& vector2, value_type& value2) const;
+
+        private:
+            template<typename ColumnType>
+            void multiplyWithVectorForward(std::vector<ColumnType> const& columns, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const;
+            template<typename ColumnType>
+            void multiplyWithVectorBackward(std::vector<ColumnType> const& columns, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const;
+
+            template<typename Compare, typename ColumnType>
+            void multiplyAndReduceForward(std::vector<ColumnType> const& columns, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+            template<typename Compare, typename ColumnType>
+            void multiplyAndReduceBackward(std::vector<ColumnType> const& columns, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+
+            template<typename ColumnType>
+            value_type multiplyRow(std::vector<ColumnType> const& columns, index_type row, std::vector<value_type> const& vector, value_type const* summand) const;
+
+            // The number of columns of the matrix.
+            index_type columnCount;
+
+            // The column indices of the entries if they are stored with 32 bits. Empty otherwise.
+            std::vector<uint32_t> narrowColumns;
+
+            // The column indices of the entries if they are stored with 64 bits. Empty otherwise.
+            std::vector<uint64_t> wideColumns;
+
+            // The values of the entries.
+            std::vector<value_type> values;
+
+            // A vector indicating the starting position of each row (plus one past-the-end position).
+            std::vector<uint64_t> rowIndications;
+        };
+
+    }
+}
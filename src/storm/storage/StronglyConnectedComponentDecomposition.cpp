@@ -1,3 +1,8 @@
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <type_traits>
+
 #include <storm/utility/vector.h>
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "storm/models/sparse/Model.h"
@@ -5,6 +10,9 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/parallel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/exceptions/UnexpectedException.h"
 
@@ -152,6 +160,467 @@ namespace storm {
             }
         }
 
+        namespace detail {
+            // If the parallelism is not requested explicitly, systems with fewer states are decomposed sequentially.
+            uint64_t const minimalNumberOfStatesForParallelDecomposition = 1ull << 16;
+
+            // Once at most this number of states is left, the parallel algorithm finishes the decomposition sequentially.
+            uint64_t const sequentialRemainderSize = 1ull << 12;
+
+            // The minimal number of (states or SCCs) that are processed by one task.
+            uint64_t const parallelGrainSize = 1024;
+
+            typedef std::vector<std::atomic<uint64_t>> AtomicVector;
+
+            /*!
+             * Applies the given function to all given items in parallel. The function gets an item and a vector to
+             * which it may append states. Returns the concatenation of these vectors.
+             */
+            template<typename Function>
+            std::vector<uint64_t> parallelCollect(std::vector<uint64_t> const& items, Function const& function) {
+                return storm::utility::parallel::parallelReduce(0, items.size(), parallelGrainSize, std::vector<uint64_t>(), [&items, &function] (auto const& range, std::vector<uint64_t> result) {
+                    for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                        function(items[index], result);
+                    }
+                    return result;
+                }, [] (std::vector<uint64_t> first, std::vector<uint64_t> const& second) {
+                    first.insert(first.end(), second.begin(), second.end());
+                    return first;
+                });
+            }
+
+            /*!
+             * Sets the given value if it is larger than the current one. Returns true iff the value was changed.
+             */
+            inline bool atomicMax(std::atomic<uint64_t>& target, uint64_t value) {
+                uint64_t current = target.load(std::memory_order_relaxed);
+                while (current < value) {
+                    if (target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            /*!
+             * Sets the given value if the current one is the expected one. Returns true iff the value was changed.
+             */
+            inline bool atomicReplace(std::atomic<uint64_t>& target, uint64_t expected, uint64_t value) {
+                return target.compare_exchange_strong(expected, value, std::memory_order_relaxed);
+            }
+
+            /*!
+             * Computes the SCC decomposition in parallel with a variant of the Multistep algorithm (Slota et al., 2014):
+             * First, states without (remaining) predecessors or successors are trimmed as they form singleton SCCs.
+             * Then, the SCC of a state with many predecessors and successors (which is likely to be large) is computed
+             * by a forward and a backward search. The remaining states are decomposed by a coloring, in which the
+             * largest state index reaching a state is propagated forward. A state whose color is its own index then is
+             * the root of an SCC that consists of the states of this color that can reach the root. Trimming is applied
+             * after each step, and once only few states remain, these are decomposed sequentially.
+             *
+             * As a result, every state of the subsystem is mapped to an SCC index. The SCC indices are a topological
+             * sort (i.e., SCCs that are reachable from an SCC have a smaller index) and the depths of the SCCs are
+             * computed.
+             */
+            template <typename ValueType>
+            void performParallelSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const* subsystem, storm::storage::BitVector const* choices, storm::storage::BitVector& nonTrivialStates, std::vector<uint_fast64_t>& stateToSccMapping, uint_fast64_t& sccCount, std::vector<uint_fast64_t>& sccDepths) {
+                using storm::utility::parallel::parallelFor;
+                using storm::utility::parallel::parallelReduce;
+
+                uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+                uint64_t const unassigned = numberOfStates;
+                auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+
+                auto forEachSuccessor = [&] (uint64_t state, auto const& function) {
+                    for (uint64_t row = rowGroupIndices[state], rowEnd = rowGroupIndices[state + 1]; row != rowEnd; ++row) {
+                        if (choices && !choices->get(row)) {
+                            continue;
+                        }
+                        for (auto const& successor : transitionMatrix.getRow(row)) {
+                            if ((!subsystem || subsystem->get(successor.getColumn())) && successor.getValue() != storm::utility::zero<ValueType>()) {
+                                function(successor.getColumn());
+                            }
+                        }
+                    }
+                };
+
+                std::vector<uint64_t> states;
+                if (subsystem) {
+                    states.assign(subsystem->begin(), subsystem->end());
+                } else {
+                    states.resize(numberOfStates);
+                    std::iota(states.begin(), states.end(), 0);
+                }
+
+                // Build the forward and the backward graph of the subsystem (without selfloops).
+                std::vector<uint8_t> hasSelfloop(numberOfStates, 0);
+                std::vector<uint64_t> forwardStarts(numberOfStates + 1, 0);
+                parallelFor(0, states.size(), parallelGrainSize, [&] (auto const& range) {
+                    for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                        uint64_t state = states[index];
+                        uint64_t count = 0;
+                        forEachSuccessor(state, [&] (uint64_t successor) {
+                            if (successor == state) {
+                                hasSelfloop[state] = 1;
+                            } else {
+                                ++count;
+                            }
+                        });
+                        forwardStarts[state + 1] = count;
+                    }
+                });
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    forwardStarts[state + 1] += forwardStarts[state];
+                }
+                std::vector<uint64_t> forwardTargets(forwardStarts.back());
+                AtomicVector counters(numberOfStates);
+                parallelFor(0, states.size(), parallelGrainSize, [&] (auto const& range) {
+                    for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                        uint64_t state = states[index];
+                        uint64_t position = forwardStarts[state];
+                        forEachSuccessor(state, [&] (uint64_t successor) {
+                            if (successor != state) {
+                                forwardTargets[position++] = successor;
+                                counters[successor].fetch_add(1, std::memory_order_relaxed);
+                            }
+                        });
+                    }
+                });
+                std::vector<uint64_t> backwardStarts(numberOfStates + 1, 0);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    backwardStarts[state + 1] = backwardStarts[state] + counters[state].load(std::memory_order_relaxed);
+                    counters[state].store(backwardStarts[state], std::memory_order_relaxed);
+                }
+                std::vector<uint64_t> backwardSources(backwardStarts.back());
+                parallelFor(0, states.size(), parallelGrainSize, [&] (auto const& range) {
+                    for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                        uint64_t state = states[index];
+                        for (uint64_t position = forwardStarts[state]; position < forwardStarts[state + 1]; ++position) {
+                            backwardSources[counters[forwardTargets[position]].fetch_add(1, std::memory_order_relaxed)] = state;
+                        }
+                    }
+                });
+
+                // Each state is labeled with a representative of its SCC as soon as the SCC is found. Moreover, we keep
+                // track of the number of predecessors and successors that are not yet assigned to an SCC.
+                AtomicVector labels(numberOfStates);
+                AtomicVector remainingPredecessors(numberOfStates);
+                AtomicVector remainingSuccessors(numberOfStates);
+                parallelFor(0, numberOfStates, parallelGrainSize, [&] (auto const& range) {
+                    for (uint64_t state = range.begin(); state < range.end(); ++state) {
+                        labels[state].store(unassigned, std::memory_order_relaxed);
+                        remainingPredecessors[state].store(backwardStarts[state + 1] - backwardStarts[state], std::memory_order_relaxed);
+                        remainingSuccessors[state].store(forwardStarts[state + 1] - forwardStarts[state], std::memory_order_relaxed);
+                    }
+                });
+                auto isUnassigned = [&] (uint64_t state) {
+                    return labels[state].load(std::memory_order_relaxed) == unassigned;
+                };
+
+                // Updates the counters of the neighbors of the given state and appends all unassigned neighbors that
+                // become trimmable.
+                auto releaseNeighbors = [&] (uint64_t state, std::vector<uint64_t>& trimmable) {
+                    for (uint64_t position = forwardStarts[state]; position < forwardStarts[state + 1]; ++position) {
+                        uint64_t successor = forwardTargets[position];
+                        if (isUnassigned(successor) && remainingPredecessors[successor].fetch_sub(1, std::memory_order_relaxed) == 1) {
+                            trimmable.push_back(successor);
+                        }
+                    }
+                    for (uint64_t position = backwardStarts[state]; position < backwardStarts[state + 1]; ++position) {
+                        uint64_t predecessor = backwardSources[position];
+                        if (isUnassigned(predecessor) && remainingSuccessors[predecessor].fetch_sub(1, std::memory_order_relaxed) == 1) {
+                            trimmable.push_back(predecessor);
+                        }
+                    }
+                };
+
+                // Turns the trimmable states into singleton SCCs. This may make further states trimmable.
+                auto trim = [&] (std::vector<uint64_t> trimmable) {
+                    while (!trimmable.empty()) {
+                        trimmable = parallelCollect(trimmable, [&] (uint64_t state, std::vector<uint64_t>& result) {
+                            if (atomicReplace(labels[state], unassigned, state)) {
+                                releaseNeighbors(state, result);
+                            }
+                        });
+                    }
+                };
+
+                // Trims the states whose neighbors were assigned to the given (new) SCCs.
+                auto removeSccs = [&] (std::vector<uint64_t> const& sccStates) {
+                    trim(parallelCollect(sccStates, releaseNeighbors));
+                };
+
+                auto collectUnassigned = [&] (std::vector<uint64_t> const& candidates) {
+                    return parallelCollect(candidates, [&] (uint64_t state, std::vector<uint64_t>& result) {
+                        if (isUnassigned(state)) {
+                            result.push_back(state);
+                        }
+                    });
+                };
+
+                // Step 1: trimming.
+                trim(parallelCollect(states, [&] (uint64_t state, std::vector<uint64_t>& result) {
+                    if (remainingPredecessors[state].load(std::memory_order_relaxed) == 0 || remainingSuccessors[state].load(std::memory_order_relaxed) == 0) {
+                        result.push_back(state);
+                    }
+                }));
+                std::vector<uint64_t> remainingStates = collectUnassigned(states);
+
+                // Step 2: forward-backward search from a pivot that is likely to be in a large SCC.
+                if (!remainingStates.empty()) {
+                    typedef std::pair<uint64_t, uint64_t> ScoreAndState;
+                    uint64_t pivot = parallelReduce(0, remainingStates.size(), parallelGrainSize, ScoreAndState(0, remainingStates.front()), [&] (auto const& range, ScoreAndState best) {
+                        for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                            uint64_t state = remainingStates[index];
+                            uint64_t score = remainingPredecessors[state].load(std::memory_order_relaxed) * remainingSuccessors[state].load(std::memory_order_relaxed);
+                            if (score > best.first) {
+                                best = ScoreAndState(score, state);
+                            }
+                        }
+                        return best;
+                    }, [] (ScoreAndState const& first, ScoreAndState const& second) {
+                        return second.first > first.first ? second : first;
+                    }).second;
+
+                    // The forward search marks the reached states with the pivot.
+                    AtomicVector& forwardMarks = counters;
+                    parallelFor(0, remainingStates.size(), parallelGrainSize, [&] (auto const& range) {
+                        for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                            forwardMarks[remainingStates[index]].store(unassigned, std::memory_order_relaxed);
+                        }
+                    });
+                    forwardMarks[pivot].store(pivot, std::memory_order_relaxed);
+                    std::vector<uint64_t> frontier = {pivot};
+                    while (!frontier.empty()) {
+                        frontier = parallelCollect(frontier, [&] (uint64_t state, std::vector<uint64_t>& result) {
+                            for (uint64_t position = forwardStarts[state]; position < forwardStarts[state + 1]; ++position) {
+                                uint64_t successor = forwardTargets[position];
+                                if (isUnassigned(successor) && atomicReplace(forwardMarks[successor], unassigned, pivot)) {
+                                    result.push_back(successor);
+                                }
+                            }
+                        });
+                    }
+
+                    // The backward search within the forward reachable states yields the SCC of the pivot.
+                    labels[pivot].store(pivot, std::memory_order_relaxed);
+                    std::vector<uint64_t> sccStates = {pivot};
+                    frontier = sccStates;
+                    while (!frontier.empty()) {
+                        frontier = parallelCollect(frontier, [&] (uint64_t state, std::vector<uint64_t>& result) {
+                            for (uint64_t position = backwardStarts[state]; position < backwardStarts[state + 1]; ++position) {
+                                uint64_t predecessor = backwardSources[position];
+                                if (forwardMarks[predecessor].load(std::memory_order_relaxed) == pivot && atomicReplace(labels[predecessor], unassigned, pivot)) {
+                                    result.push_back(predecessor);
+                                }
+                            }
+                        });
+                        sccStates.insert(sccStates.end(), frontier.begin(), frontier.end());
+                    }
+                    removeSccs(sccStates);
+                    remainingStates = collectUnassigned(remainingStates);
+                }
+
+                // Step 3: coloring.
+                AtomicVector& colors = counters;
+                while (remainingStates.size() > sequentialRemainderSize) {
+                    parallelFor(0, remainingStates.size(), parallelGrainSize, [&] (auto const& range) {
+                        for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                            colors[remainingStates[index]].store(remainingStates[index], std::memory_order_relaxed);
+                        }
+                    });
+                    // Propagate the colors until a fixpoint is reached. A state may be contained in the set of changed
+                    // states several times, which only causes some redundant work.
+                    std::vector<uint64_t> changedStates = remainingStates;
+                    while (!changedStates.empty()) {
+                        changedStates = parallelCollect(changedStates, [&] (uint64_t state, std::vector<uint64_t>& result) {
+                            uint64_t color = colors[state].load(std::memory_order_relaxed);
+                            for (uint64_t position = forwardStarts[state]; position < forwardStarts[state + 1]; ++position) {
+                                uint64_t successor = forwardTargets[position];
+                                if (isUnassigned(successor) && atomicMax(colors[successor], color)) {
+                                    result.push_back(successor);
+                                }
+                            }
+                        });
+                    }
+
+                    // Search backwards from the roots within their color.
+                    std::vector<uint64_t> frontier = parallelCollect(remainingStates, [&] (uint64_t state, std::vector<uint64_t>& result) {
+                        if (colors[state].load(std::memory_order_relaxed) == state) {
+                            labels[state].store(state, std::memory_order_relaxed);
+                            result.push_back(state);
+                        }
+                    });
+                    std::vector<uint64_t> sccStates = frontier;
+                    while (!frontier.empty()) {
+                        frontier = parallelCollect(frontier, [&] (uint64_t state, std::vector<uint64_t>& result) {
+                            uint64_t color = colors[state].load(std::memory_order_relaxed);
+                            for (uint64_t position = backwardStarts[state]; position < backwardStarts[state + 1]; ++position) {
+                                uint64_t predecessor = backwardSources[position];
+                                if (colors[predecessor].load(std::memory_order_relaxed) == color && atomicReplace(labels[predecessor], unassigned, color)) {
+                                    result.push_back(predecessor);
+                                }
+                            }
+                        });
+                        sccStates.insert(sccStates.end(), frontier.begin(), frontier.end());
+                    }
+                    removeSccs(sccStates);
+
+                    uint64_t previousNumberOfRemainingStates = remainingStates.size();
+                    remainingStates = collectUnassigned(remainingStates);
+                    // The coloring may need many rounds if it only finds small SCCs. In this case, we rather continue
+                    // sequentially.
+                    if (remainingStates.size() > previousNumberOfRemainingStates - previousNumberOfRemainingStates / 64) {
+                        break;
+                    }
+                }
+
+                // Step 4: decompose the remaining states sequentially with the path-based algorithm.
+                if (!remainingStates.empty()) {
+                    std::sort(remainingStates.begin(), remainingStates.end());
+                    AtomicVector& localIndices = counters;
+                    for (uint64_t localIndex = 0; localIndex < remainingStates.size(); ++localIndex) {
+                        localIndices[remainingStates[localIndex]].store(localIndex, std::memory_order_relaxed);
+                    }
+                    uint64_t const noIndex = remainingStates.size();
+                    std::vector<uint64_t> preorderNumbers(remainingStates.size(), noIndex);
+                    std::vector<uint64_t> sccRoots(remainingStates.size(), unassigned);
+                    std::vector<uint64_t> s, p;
+                    std::vector<std::pair<uint64_t, uint64_t>> recursionStack;
+                    uint64_t currentIndex = 0;
+                    auto visit = [&] (uint64_t localState) {
+                        preorderNumbers[localState] = currentIndex++;
+                        s.push_back(localState);
+                        p.push_back(localState);
+                        recursionStack.emplace_back(localState, forwardStarts[remainingStates[localState]]);
+                    };
+                    for (uint64_t root = 0; root < remainingStates.size(); ++root) {
+                        if (preorderNumbers[root] != noIndex) {
+                            continue;
+                        }
+                        visit(root);
+                        while (!recursionStack.empty()) {
+                            uint64_t localState = recursionStack.back().first;
+                            uint64_t& position = recursionStack.back().second;
+                            if (position < forwardStarts[remainingStates[localState] + 1]) {
+                                uint64_t successor = forwardTargets[position++];
+                                if (!isUnassigned(successor)) {
+                                    continue;
+                                }
+                                uint64_t localSuccessor = localIndices[successor].load(std::memory_order_relaxed);
+                                if (preorderNumbers[localSuccessor] == noIndex) {
+                                    visit(localSuccessor);
+                                } else if (sccRoots[localSuccessor] == unassigned) {
+                                    while (preorderNumbers[p.back()] > preorderNumbers[localSuccessor]) {
+                                        p.pop_back();
+                                    }
+                                }
+                            } else {
+                                if (localState == p.back()) {
+                                    p.pop_back();
+                                    uint64_t poppedState;
+                                    do {
+                                        poppedState = s.back();
+                                        s.pop_back();
+                                        sccRoots[poppedState] = remainingStates[localState];
+                                    } while (poppedState != localState);
+                                }
+                                recursionStack.pop_back();
+                            }
+                        }
+                    }
+                    // Only label the states once the search is done, as the labels indicate which states are searched.
+                    for (uint64_t localState = 0; localState < remainingStates.size(); ++localState) {
+                        labels[remainingStates[localState]].store(sccRoots[localState], std::memory_order_relaxed);
+                    }
+                }
+
+                // Now every state is labeled with a representative of its SCC. We number the SCCs in a topological
+                // order by repeatedly taking all SCCs whose successor SCCs have all been taken, which also yields the
+                // depths of the SCCs.
+                std::vector<uint64_t> representatives;
+                for (auto const& state : states) {
+                    if (labels[state].load(std::memory_order_relaxed) == state) {
+                        representatives.push_back(state);
+                    }
+                }
+                sccCount = representatives.size();
+                AtomicVector& sccIndices = counters;
+                for (uint64_t index = 0; index < sccCount; ++index) {
+                    sccIndices[representatives[index]].store(index, std::memory_order_relaxed);
+                }
+                auto getScc = [&] (uint64_t state) {
+                    return sccIndices[labels[state].load(std::memory_order_relaxed)].load(std::memory_order_relaxed);
+                };
+                std::vector<uint64_t> memberStarts(sccCount + 1, 0);
+                for (auto const& state : states) {
+                    ++memberStarts[getScc(state) + 1];
+                }
+                for (uint64_t index = 0; index < sccCount; ++index) {
+                    memberStarts[index + 1] += memberStarts[index];
+                }
+                std::vector<uint64_t> members(states.size());
+                {
+                    std::vector<uint64_t> nextPositions(memberStarts.begin(), memberStarts.end() - 1);
+                    for (auto const& state : states) {
+                        members[nextPositions[getScc(state)]++] = state;
+                    }
+                }
+                AtomicVector remainingSuccessorEdges(sccCount);
+                parallelFor(0, sccCount, parallelGrainSize, [&] (auto const& range) {
+                    for (uint64_t scc = range.begin(); scc < range.end(); ++scc) {
+                        uint64_t count = 0;
+                        for (uint64_t member = memberStarts[scc]; member < memberStarts[scc + 1]; ++member) {
+                            uint64_t state = members[member];
+                            for (uint64_t position = forwardStarts[state]; position < forwardStarts[state + 1]; ++position) {
+                                count += getScc(forwardTargets[position]) != scc ? 1 : 0;
+                            }
+                        }
+                        remainingSuccessorEdges[scc].store(count, std::memory_order_relaxed);
+                    }
+                });
+                std::vector<uint64_t> sccs(sccCount);
+                std::iota(sccs.begin(), sccs.end(), 0);
+                std::vector<uint64_t> level = parallelCollect(sccs, [&] (uint64_t scc, std::vector<uint64_t>& result) {
+                    if (remainingSuccessorEdges[scc].load(std::memory_order_relaxed) == 0) {
+                        result.push_back(scc);
+                    }
+                });
+                std::vector<uint64_t> sortedSccIndices(sccCount);
+                sccDepths.resize(sccCount);
+                uint64_t nextSccIndex = 0;
+                for (uint64_t depth = 0; !level.empty(); ++depth) {
+                    // Sort the SCCs of a level to obtain a deterministic result.
+                    std::sort(level.begin(), level.end());
+                    for (auto const& scc : level) {
+                        sortedSccIndices[scc] = nextSccIndex;
+                        sccDepths[nextSccIndex] = depth;
+                        ++nextSccIndex;
+                    }
+                    level = parallelCollect(level, [&] (uint64_t scc, std::vector<uint64_t>& result) {
+                        for (uint64_t member = memberStarts[scc]; member < memberStarts[scc + 1]; ++member) {
+                            uint64_t state = members[member];
+                            for (uint64_t position = backwardStarts[state]; position < backwardStarts[state + 1]; ++position) {
+                                uint64_t predecessorScc = getScc(backwardSources[position]);
+                                if (predecessorScc != scc && remainingSuccessorEdges[predecessorScc].fetch_sub(1, std::memory_order_relaxed) == 1) {
+                                    result.push_back(predecessorScc);
+                                }
+                            }
+                        }
+                    });
+                }
+                STORM_LOG_ASSERT(nextSccIndex == sccCount, "Not all SCCs were sorted.");
+
+                for (auto const& state : states) {
+                    uint64_t scc = getScc(state);
+                    stateToSccMapping[state] = sortedSccIndices[scc];
+                    if (hasSelfloop[state] || memberStarts[scc + 1] - memberStarts[scc] > 1) {
+                        nonTrivialStates.set(state, true);
+                    }
+                }
+            }
+        }
+
         template <typename ValueType>
         void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, StronglyConnectedComponentDecompositionOptions const& options) {
             
@@ -165,7 +634,27 @@ namespace storm {
             
             // Obtain a mapping from states to the SCC it belongs to
             std::vector<uint_fast64_t> stateToSccMapping(numberOfStates);
-            {
+            
+            bool parallel;
+            if (std::is_same<ValueType, storm::RationalFunction>::value) {
+                // Rational functions are excluded as their (shared) caches are not thread-safe.
+                STORM_LOG_WARN_COND(!options.isParallelSet || !options.isParallelSet.get(), "Computing the SCC decomposition in parallel is not supported for rational functions. Falling back to the sequential decomposition.");
+                parallel = false;
+            } else if (options.isParallelSet) {
+                parallel = options.isParallelSet.get();
+            } else {
+                uint64_t numberOfConsideredStates = options.subsystemPtr ? options.subsystemPtr->getNumberOfSetBits() : numberOfStates;
+                parallel = numberOfConsideredStates >= detail::minimalNumberOfStatesForParallelDecomposition && storm::settings::hasModule<storm::settings::modules::CoreSettings>() && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet() && storm::utility::parallel::getNumberOfThreads() > 1;
+            }
+            
+            if (parallel) {
+                std::vector<uint_fast64_t> computedSccDepths;
+                detail::performParallelSccDecomposition(transitionMatrix, options.subsystemPtr, options.choicesPtr, nonTrivialStates, stateToSccMapping, sccCount, computedSccDepths);
+                sccDepths = boost::none;
+                if (options.isComputeSccDepthsSet || options.areOnlyBottomSccsConsidered) {
+                    sccDepths = std::move(computedSccDepths);
+                }
+            } else {
             
                 // Set up the environment of the algorithm.
                 // Start with the two stacks it maintains.
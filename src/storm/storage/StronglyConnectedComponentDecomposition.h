@@ -31,6 +31,8 @@ namespace storm {
             StronglyConnectedComponentDecompositionOptions& forceTopologicalSort(bool value = true) { isTopologicalSortForced = value; return *this; }
             /// Sets if scc depths can be retrieved.
             StronglyConnectedComponentDecompositionOptions& computeSccDepths(bool value = true) { isComputeSccDepthsSet = value; return *this; }
+            /// Sets if the decomposition is computed in parallel. If this is not set explicitly, large systems are decomposed in parallel iff parallel computations are enabled in the core settings.
+            StronglyConnectedComponentDecompositionOptions& parallel(bool value = true) { isParallelSet = value; return *this; }
             
             storm::storage::BitVector const* subsystemPtr = nullptr;
             storm::storage::BitVector const* choicesPtr = nullptr;
@@ -38,6 +40,7 @@ namespace storm {
             bool areOnlyBottomSccsConsidered = false;
             bool isTopologicalSortForced = false;
             bool isComputeSccDepthsSet = false;
+            boost::optional<bool> isParallelSet;
             
         };
         
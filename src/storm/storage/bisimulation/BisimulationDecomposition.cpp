@@ -1,10 +1,16 @@
 #include "storm/storage/bisimulation/BisimulationDecomposition.h"
 
 #include <chrono>
+#include <atomic>
+#include <cmath>
+#include <type_traits>
+
+#include <boost/functional/hash.hpp>
 
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
 #include "storm/exceptions/InvalidOptionException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 #include "storm/logic/FormulaInformation.h"
 #include "storm/logic/FragmentSpecification.h"
@@ -19,17 +25,77 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/GeneralSettings.h"
 
 #include "storm/storage/bisimulation/DeterministicBlockData.h"
 
 #include "storm/utility/macros.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
     namespace storage {
         
         using namespace bisimulation;
         
+        namespace detail {
+            template<typename ValueType>
+            std::size_t hashSignatureValue(ValueType const& value, double) {
+                return std::hash<ValueType>()(value);
+            }
+            
+            std::size_t hashSignatureValue(double const& value, double precision) {
+                // Values that are considered equal by the comparator need to get the same hash (unless they happen to
+                // lie on different sides of a rounding boundary), so we hash the value rounded to the precision.
+                if (precision > 0) {
+                    double scaled = std::round(value / precision);
+                    if (std::abs(scaled) < 1e18) {
+                        return std::hash<int64_t>()(static_cast<int64_t>(scaled));
+                    }
+                }
+                return std::hash<double>()(value);
+            }
+            
+            template<typename ValueType>
+            std::size_t hashSignature(std::vector<std::pair<uint64_t, ValueType>> const& signature, double precision) {
+                std::size_t seed = 0;
+                for (auto const& entry : signature) {
+                    boost::hash_combine(seed, entry.first);
+                    boost::hash_combine(seed, hashSignatureValue(entry.second, precision));
+                }
+                return seed;
+            }
+            
+            template<typename ValueType>
+            bool signaturesEqual(std::vector<std::pair<uint64_t, ValueType>> const& first, std::vector<std::pair<uint64_t, ValueType>> const& second, storm::utility::ConstantsComparator<ValueType> const& comparator) {
+                if (first.size() != second.size()) {
+                    return false;
+                }
+                for (auto firstIt = first.begin(), secondIt = second.begin(); firstIt != first.end(); ++firstIt, ++secondIt) {
+                    if (firstIt->first != secondIt->first || !comparator.isEqual(firstIt->second, secondIt->second)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            
+            template<typename ValueType>
+            bool signatureLess(std::vector<std::pair<uint64_t, ValueType>> const& first, std::vector<std::pair<uint64_t, ValueType>> const& second, storm::utility::ConstantsComparator<ValueType> const& comparator) {
+                if (first.size() != second.size()) {
+                    return first.size() < second.size();
+                }
+                for (auto firstIt = first.begin(), secondIt = second.begin(); firstIt != first.end(); ++firstIt, ++secondIt) {
+                    if (firstIt->first != secondIt->first) {
+                        return firstIt->first < secondIt->first;
+                    }
+                    if (!comparator.isEqual(firstIt->second, secondIt->second)) {
+                        return comparator.isLess(firstIt->second, secondIt->second);
+                    }
+                }
+                return false;
+            }
+        }
+        
         template<typename ModelType, typename BlockDataType>
         BisimulationDecomposition<ModelType, BlockDataType>::Options::Options(ModelType const& model, storm::logic::Formula const& formula) : Options() {
             this->preserveSingleFormula(model, formula);
@@ -50,7 +116,7 @@ namespace storm {
         }
         
         template<typename ModelType, typename BlockDataType>
-        BisimulationDecomposition<ModelType, BlockDataType>::Options::Options() : measureDrivenInitialPartition(false), phiStates(), psiStates(), respectedAtomicPropositions(), buildQuotient(true), keepRewards(false), type(BisimulationType::Strong), bounded(false) {
+        BisimulationDecomposition<ModelType, BlockDataType>::Options::Options() : measureDrivenInitialPartition(false), phiStates(), psiStates(), respectedAtomicPropositions(), buildQuotient(true), signatureRefinement(false), keepRewards(false), type(BisimulationType::Strong), bounded(false) {
             // Intentionally left empty.
         }
         
@@ -234,6 +300,15 @@ namespace storm {
         
         template<typename ModelType, typename BlockDataType>
         void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefinement() {
+            if (options.signatureRefinement) {
+                if (this->supportsSignatureRefinement()) {
+                    this->performSignatureRefinement();
+                    this->finalizeSignatureRefinement();
+                    return;
+                }
+                STORM_LOG_WARN("Signature-based refinement is not supported for this kind of bisimulation, falling back to splitter-based refinement.");
+            }
+            
             // Insert all blocks into the splitter queue as a (potential) splitter.
             std::vector<Block<BlockDataType>*> splitterQueue;
             std::for_each(partition.getBlocks().begin(), partition.getBlocks().end(), [&] (std::unique_ptr<Block<BlockDataType>> const& block) { block->data().setSplitter(); splitterQueue.push_back(block.get()); } );
@@ -262,6 +337,139 @@ namespace storm {
             }
         }
         
+        template<typename ModelType, typename BlockDataType>
+        void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureRefinement() {
+            typedef std::vector<std::pair<uint64_t, ValueType>> SignatureType;
+            uint64_t numberOfStates = model.getNumberOfStates();
+            
+            // Arithmetic on exact and parametric values is not thread-safe, so for those the grain sizes are chosen
+            // such that everything is done by the calling thread.
+            bool parallel = std::is_same<ValueType, double>::value;
+            uint64_t stateGrainSize = parallel ? 1024 : std::max<uint64_t>(numberOfStates, 1);
+            double precision = parallel ? storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision() : 0.0;
+            
+            std::vector<uint64_t> stateToBlock(numberOfStates);
+            std::vector<std::size_t> signatureHashes(numberOfStates);
+            auto hashLess = [&signatureHashes] (storm::storage::sparse::state_type const& state1, storm::storage::sparse::state_type const& state2) { return signatureHashes[state1] < signatureHashes[state2]; };
+            auto isCandidate = [] (Block<BlockDataType> const& block) { return block.getNumberOfStates() > 1 && !block.data().absorbing(); };
+            
+            uint_fast64_t iterations = 0;
+            while (true) {
+                ++iterations;
+                
+                // Collect the blocks that can possibly be split.
+                std::vector<Block<BlockDataType>*> candidateBlocks;
+                for (auto const& block : partition.getBlocks()) {
+                    if (isCandidate(*block)) {
+                        candidateBlocks.push_back(block.get());
+                    }
+                }
+                if (candidateBlocks.empty()) {
+                    break;
+                }
+                uint64_t blockGrainSize = parallel ? 1 : candidateBlocks.size();
+                
+                // Take a snapshot of the current partition that the signatures refer to.
+                storm::utility::parallel::parallelFor(0, numberOfStates, stateGrainSize, [&] (auto const& range) {
+                    for (auto state = range.begin(); state != range.end(); ++state) {
+                        stateToBlock[state] = partition.getBlock(state).getId();
+                    }
+                });
+                
+                // Compute the hashes of the signatures of all states in candidate blocks.
+                storm::utility::parallel::parallelFor(0, numberOfStates, stateGrainSize, [&] (auto const& range) {
+                    SignatureType signature;
+                    for (auto state = range.begin(); state != range.end(); ++state) {
+                        if (isCandidate(partition.getBlock(state))) {
+                            signature.clear();
+                            this->computeSignature(state, stateToBlock, signature);
+                            signatureHashes[state] = detail::hashSignature(signature, precision);
+                        }
+                    }
+                });
+                
+                // Sort the states of each candidate block by their hashes. As the blocks occupy disjoint ranges, this
+                // can be done in parallel as long as the positions are not updated.
+                storm::utility::parallel::parallelFor(0, candidateBlocks.size(), blockGrainSize, [&] (auto const& range) {
+                    for (auto index = range.begin(); index != range.end(); ++index) {
+                        partition.sortRange(candidateBlocks[index]->getBeginIndex(), candidateBlocks[index]->getEndIndex(), hashLess, false);
+                    }
+                });
+                
+                bool split = false;
+                for (auto block : candidateBlocks) {
+                    split |= partition.splitSortedBlock(*block, hashLess, [] (Block<BlockDataType>&) {});
+                }
+                
+                if (!split) {
+                    // The hashes did not split any block, but states with equal hashes might still have different
+                    // signatures. Therefore, we compare the signatures of all states with the signature of the first
+                    // state of their block.
+                    std::vector<SignatureType> firstSignatures(partition.size());
+                    storm::utility::parallel::parallelFor(0, candidateBlocks.size(), blockGrainSize, [&] (auto const& range) {
+                        for (auto index = range.begin(); index != range.end(); ++index) {
+                            Block<BlockDataType> const& block = *candidateBlocks[index];
+                            this->computeSignature(*partition.begin(block), stateToBlock, firstSignatures[block.getId()]);
+                        }
+                    });
+                    
+                    std::vector<std::atomic<bool>> unstable(partition.size());
+                    storm::utility::parallel::parallelFor(0, numberOfStates, stateGrainSize, [&] (auto const& range) {
+                        SignatureType signature;
+                        for (auto state = range.begin(); state != range.end(); ++state) {
+                            Block<BlockDataType> const& block = partition.getBlock(state);
+                            if (isCandidate(block) && !unstable[block.getId()].load(std::memory_order_relaxed)) {
+                                signature.clear();
+                                this->computeSignature(state, stateToBlock, signature);
+                                if (!detail::signaturesEqual(signature, firstSignatures[block.getId()], comparator)) {
+                                    unstable[block.getId()].store(true, std::memory_order_relaxed);
+                                }
+                            }
+                        }
+                    });
+                    
+                    // Split the blocks with hash collisions based on the exact signatures.
+                    for (auto block : candidateBlocks) {
+                        if (!unstable[block->getId()].load(std::memory_order_relaxed)) {
+                            continue;
+                        }
+                        
+                        storm::storage::sparse::state_type beginIndex = block->getBeginIndex();
+                        std::vector<SignatureType> signatures(block->getNumberOfStates());
+                        for (auto position = beginIndex; position < block->getEndIndex(); ++position) {
+                            this->computeSignature(partition.getState(position), stateToBlock, signatures[position - beginIndex]);
+                        }
+                        split |= partition.splitBlock(*block, [&] (storm::storage::sparse::state_type const& state1, storm::storage::sparse::state_type const& state2) { return detail::signatureLess(signatures[partition.getPosition(state1) - beginIndex], signatures[partition.getPosition(state2) - beginIndex], comparator); }, [] (Block<BlockDataType>&) {});
+                    }
+                    
+                    if (!split) {
+                        break;
+                    }
+                }
+                
+                if (storm::utility::resources::isTerminate()) {
+                    std::cout << "Performed " << iterations << " iterations of signature-based partition refinement before abort." << std::endl;
+                    STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in bisimulation computation.");
+                }
+            }
+            STORM_LOG_DEBUG("Signature-based partition refinement took " << iterations << " iterations.");
+        }
+        
+        template<typename ModelType, typename BlockDataType>
+        bool BisimulationDecomposition<ModelType, BlockDataType>::supportsSignatureRefinement() const {
+            return false;
+        }
+        
+        template<typename ModelType, typename BlockDataType>
+        void BisimulationDecomposition<ModelType, BlockDataType>::computeSignature(storm::storage::sparse::state_type, std::vector<uint64_t> const&, std::vector<std::pair<uint64_t, ValueType>>&) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Signature-based refinement is not supported for this kind of bisimulation.");
+        }
+        
+        template<typename ModelType, typename BlockDataType>
+        void BisimulationDecomposition<ModelType, BlockDataType>::finalizeSignatureRefinement() {
+            // Intentionally left empty.
+        }
+        
         template<typename ModelType, typename BlockDataType>
         std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
             STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException, "Unable to retrieve quotient model from bisimulation decomposition, because it was not built.");
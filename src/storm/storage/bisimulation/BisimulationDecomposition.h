@@ -132,6 +132,9 @@ namespace storm {
                 /// A flag that governs whether the quotient model is actually built or only the decomposition is computed.
                 bool buildQuotient;
                 
+                /// A flag that governs whether the partition is refined based on signatures (rather than splitters).
+                bool signatureRefinement;
+                
             private:
                 boost::optional<OptimizationDirection> optimalityType;
                 
@@ -213,6 +216,35 @@ namespace storm {
              */
             void performPartitionRefinement();
             
+            /*!
+             * Performs the partition refinement based on signatures. In each round, the signatures of all states wrt.
+             * the current partition are computed (in parallel) and hashed. Then, all blocks are split according to the
+             * hashes. Once this reaches a fixpoint, the signatures are compared exactly to rule out hash collisions.
+             */
+            void performSignatureRefinement();
+            
+            /*!
+             * Retrieves whether the partition can be refined based on signatures for the selected options.
+             */
+            virtual bool supportsSignatureRefinement() const;
+            
+            /*!
+             * Computes the signature of the given state wrt. the partition given by the mapping from states to block
+             * ids. Two states need to be in different blocks iff their signatures differ. Note that this function is
+             * called concurrently (for floating-point models), so it must not modify the decomposition.
+             *
+             * @param state The state whose signature to compute.
+             * @param stateToBlock The mapping from states to the ids of their blocks.
+             * @param signature The vector to which the signature is appended.
+             */
+            virtual void computeSignature(storm::storage::sparse::state_type state, std::vector<uint64_t> const& stateToBlock, std::vector<std::pair<uint64_t, ValueType>>& signature) const;
+            
+            /*!
+             * Called after the partition was refined based on signatures, such that auxiliary data structures can be
+             * brought in line with the final partition.
+             */
+            virtual void finalizeSignatureRefinement();
+            
             /*!
              * Refines the partition by considering the given splitter. All blocks that become potential splitters
              * because of this refinement, are marked as splitters and inserted into the splitter vector.
@@ -559,6 +559,36 @@ namespace storm {
             }
         }
         
+        template<typename ModelType>
+        bool DeterministicModelBisimulationDecomposition<ModelType>::supportsSignatureRefinement() const {
+            // For weak bisimulation, the silent probabilities would need to be taken into account.
+            return this->options.getType() == BisimulationType::Strong;
+        }
+        
+        template<typename ModelType>
+        void DeterministicModelBisimulationDecomposition<ModelType>::computeSignature(storm::storage::sparse::state_type state, std::vector<uint64_t> const& stateToBlock, std::vector<std::pair<uint64_t, ValueType>>& signature) const {
+            for (auto const& entry : this->model.getTransitionMatrix().getRow(state)) {
+                if (!this->comparator.isZero(entry.getValue())) {
+                    signature.emplace_back(stateToBlock[entry.getColumn()], entry.getValue());
+                }
+            }
+            
+            // Sum the probabilities that lead to the same block.
+            std::sort(signature.begin(), signature.end(), [] (std::pair<uint64_t, ValueType> const& a, std::pair<uint64_t, ValueType> const& b) { return a.first < b.first; });
+            auto targetIt = signature.begin();
+            for (auto it = signature.begin(), ite = signature.end(); it != ite; ++it) {
+                if (targetIt != signature.begin() && std::prev(targetIt)->first == it->first) {
+                    std::prev(targetIt)->second += it->second;
+                } else {
+                    if (targetIt != it) {
+                        *targetIt = std::move(*it);
+                    }
+                    ++targetIt;
+                }
+            }
+            signature.erase(targetIt, signature.end());
+        }
+        
         template<typename ModelType>
         void DeterministicModelBisimulationDecomposition<ModelType>::buildQuotient() {
             // In order to create the quotient model, we need to construct
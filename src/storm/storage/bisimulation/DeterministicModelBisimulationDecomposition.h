@@ -41,6 +41,10 @@ namespace storm {
             
             virtual void refinePartitionBasedOnSplitter(bisimulation::Block<BlockDataType>& splitter, std::vector<bisimulation::Block<BlockDataType>*>& splitterQueue) override;
 
+            virtual bool supportsSignatureRefinement() const override;
+            
+            virtual void computeSignature(storm::storage::sparse::state_type state, std::vector<uint64_t> const& stateToBlock, std::vector<std::pair<uint64_t, ValueType>>& signature) const override;
+            
         private:
             // Post-processes the initial partition to properly initialize it.
             void postProcessInitialPartition();
@@ -1,5 +1,7 @@
 #include "storm/storage/bisimulation/NondeterministicModelBisimulationDecomposition.h"
 
+#include <limits>
+
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -94,6 +96,48 @@ namespace storm {
                       });
         }
         
+        template<typename ModelType>
+        bool NondeterministicModelBisimulationDecomposition<ModelType>::supportsSignatureRefinement() const {
+            return true;
+        }
+        
+        template<typename ModelType>
+        void NondeterministicModelBisimulationDecomposition<ModelType>::computeSignature(storm::storage::sparse::state_type state, std::vector<uint64_t> const& stateToBlock, std::vector<std::pair<uint64_t, ValueType>>& signature) const {
+            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+            bool keepActionRewards = this->options.getKeepRewards() && this->model.hasRewardModel() && this->model.getUniqueRewardModel().hasStateActionRewards();
+            
+            // The signature of a state is the set of its distributions over blocks.
+            std::vector<storm::storage::DistributionWithReward<ValueType>> distributions(nondeterministicChoiceIndices[state + 1] - nondeterministicChoiceIndices[state]);
+            for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+                auto& distribution = distributions[choice - nondeterministicChoiceIndices[state]];
+                if (keepActionRewards) {
+                    distribution.setReward(this->model.getUniqueRewardModel().getStateActionReward(choice));
+                }
+                for (auto const& entry : this->model.getTransitionMatrix().getRow(choice)) {
+                    if (!this->comparator.isZero(entry.getValue())) {
+                        distribution.addProbability(stateToBlock[entry.getColumn()], entry.getValue());
+                    }
+                }
+            }
+            std::sort(distributions.begin(), distributions.end(), [this] (storm::storage::DistributionWithReward<ValueType> const& dist1, storm::storage::DistributionWithReward<ValueType> const& dist2) { return dist1.less(dist2, this->comparator); });
+            distributions.erase(std::unique(distributions.begin(), distributions.end(), [this] (storm::storage::DistributionWithReward<ValueType> const& dist1, storm::storage::DistributionWithReward<ValueType> const& dist2) { return dist1.equals(dist2, this->comparator); }), distributions.end());
+            
+            // Flatten the distributions, each one being terminated by a separator entry that carries its reward.
+            for (auto const& distribution : distributions) {
+                for (auto const& entry : distribution) {
+                    signature.emplace_back(entry.first, entry.second);
+                }
+                signature.emplace_back(std::numeric_limits<uint64_t>::max(), distribution.getReward());
+            }
+        }
+        
+        template<typename ModelType>
+        void NondeterministicModelBisimulationDecomposition<ModelType>::finalizeSignatureRefinement() {
+            // The quotient distributions still refer to the initial partition, so we recompute them.
+            std::fill(this->quotientDistributions.begin(), this->quotientDistributions.end(), storm::storage::DistributionWithReward<ValueType>());
+            this->initializeQuotientDistributions();
+        }
+        
         template<typename ModelType>
         void NondeterministicModelBisimulationDecomposition<ModelType>::buildQuotient() {
             // In order to create the quotient model, we need to construct
@@ -41,6 +41,12 @@ namespace storm {
             
             virtual void initialize() override;
             
+            virtual bool supportsSignatureRefinement() const override;
+            
+            virtual void computeSignature(storm::storage::sparse::state_type state, std::vector<uint64_t> const& stateToBlock, std::vector<std::pair<uint64_t, ValueType>>& signature) const override;
+            
+            virtual void finalizeSignatureRefinement() override;
+            
         private:
             // Creates the mapping from the choice indices to the states.
             void createChoiceToStateMapping();
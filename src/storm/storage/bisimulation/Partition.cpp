@@ -237,7 +237,11 @@ namespace storm {
             bool Partition<DataType>::splitBlock(Block<DataType>& block, std::function<bool (storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less, std::function<void (Block<DataType>&)> const& newBlockCallback) {
                 // Sort the block, but leave the positions untouched.
                 this->sortBlock(block, less, false);
-                
+                return this->splitSortedBlock(block, less, newBlockCallback);
+            }
+            
+            template<typename DataType>
+            bool Partition<DataType>::splitSortedBlock(Block<DataType>& block, std::function<bool (storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less, std::function<void (Block<DataType>&)> const& newBlockCallback) {
                 auto originalBegin = block.getBeginIndex();
                 auto originalEnd = block.getEndIndex();
                 
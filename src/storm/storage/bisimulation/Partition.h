@@ -69,6 +69,11 @@ namespace storm {
                 // Splits the block by sorting the states according to the given function and then identifying the split
                 // points.
                 bool splitBlock(Block<DataType>& block, std::function<bool (storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less);
+
+                // Splits the block by identifying the split points wrt. the given function. In contrast to splitBlock,
+                // the states of the block must already be sorted according to the function. The callback function is
+                // called for every newly created block.
+                bool splitSortedBlock(Block<DataType>& block, std::function<bool (storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less, std::function<void (Block<DataType>&)> const& newBlockCallback);
                 
                 // Splits all blocks by using the sorting-based splitting. The callback is called for all newly created
                 // blocks.
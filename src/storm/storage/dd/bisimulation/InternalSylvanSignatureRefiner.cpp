@@ -1,6 +1,7 @@
 #include "storm/storage/dd/bisimulation/InternalSylvanSignatureRefiner.h"
 
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 
 #include "storm/storage/dd/bisimulation/Partition.h"
 #include "storm/storage/dd/bisimulation/Signature.h"
@@ -13,6 +14,9 @@ namespace storm {
             
             static const uint64_t NO_ELEMENT_MARKER = -1ull;
             
+            // The number of entries that are reset by a single task when clearing the caches.
+            static const uint64_t clearingGrainSize = 1ull << 16;
+            
             InternalSylvanSignatureRefinerBase::InternalSylvanSignatureRefinerBase(storm::dd::DdManager<storm::dd::DdType::Sylvan> const& manager, storm::expressions::Variable const& blockVariable, std::set<storm::expressions::Variable> const& stateVariables, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& nondeterminismVariables, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& nonBlockVariables, InternalSignatureRefinerOptions const& options) : manager(manager), blockVariable(blockVariable), stateVariables(stateVariables), nondeterminismVariables(nondeterminismVariables), nonBlockVariables(nonBlockVariables), options(options), numberOfBlockVariables(manager.getMetaVariable(blockVariable).getNumberOfDdVariables()), blockCube(manager.getMetaVariable(blockVariable).getCube()), nextFreeBlockIndex(0), numberOfRefinements(0), currentCapacity(1ull << 20), resizeFlag(0) {
                 
                 // Perform garbage collection to clean up stuff not needed anymore.
@@ -38,12 +42,13 @@ namespace storm {
             
             template<typename ValueType>
             void InternalSignatureRefiner<storm::dd::DdType::Sylvan, ValueType>::clearCaches() {
-                for (auto& e : this->table) {
-                    e = NO_ELEMENT_MARKER;
-                }
-                for (auto& e : this->signatures) {
-                    e = 0ull;
-                }
+                // The table grows with the number of blocks, so resetting it is done by the workers in parallel.
+                storm::dd::InternalDdManager<storm::dd::DdType::Sylvan>::executeInParallel(this->table.size(), clearingGrainSize, [this] (uint_fast64_t begin, uint_fast64_t end) {
+                    std::fill(this->table.begin() + begin, this->table.begin() + end, NO_ELEMENT_MARKER);
+                });
+                storm::dd::InternalDdManager<storm::dd::DdType::Sylvan>::executeInParallel(this->signatures.size(), clearingGrainSize, [this] (uint_fast64_t begin, uint_fast64_t end) {
+                    std::fill(this->signatures.begin() + begin, this->signatures.begin() + end, 0ull);
+                });
             }
             
             template<typename ValueType>
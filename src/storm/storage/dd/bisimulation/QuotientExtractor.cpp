@@ -1,6 +1,10 @@
 #include "storm/storage/dd/bisimulation/QuotientExtractor.h"
 
+#include <cmath>
+#include <exception>
+#include <mutex>
 #include <numeric>
+#include <type_traits>
 
 #include "storm/storage/dd/DdManager.h"
 
@@ -20,6 +24,7 @@
 
 #include "storm/storage/dd/cudd/utility.h"
 #include "storm/storage/dd/sylvan/utility.h"
+#include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 
 #include "storm/settings/SettingsManager.h"
 
@@ -629,9 +634,63 @@ namespace storm {
                 }
                 
             private:
+                // The arguments of a (deferred) call to extractTransitionMatrixRec.
+                struct MatrixExtractionTask {
+                    MTBDD transitionMatrixNode;
+                    storm::dd::Odd const* sourceOdd;
+                    uint64_t sourceOffset;
+                    BDD targetPartitionNode;
+                    BDD representativesNode;
+                    BDD variables;
+                    BDD nondeterminismVariables;
+                    storm::dd::Odd const* stateOdd;
+                    uint64_t stateOffset;
+                };
+                
                 virtual storm::storage::SparseMatrix<ExportValueType> extractMatrixInternal(storm::dd::Add<storm::dd::DdType::Sylvan, ValueType> const& matrix) override {
                     this->createMatrixEntryStorage();
-                    extractTransitionMatrixRec(matrix.getInternalAdd().getSylvanMtbdd().GetMTBDD(), this->isNondeterministic ? this->nondeterminismOdd : this->odd, 0, this->partitionBdd.getInternalBdd().getSylvanBdd().GetBDD(), this->representatives.getInternalBdd().getSylvanBdd().GetBDD(), this->allSourceVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(), this->nondeterminismVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(), this->isNondeterministic ? &this->odd : nullptr, 0);
+                    
+                    MTBDD matrixNode = matrix.getInternalAdd().getSylvanMtbdd().GetMTBDD();
+                    storm::dd::Odd const& sourceOdd = this->isNondeterministic ? this->nondeterminismOdd : this->odd;
+                    BDD partitionNode = this->partitionBdd.getInternalBdd().getSylvanBdd().GetBDD();
+                    BDD representativesNode = this->representatives.getInternalBdd().getSylvanBdd().GetBDD();
+                    BDD variables = this->allSourceVariablesCube.getInternalBdd().getSylvanBdd().GetBDD();
+                    BDD nondeterminismVariables = this->nondeterminismVariablesCube.getInternalBdd().getSylvanBdd().GetBDD();
+                    storm::dd::Odd const* stateOdd = this->isNondeterministic ? &this->odd : nullptr;
+                    
+                    // Converting the values is only thread-safe for doubles.
+                    uint64_t numberOfWorkers = storm::dd::InternalDdManager<storm::dd::DdType::Sylvan>::getNumberOfWorkers();
+                    if (std::is_same<ValueType, double>::value && std::is_same<ExportValueType, double>::value && numberOfWorkers > 1) {
+                        // Cut the recursion at a fixed depth of source variables. Since the calls that are collected
+                        // for different assignments of these variables write disjoint rows, they can be processed in
+                        // parallel.
+                        uint64_t depth = static_cast<uint64_t>(std::ceil(std::log2(numberOfWorkers))) + 4;
+                        std::vector<std::vector<MatrixExtractionTask>> tasks(1ull << depth);
+                        extractTransitionMatrixRec(matrixNode, sourceOdd, 0, partitionNode, representativesNode, variables, nondeterminismVariables, stateOdd, 0, &tasks, depth, 0);
+                        
+                        // Exceptions must not leave a Lace task, so the first one is stored and rethrown afterwards.
+                        std::exception_ptr exception;
+                        std::mutex exceptionMutex;
+                        storm::dd::InternalDdManager<storm::dd::DdType::Sylvan>::executeInParallel(tasks.size(), 1, [this, &tasks, &exception, &exceptionMutex] (uint_fast64_t begin, uint_fast64_t end) {
+                            try {
+                                for (auto taskIt = tasks.begin() + begin, taskIte = tasks.begin() + end; taskIt != taskIte; ++taskIt) {
+                                    for (auto const& task : *taskIt) {
+                                        extractTransitionMatrixRec(task.transitionMatrixNode, *task.sourceOdd, task.sourceOffset, task.targetPartitionNode, task.representativesNode, task.variables, task.nondeterminismVariables, task.stateOdd, task.stateOffset);
+                                    }
+                                }
+                            } catch (...) {
+                                std::lock_guard<std::mutex> lock(exceptionMutex);
+                                if (!exception) {
+                                    exception = std::current_exception();
+                                }
+                            }
+                        });
+                        if (exception) {
+                            std::rethrow_exception(exception);
+                        }
+                    } else {
+                        extractTransitionMatrixRec(matrixNode, sourceOdd, 0, partitionNode, representativesNode, variables, nondeterminismVariables, stateOdd, 0);
+                    }
                     return this->createMatrixFromEntries();
                 }
                 
@@ -712,7 +771,12 @@ namespace storm {
                     }
                 }
                 
-                void extractTransitionMatrixRec(MTBDD transitionMatrixNode, storm::dd::Odd const& sourceOdd, uint64_t sourceOffset, BDD targetPartitionNode, BDD representativesNode, BDD variables, BDD nondeterminismVariables, storm::dd::Odd const* stateOdd, uint64_t stateOffset) {
+                /*!
+                 * Adds the entries of the given part of the transition matrix. If tasks are given, the recursion stops
+                 * after the given number of source variables and the remaining calls are instead collected in the
+                 * tasks, where all calls for the same assignment of the source variables end up in the same task.
+                 */
+                void extractTransitionMatrixRec(MTBDD transitionMatrixNode, storm::dd::Odd const& sourceOdd, uint64_t sourceOffset, BDD targetPartitionNode, BDD representativesNode, BDD variables, BDD nondeterminismVariables, storm::dd::Odd const* stateOdd, uint64_t stateOffset, std::vector<std::vector<MatrixExtractionTask>>* tasks = nullptr, uint64_t remainingDepth = 0, uint64_t task = 0) {
 
                     // For the empty DD, we do not need to add any entries. Note that the partition nodes cannot be zero
                     // as all states of the model have to be contained.
@@ -720,6 +784,14 @@ namespace storm {
                         return;
                     }
                     
+                    if (tasks && (remainingDepth == 0 || sylvan_isconst(variables))) {
+                        (*tasks)[task << remainingDepth].push_back(MatrixExtractionTask{transitionMatrixNode, &sourceOdd, sourceOffset, targetPartitionNode, representativesNode, variables, nondeterminismVariables, stateOdd, stateOffset});
+                        return;
+                    }
+                    uint64_t elseTask = task << 1;
+                    uint64_t thenTask = (task << 1) | 1;
+                    uint64_t nextRemainingDepth = tasks ? remainingDepth - 1 : 0;
+                    
                     // If we have moved through all source variables, we must have arrived at a target block encoding.
                     if (sylvan_isconst(variables)) {
                         STORM_LOG_ASSERT(mtbdd_isleaf(transitionMatrixNode), "Expected constant node.");
@@ -744,8 +816,8 @@ namespace storm {
                             }
                             
                             STORM_LOG_ASSERT(stateOdd, "Expected separate state ODD.");
-                            extractTransitionMatrixRec(e, sourceOdd.getElseSuccessor(), sourceOffset, targetPartitionNode, representativesNode, sylvan_high(variables), sylvan_high(nondeterminismVariables), stateOdd, stateOffset);
-                            extractTransitionMatrixRec(t, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetPartitionNode, representativesNode, sylvan_high(variables), sylvan_high(nondeterminismVariables), stateOdd, stateOffset);
+                            extractTransitionMatrixRec(e, sourceOdd.getElseSuccessor(), sourceOffset, targetPartitionNode, representativesNode, sylvan_high(variables), sylvan_high(nondeterminismVariables), stateOdd, stateOffset, tasks, nextRemainingDepth, elseTask);
+                            extractTransitionMatrixRec(t, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetPartitionNode, representativesNode, sylvan_high(variables), sylvan_high(nondeterminismVariables), stateOdd, stateOffset, tasks, nextRemainingDepth, thenTask);
                         } else {
                             MTBDD t;
                             MTBDD tt;
@@ -805,10 +877,10 @@ namespace storm {
                                 representativesT = representativesE = representativesNode;
                             }
                             
-                            extractTransitionMatrixRec(ee, sourceOdd.getElseSuccessor(), sourceOffset, targetE, representativesE, sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset);
-                            extractTransitionMatrixRec(et, sourceOdd.getElseSuccessor(), sourceOffset, targetT, representativesE, sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset);
-                            extractTransitionMatrixRec(te, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetE, representativesT, sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateOdd->getThenSuccessor() : stateOdd, stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0));
-                            extractTransitionMatrixRec(tt, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetT, representativesT, sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateOdd->getThenSuccessor() : stateOdd, stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0));
+                            extractTransitionMatrixRec(ee, sourceOdd.getElseSuccessor(), sourceOffset, targetE, representativesE, sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset, tasks, nextRemainingDepth, elseTask);
+                            extractTransitionMatrixRec(et, sourceOdd.getElseSuccessor(), sourceOffset, targetT, representativesE, sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset, tasks, nextRemainingDepth, elseTask);
+                            extractTransitionMatrixRec(te, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetE, representativesT, sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateOdd->getThenSuccessor() : stateOdd, stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0), tasks, nextRemainingDepth, thenTask);
+                            extractTransitionMatrixRec(tt, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetT, representativesT, sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateOdd->getThenSuccessor() : stateOdd, stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0), tasks, nextRemainingDepth, thenTask);
                         }
                     }
                 }
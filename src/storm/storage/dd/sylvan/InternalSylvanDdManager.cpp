@@ -1,7 +1,20 @@
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 
+#include <cctype>
+#include <cerrno>
 #include <cmath>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <sstream>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/SylvanSettings.h"
@@ -13,6 +26,8 @@
 
 #include "storm/adapters/sylvan.h"
 
+#include "sylvan_cache.h"
+
 #include "storm-config.h"
 
 namespace storm {
@@ -39,6 +54,235 @@ namespace storm {
         
 #endif
         
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wzero-length-array"
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#endif
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+        
+        // Lace tasks can only take arguments that are named by a single token.
+        typedef std::function<void (uint_fast64_t, uint_fast64_t)> RangeFunction;
+        typedef std::vector<std::pair<int, int>> CpuAssignment;
+        typedef std::vector<uint64_t> WorkerCounters;
+        
+        VOID_TASK_4(execute_in_parallel, uint64_t, begin, uint64_t, end, uint64_t, grainSize, RangeFunction const*, function) {
+            if (end - begin > grainSize) {
+                uint64_t middle = begin + (end - begin) / 2;
+                SPAWN(execute_in_parallel, begin, middle, grainSize, function);
+                CALL(execute_in_parallel, middle, end, grainSize, function);
+                SYNC(execute_in_parallel);
+            } else {
+                (*function)(begin, end);
+            }
+        }
+        
+        // The CPU and NUMA node every worker was pinned to (or -1 if it was not pinned).
+        static CpuAssignment workerPinning;
+        
+        // Whether the worker statistics are to be shown when sylvan is shut down.
+        static bool showWorkerStatistics = false;
+        
+        // The number of tasks in the deque of each worker.
+        static const uint64_t dequeSize = 1024*1024*16;
+        
+#ifdef __linux__
+        VOID_TASK_1(pin_worker, CpuAssignment const*, assignment) {
+            uint64_t worker = LACE_WORKER_ID;
+            
+            // Worker 0 is the thread that started Lace. It is not pinned, because the pinning would outlive Sylvan and
+            // all threads it creates later (e.g. the ones for parallel computations) would inherit the single CPU.
+            if (worker == 0) {
+                return;
+            }
+            std::pair<int, int> const& cpuAndNode = (*assignment)[worker % assignment->size()];
+            
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+            CPU_SET(cpuAndNode.first, &cpus);
+            if (pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0) {
+                workerPinning[worker] = cpuAndNode;
+            }
+        }
+        
+        VOID_TASK_1(count_page_faults, WorkerCounters*, pageFaults) {
+            struct rusage usage;
+            if (getrusage(RUSAGE_THREAD, &usage) == 0) {
+                (*pageFaults)[LACE_WORKER_ID] = usage.ru_minflt;
+            }
+        }
+        
+        // Parses a non-negative number that has to make up the whole string.
+        bool parseKernelNumber(std::string const& text, int& number) {
+            if (text.empty() || !std::isdigit(static_cast<unsigned char>(text.front()))) {
+                return false;
+            }
+            char* end = nullptr;
+            errno = 0;
+            long value = std::strtol(text.c_str(), &end, 10);
+            if (errno != 0 || *end != '\0' || value > std::numeric_limits<int>::max()) {
+                return false;
+            }
+            number = static_cast<int>(value);
+            return true;
+        }
+        
+        // Parses a list of CPUs (or NUMA nodes) in the format used by the kernel, e.g. "0-3,8,10-11". Returns false if
+        // the list is malformed.
+        bool parseKernelList(std::string const& list, std::vector<int>& result) {
+            result.clear();
+            std::istringstream stream(list);
+            std::string range;
+            while (std::getline(stream, range, ',')) {
+                if (range.empty()) {
+                    continue;
+                }
+                std::size_t dash = range.find('-');
+                int first = 0;
+                int last = 0;
+                if (!parseKernelNumber(range.substr(0, dash), first)) {
+                    return false;
+                }
+                if (dash == std::string::npos) {
+                    last = first;
+                } else if (!parseKernelNumber(range.substr(dash + 1), last) || last < first) {
+                    return false;
+                }
+                for (int element = first; element <= last; ++element) {
+                    result.push_back(element);
+                }
+            }
+            return true;
+        }
+        
+        // Reads the list from the given file. A missing file yields an empty list, a malformed one yields false.
+        bool readKernelList(std::string const& path, std::vector<int>& result) {
+            result.clear();
+            std::ifstream file(path);
+            std::string list;
+            if (file && std::getline(file, list)) {
+                return parseKernelList(list, result);
+            }
+            return true;
+        }
+        
+        // Computes which CPU (and NUMA node) the workers are pinned to. Only CPUs the process may run on are used.
+        CpuAssignment computeCpuAssignment(storm::settings::modules::SylvanSettings::WorkerPinning const& pinning) {
+            cpu_set_t availableCpus;
+            CPU_ZERO(&availableCpus);
+            if (sched_getaffinity(0, sizeof(availableCpus), &availableCpus) != 0) {
+                return CpuAssignment();
+            }
+            
+            // Group the available CPUs by NUMA nodes. If the topology is unknown, we assume a single node.
+            // If the kernel reports something we cannot parse, we rather do not pin the workers at all.
+            std::vector<std::pair<int, std::vector<int>>> cpusPerNode;
+            std::vector<int> nodes;
+            if (!readKernelList("/sys/devices/system/node/online", nodes)) {
+                return CpuAssignment();
+            }
+            for (int node : nodes) {
+                std::vector<int> nodeCpus;
+                if (!readKernelList("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist", nodeCpus)) {
+                    return CpuAssignment();
+                }
+                std::vector<int> cpus;
+                for (int cpu : nodeCpus) {
+                    if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &availableCpus)) {
+                        cpus.push_back(cpu);
+                    }
+                }
+                if (!cpus.empty()) {
+                    cpusPerNode.emplace_back(node, std::move(cpus));
+                }
+            }
+            if (cpusPerNode.empty()) {
+                std::vector<int> cpus;
+                for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                    if (CPU_ISSET(cpu, &availableCpus)) {
+                        cpus.push_back(cpu);
+                    }
+                }
+                cpusPerNode.emplace_back(0, std::move(cpus));
+            }
+            
+            CpuAssignment result;
+            if (pinning == storm::settings::modules::SylvanSettings::WorkerPinning::Compact) {
+                for (auto const& nodeAndCpus : cpusPerNode) {
+                    for (int cpu : nodeAndCpus.second) {
+                        result.emplace_back(cpu, nodeAndCpus.first);
+                    }
+                }
+            } else {
+                bool added = true;
+                for (uint64_t index = 0; added; ++index) {
+                    added = false;
+                    for (auto const& nodeAndCpus : cpusPerNode) {
+                        if (index < nodeAndCpus.second.size()) {
+                            result.emplace_back(nodeAndCpus.second[index], nodeAndCpus.first);
+                            added = true;
+                        }
+                    }
+                }
+            }
+            return result;
+        }
+#endif
+        
+#pragma GCC diagnostic pop
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+        
+        void pinWorkers(storm::settings::modules::SylvanSettings::WorkerPinning const& pinning) {
+            workerPinning = CpuAssignment(lace_workers(), std::make_pair(-1, -1));
+            if (pinning == storm::settings::modules::SylvanSettings::WorkerPinning::None) {
+                return;
+            }
+#ifdef __linux__
+            CpuAssignment assignment = computeCpuAssignment(pinning);
+            if (assignment.empty()) {
+                STORM_LOG_WARN("Unable to determine the CPUs available for the Sylvan workers, workers are not pinned.");
+                return;
+            }
+            STORM_LOG_WARN_COND(assignment.size() >= lace_workers(), "There are more Sylvan workers (" << lace_workers() << ") than available CPUs (" << assignment.size() << "), so some workers share a CPU.");
+            LACE_ME;
+            TOGETHER(pin_worker, &assignment);
+#else
+            STORM_LOG_WARN("Pinning the Sylvan workers is not supported on this platform.");
+#endif
+        }
+        
+        void printWorkerStatistics() {
+            uint64_t numberOfWorkers = lace_workers();
+            WorkerCounters pageFaults(numberOfWorkers, 0);
+            uint64_t pageSize = 4096;
+            LACE_ME;
+#ifdef __linux__
+            TOGETHER(count_page_faults, &pageFaults);
+            pageSize = sysconf(_SC_PAGESIZE);
+#endif
+            
+            std::cout << std::endl;
+            std::cout << "Sylvan worker statistics:" << std::endl;
+            for (uint64_t worker = 0; worker < numberOfWorkers; ++worker) {
+                std::cout << "    * worker " << worker << ": ";
+                if (worker < workerPinning.size() && workerPinning[worker].first >= 0) {
+                    std::cout << "CPU " << workerPinning[worker].first << " (NUMA node " << workerPinning[worker].second << ")";
+                } else {
+                    std::cout << "not pinned";
+                }
+                std::cout << ", " << (pageFaults[worker] * pageSize) / (1024 * 1024) << "MB first touched, " << (dequeSize * sizeof(Task)) / (1024 * 1024) << "MB reserved for the task deque" << std::endl;
+            }
+            size_t filledNodes = 0;
+            size_t totalNodes = 0;
+            sylvan_table_usage(&filledNodes, &totalNodes);
+            std::cout << "    * unique table: " << filledNodes << " of " << totalNodes << " nodes used" << std::endl;
+            std::cout << "    * operation cache: " << cache_getused() << " of " << cache_getsize() << " entries used" << std::endl;
+            std::cout << std::endl;
+        }
+        
         uint_fast64_t InternalDdManager<DdType::Sylvan>::numberOfInstances = 0;
         
         // It is important that the variable pairs start at an even offset, because sylvan assumes this to be true for
@@ -58,11 +302,13 @@ namespace storm {
             if (numberOfInstances == 0) {
                 storm::settings::modules::SylvanSettings const& settings = storm::settings::getModule<storm::settings::modules::SylvanSettings>();
                 if (settings.isNumberOfThreadsSet()) {
-                    lace_init(settings.getNumberOfThreads(), 1024*1024*16);
+                    lace_init(settings.getNumberOfThreads(), dequeSize);
                 } else {
-                    lace_init(0, 1024*1024*16);
+                    lace_init(0, dequeSize);
                 }
                 lace_startup(0, 0, 0);
+                pinWorkers(settings.getWorkerPinning());
+                showWorkerStatistics = settings.isShowWorkerStatisticsSet();
                 
                 // Table/cache size computation taken from newer version of sylvan.
                 uint64_t memorycap = storm::settings::getModule<storm::settings::modules::SylvanSettings>().getMaximalMemory() * 1024 * 1024;
@@ -115,6 +361,10 @@ namespace storm {
         InternalDdManager<DdType::Sylvan>::~InternalDdManager() {
             --numberOfInstances;
             if (numberOfInstances == 0) {
+                if (showWorkerStatistics) {
+                    printWorkerStatistics();
+                }
+                
                 // Enable this to print the sylvan statistics to a file.
 //                FILE* filePointer = fopen("sylvan.stats", "w");
 //                sylvan_stats_report(filePointer, 0);
@@ -263,6 +513,18 @@ namespace storm {
             return nextFreeVariableIndex;
         }
         
+        uint_fast64_t InternalDdManager<DdType::Sylvan>::getNumberOfWorkers() {
+            return lace_workers();
+        }
+        
+        void InternalDdManager<DdType::Sylvan>::executeInParallel(uint_fast64_t numberOfElements, uint_fast64_t grainSize, std::function<void (uint_fast64_t, uint_fast64_t)> const& function) {
+            if (numberOfElements == 0) {
+                return;
+            }
+            LACE_ME;
+            CALL(execute_in_parallel, 0, numberOfElements, std::max<uint_fast64_t>(grainSize, 1), &function);
+        }
+        
         template InternalAdd<DdType::Sylvan, double> InternalDdManager<DdType::Sylvan>::getAddUndefined() const;
         template InternalAdd<DdType::Sylvan, uint_fast64_t> InternalDdManager<DdType::Sylvan>::getAddUndefined() const;
         
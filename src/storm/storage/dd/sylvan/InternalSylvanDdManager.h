@@ -1,6 +1,8 @@
 #ifndef STORM_STORAGE_DD_SYLVAN_INTERNALSYLVANDDMANAGER_H_
 #define STORM_STORAGE_DD_SYLVAN_INTERNALSYLVANDDMANAGER_H_
 
+#include <functional>
+
 #include <boost/optional.hpp>
 
 #include "storm/storage/dd/DdType.h"
@@ -139,6 +141,25 @@ namespace storm {
              */
             uint_fast64_t getNumberOfDdVariables() const;
             
+            /*!
+             * Retrieves the number of Lace workers that Sylvan uses.
+             *
+             * @return The number of workers.
+             */
+            static uint_fast64_t getNumberOfWorkers();
+            
+            /*!
+             * Executes the given function on all elements of [0, numberOfElements) by recursively splitting the range
+             * into Lace tasks until the ranges contain at most grainSize elements. Since Lace cannot propagate
+             * exceptions, the function must not throw. This must be called from the thread that created the manager
+             * (or from within a Lace task).
+             *
+             * @param numberOfElements The number of elements to process.
+             * @param grainSize The maximal number of elements that are processed by a single call of the function.
+             * @param function The function that is called with the bounds [begin, end) of a range.
+             */
+            static void executeInParallel(uint_fast64_t numberOfElements, uint_fast64_t grainSize, std::function<void (uint_fast64_t, uint_fast64_t)> const& function);
+            
         private:
             // Helper function to create the BDD whose encodings are below a given bound.
             BDD getBddEncodingLessOrEqualThanRec(uint64_t minimalValue, uint64_t maximalValue, uint64_t bound, BDD cube, uint64_t remainingDdVariables) const;
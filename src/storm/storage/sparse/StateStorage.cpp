@@ -1,17 +1,84 @@
 #include "storm/storage/sparse/StateStorage.h"
 
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidOperationException.h"
+
 namespace storm {
     namespace storage {
         namespace sparse {
                         
             template <typename StateType>
-            StateStorage<StateType>::StateStorage(uint64_t bitsPerState) : stateToId(bitsPerState, 100000), initialStateIndices(), deadlockStateIndices(), bitsPerState(bitsPerState) {
+            StateStorage<StateType>::StateStorage(uint64_t bitsPerState) : stateToId(bitsPerState, 100000), memoryLimit(0), initialStateIndices(), deadlockStateIndices(), bitsPerState(bitsPerState) {
                 // Intentionally left empty.
             }
 
             template <typename StateType>
             uint_fast64_t StateStorage<StateType>::getNumberOfStates() const {
-                return stateToId.size();
+                return stateToId.size() + (externalStateToId ? externalStateToId->size() : 0);
+            }
+            
+            template <typename StateType>
+            void StateStorage<StateType>::enableExternalStorage(uint64_t memoryLimit, std::string const& directory) {
+                STORM_LOG_THROW(getNumberOfStates() == 0, storm::exceptions::InvalidOperationException, "Cannot enable external storage of states after states were added.");
+                this->memoryLimit = memoryLimit;
+                externalStateToId = std::make_unique<storm::storage::ExternalBitVectorMap<StateType>>(bitsPerState, memoryLimit / 4, directory);
+                
+                // Choose the initial size such that the map may grow at least once before states need to be moved.
+                uint64_t bytesPerBucket = bitsPerState / 8 + sizeof(StateType) + 1;
+                stateToId = storm::storage::BitVectorHashMap<StateType>(bitsPerState, std::max<uint64_t>(memoryLimit / (12 * bytesPerBucket), 64));
+            }
+            
+            template <typename StateType>
+            bool StateStorage<StateType>::hasExternalStates() const {
+                return externalStateToId && externalStateToId->size() > 0;
+            }
+            
+            template <typename StateType>
+            StateType StateStorage<StateType>::findOrAdd(storm::storage::BitVector const& state, StateType const& newIndex) {
+                if (externalStateToId) {
+                    if (stateToId.contains(state)) {
+                        return stateToId.getValue(state);
+                    }
+                    auto flagAndIndex = externalStateToId->find(state);
+                    if (flagAndIndex.first) {
+                        return flagAndIndex.second;
+                    }
+                    
+                    // If adding the state triggers a resize of the map that would exceed the limit (during the resize,
+                    // the old and the new buckets are held), we move the states to the external storage instead.
+                    uint64_t bytesPerBucket = bitsPerState / 8 + sizeof(StateType) + 1;
+                    if (stateToId.size() >= 0.75 * stateToId.capacity() && 3 * stateToId.capacity() * bytesPerBucket > memoryLimit) {
+                        STORM_LOG_DEBUG("Moving " << stateToId.size() << " states to external storage.");
+                        externalStateToId->add(stateToId);
+                        stateToId = storm::storage::BitVectorHashMap<StateType>(bitsPerState, std::max<uint64_t>(memoryLimit / (12 * bytesPerBucket), 64));
+                    }
+                }
+                return stateToId.findOrAdd(state, newIndex);
+            }
+            
+            template <typename StateType>
+            bool StateStorage<StateType>::contains(storm::storage::BitVector const& state) const {
+                return stateToId.contains(state) || (externalStateToId && externalStateToId->contains(state));
+            }
+            
+            template <typename StateType>
+            StateType StateStorage<StateType>::getValue(storm::storage::BitVector const& state) const {
+                if (externalStateToId && !stateToId.contains(state)) {
+                    return externalStateToId->getValue(state);
+                }
+                return stateToId.getValue(state);
+            }
+            
+            template <typename StateType>
+            void StateStorage<StateType>::forEachState(std::function<void(storm::storage::BitVector const&, StateType const&)> const& function) const {
+                for (auto const& stateIndexPair : stateToId) {
+                    function(stateIndexPair.first, stateIndexPair.second);
+                }
+                if (externalStateToId) {
+                    externalStateToId->forEach(function);
+                }
             }
             
             template struct StateStorage<uint32_t>;
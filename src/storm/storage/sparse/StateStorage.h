@@ -1,8 +1,12 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
 
 #include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/ExternalBitVectorMap.h"
 
 namespace storm {
     namespace storage {
@@ -14,9 +18,17 @@ namespace storm {
                 // Creates an empty state storage structure for storing states of the given bit width.
                 StateStorage(uint64_t bitsPerState);
                 
-                // This member stores all the states and maps them to their unique indices.
+                // This member stores all the states and maps them to their unique indices. If an external storage is
+                // enabled, it only holds the states that were not yet moved to the external storage.
                 storm::storage::BitVectorHashMap<StateType> stateToId;
                 
+                // The states that were moved to an external storage (if enabled).
+                std::unique_ptr<storm::storage::ExternalBitVectorMap<StateType>> externalStateToId;
+                
+                // The number of bytes the states in stateToId may occupy (including the memory needed for resizing)
+                // before they are moved to the external storage.
+                uint64_t memoryLimit;
+                
                 // A list of initial states in terms of their global indices.
                 std::vector<StateType> initialStateIndices;
                 
@@ -28,9 +40,30 @@ namespace storm {
                 
                 // Get the number of states that were found in the exploration so far.
                 uint64_t getNumberOfStates() const;
+                
+                // Enables moving states to temporary files in the given directory (or the default directory for
+                // temporary files if it is empty) whenever the states held in memory would exceed the given number of
+                // bytes. In addition, a Bloom filter of a quarter of this size is kept in memory. This must be called
+                // before any state is added.
+                void enableExternalStorage(uint64_t memoryLimit, std::string const& directory = "");
+                
+                // Retrieves whether states were moved to the external storage.
+                bool hasExternalStates() const;
+                
+                // Searches for the given state. If it is found, its index is returned. Otherwise, the state is added
+                // with the given index (which is then returned).
+                StateType findOrAdd(storm::storage::BitVector const& state, StateType const& newIndex);
+                
+                // Checks whether the given state is stored.
+                bool contains(storm::storage::BitVector const& state) const;
+                
+                // Retrieves the index of the given state, which must be stored.
+                StateType getValue(storm::storage::BitVector const& state) const;
+                
+                // Applies the given function to all states and their indices (in no particular order).
+                void forEachState(std::function<void(storm::storage::BitVector const&, StateType const&)> const& function) const;
             };
             
         }
     }
 }
-
@@ -0,0 +1,194 @@
+#include "storm/utility/PerformanceCounters.h"
+
+#include <fstream>
+#include <functional>
+#include <sys/resource.h>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/io/file.h"
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/IllegalFunctionCallException.h"
+
+namespace storm {
+    namespace utility {
+
+        PerformanceCounters::Scope::Scope(PerformanceCounters* counters, std::string const& name) : counters(counters) {
+            if (counters) {
+                counters->enterScope(name);
+            }
+        }
+
+        PerformanceCounters::Scope::~Scope() {
+            if (counters) {
+                counters->leaveScope();
+            }
+        }
+
+        PerformanceCounters::PerformanceCounters() : creationTime(Clock::now()) {
+            root.name = "total";
+        }
+
+        void PerformanceCounters::enterScope(std::string const& name) {
+            std::lock_guard<std::mutex> lock(mutex);
+            Node& parent = getCurrentNode();
+            Node* node = nullptr;
+            for (auto& child : parent.children) {
+                if (child->name == name) {
+                    node = child.get();
+                    break;
+                }
+            }
+            if (!node) {
+                parent.children.push_back(std::make_unique<Node>());
+                node = parent.children.back().get();
+                node->name = name;
+            }
+            ++node->entries;
+            activeScopes[std::this_thread::get_id()].push_back(ActiveScope{node, Clock::now()});
+        }
+
+        void PerformanceCounters::leaveScope() {
+            Clock::time_point end = Clock::now();
+            updateMemoryHighWaterMark();
+            std::lock_guard<std::mutex> lock(mutex);
+            auto& scopes = activeScopes[std::this_thread::get_id()];
+            STORM_LOG_THROW(!scopes.empty(), storm::exceptions::IllegalFunctionCallException, "There is no scope to leave.");
+            ActiveScope scope = scopes.back();
+            scopes.pop_back();
+            scope.node->time += std::chrono::duration_cast<std::chrono::nanoseconds>(end - scope.start);
+            int64_t start = getTimestamp(scope.start);
+            traceEvents.push_back(TraceEvent{scope.node->name, getThreadIndex(), start, getTimestamp(end) - start, false, 0});
+        }
+
+        void PerformanceCounters::addToCounter(std::string const& name, uint64_t value) {
+            Clock::time_point now = Clock::now();
+            std::lock_guard<std::mutex> lock(mutex);
+            getCurrentNode().counters[name] += value;
+            uint64_t& total = counterTotals[name];
+            total += value;
+            traceEvents.push_back(TraceEvent{name, getThreadIndex(), getTimestamp(now), 0, true, total});
+        }
+
+        void PerformanceCounters::updateHighWaterMark(std::string const& name, uint64_t value) {
+            std::lock_guard<std::mutex> lock(mutex);
+            uint64_t& mark = getCurrentNode().highWaterMarks[name];
+            mark = std::max(mark, value);
+        }
+
+        void PerformanceCounters::updateMemoryHighWaterMark() {
+            struct rusage ru;
+            getrusage(RUSAGE_SELF, &ru);
+#ifdef MACOS
+            // For Mac OS, this is returned in bytes.
+            uint64_t peakMemoryInBytes = ru.ru_maxrss;
+#else
+            // For Linux, this is returned in kilobytes.
+            uint64_t peakMemoryInBytes = static_cast<uint64_t>(ru.ru_maxrss) * 1024;
+#endif
+            updateHighWaterMark("peak memory (bytes)", peakMemoryInBytes);
+        }
+
+        void PerformanceCounters::exportJson(std::ostream& stream) const {
+            typedef storm::json<double> Json;
+            std::function<Json(Node const&)> nodeToJson = [&nodeToJson] (Node const& node) {
+                Json result;
+                result["name"] = node.name;
+                result["entries"] = node.entries;
+                result["time (s)"] = std::chrono::duration<double>(node.time).count();
+                for (auto const& counter : node.counters) {
+                    result["counters"][counter.first] = counter.second;
+                }
+                for (auto const& mark : node.highWaterMarks) {
+                    result["high-water marks"][mark.first] = mark.second;
+                }
+                for (auto const& child : node.children) {
+                    result["scopes"].push_back(nodeToJson(*child));
+                }
+                return result;
+            };
+
+            std::lock_guard<std::mutex> lock(mutex);
+            Json result = nodeToJson(root);
+            // The root is never left, so we use the time that has passed so far.
+            result["time (s)"] = std::chrono::duration<double>(Clock::now() - creationTime).count();
+            for (auto const& total : counterTotals) {
+                result["counter totals"][total.first] = total.second;
+            }
+            stream << result.dump(4) << std::endl;
+        }
+
+        void PerformanceCounters::exportChromeTrace(std::ostream& stream) const {
+            typedef storm::json<double> Json;
+            std::lock_guard<std::mutex> lock(mutex);
+            Json events = Json::array();
+            for (auto const& event : traceEvents) {
+                Json jsonEvent;
+                jsonEvent["name"] = event.name;
+                jsonEvent["pid"] = 1;
+                jsonEvent["tid"] = event.thread;
+                jsonEvent["ts"] = event.start;
+                if (event.isCounter) {
+                    jsonEvent["ph"] = "C";
+                    jsonEvent["args"]["value"] = event.value;
+                } else {
+                    jsonEvent["ph"] = "X";
+                    jsonEvent["dur"] = event.duration;
+                }
+                events.push_back(std::move(jsonEvent));
+            }
+            Json result;
+            result["traceEvents"] = std::move(events);
+            result["displayTimeUnit"] = "ms";
+            stream << result.dump() << std::endl;
+        }
+
+        void PerformanceCounters::exportToFile(std::string const& filename, ExportFormat const& format) const {
+            std::ofstream stream;
+            storm::utility::openFile(filename, stream);
+            if (format == ExportFormat::ChromeTrace) {
+                exportChromeTrace(stream);
+            } else {
+                exportJson(stream);
+            }
+            storm::utility::closeFile(stream);
+        }
+
+        uint64_t PerformanceCounters::getCounterValue(std::string const& name) const {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto totalIt = counterTotals.find(name);
+            return totalIt == counterTotals.end() ? 0 : totalIt->second;
+        }
+
+        uint64_t PerformanceCounters::getNumberOfScopeEntries(std::string const& name) const {
+            std::function<uint64_t(Node const&)> countEntries = [&] (Node const& node) {
+                uint64_t result = node.name == name ? node.entries : 0;
+                for (auto const& child : node.children) {
+                    result += countEntries(*child);
+                }
+                return result;
+            };
+            std::lock_guard<std::mutex> lock(mutex);
+            return countEntries(root);
+        }
+
+        PerformanceCounters::Node& PerformanceCounters::getCurrentNode() {
+            auto scopesIt = activeScopes.find(std::this_thread::get_id());
+            if (scopesIt == activeScopes.end() || scopesIt->second.empty()) {
+                return root;
+            }
+            return *scopesIt->second.back().node;
+        }
+
+        int64_t PerformanceCounters::getTimestamp(Clock::time_point const& time) const {
+            return std::chrono::duration_cast<std::chrono::microseconds>(time - creationTime).count();
+        }
+
+        uint64_t PerformanceCounters::getThreadIndex() {
+            auto insertionResult = threadIndices.emplace(std::this_thread::get_id(), threadIndices.size());
+            return insertionResult.first->second;
+        }
+
+    }
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace storm {
+    namespace utility {
+
+        /*!
+         * Collects performance data of a computation in a hierarchy of named scopes. For every scope, the number of
+         * times it was entered, the time spent in it, the values of named counters (e.g. iterations, multiplications or
+         * streamed bytes) and named high-water marks (e.g. the peak memory usage) are recorded. Scopes that are
+         * entered while another scope of the same thread is active become children of that scope. Counters and
+         * high-water marks are attributed to the innermost active scope of the calling thread.
+         * The collected data can be exported as JSON or in the trace event format of Chrome (chrome://tracing).
+         * All operations are thread-safe.
+         */
+        class PerformanceCounters {
+        public:
+            enum class ExportFormat { Json, ChromeTrace };
+
+            /*!
+             * Enters a scope upon construction and leaves it upon destruction. If no performance counters are given,
+             * nothing is recorded.
+             */
+            class Scope {
+            public:
+                Scope(PerformanceCounters* counters, std::string const& name);
+                ~Scope();
+
+                Scope(Scope const&) = delete;
+                Scope& operator=(Scope const&) = delete;
+
+            private:
+                PerformanceCounters* counters;
+            };
+
+            PerformanceCounters();
+
+            /*!
+             * Enters the scope with the given name (as a child of the innermost active scope of the calling thread).
+             */
+            void enterScope(std::string const& name);
+
+            /*!
+             * Leaves the innermost active scope of the calling thread.
+             */
+            void leaveScope();
+
+            /*!
+             * Adds the given value to the counter with the given name.
+             */
+            void addToCounter(std::string const& name, uint64_t value = 1);
+
+            /*!
+             * Raises the high-water mark with the given name to the given value (if it is larger than the current one).
+             */
+            void updateHighWaterMark(std::string const& name, uint64_t value);
+
+            /*!
+             * Raises the high-water mark of the memory usage to the peak resident set size of the process.
+             */
+            void updateMemoryHighWaterMark();
+
+            /*!
+             * Writes the hierarchy of scopes (with their times, counters and high-water marks) as JSON.
+             */
+            void exportJson(std::ostream& stream) const;
+
+            /*!
+             * Writes the entered scopes and the counter updates as events of the Chrome trace format.
+             */
+            void exportChromeTrace(std::ostream& stream) const;
+
+            /*!
+             * Writes the collected data to the given file in the given format.
+             */
+            void exportToFile(std::string const& filename, ExportFormat const& format) const;
+
+            /*!
+             * Retrieves the accumulated value of the counter with the given name over all scopes.
+             */
+            uint64_t getCounterValue(std::string const& name) const;
+
+            /*!
+             * Retrieves how often scopes with the given name were entered.
+             */
+            uint64_t getNumberOfScopeEntries(std::string const& name) const;
+
+        private:
+            typedef std::chrono::steady_clock Clock;
+
+            struct Node {
+                std::string name;
+                uint64_t entries = 0;
+                std::chrono::nanoseconds time = std::chrono::nanoseconds::zero();
+                std::map<std::string, uint64_t> counters;
+                std::map<std::string, uint64_t> highWaterMarks;
+                std::vector<std::unique_ptr<Node>> children;
+            };
+
+            struct ActiveScope {
+                Node* node;
+                Clock::time_point start;
+            };
+
+            struct TraceEvent {
+                std::string name;
+                uint64_t thread;
+                int64_t start;
+                int64_t duration;
+                bool isCounter;
+                uint64_t value;
+            };
+
+            // Retrieves the innermost active node of the calling thread. The mutex needs to be held.
+            Node& getCurrentNode();
+
+            // Retrieves the number of microseconds since the creation of these counters.
+            int64_t getTimestamp(Clock::time_point const& time) const;
+
+            // Retrieves a small identifier of the calling thread. The mutex needs to be held.
+            uint64_t getThreadIndex();
+
+            mutable std::mutex mutex;
+            Clock::time_point creationTime;
+            Node root;
+            std::map<std::thread::id, std::vector<ActiveScope>> activeScopes;
+            std::map<std::thread::id, uint64_t> threadIndices;
+            std::map<std::string, uint64_t> counterTotals;
+            std::vector<TraceEvent> traceEvents;
+        };
+
+    }
+}
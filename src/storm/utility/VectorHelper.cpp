@@ -5,12 +5,14 @@
 
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
-#include "storm/adapters/IntelTbbAdapter.h"
 
+#include "storm/storage/BitVector.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/utility/macros.h"
-#include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
@@ -18,9 +20,7 @@ namespace storm {
         
         template<typename ValueType>
         VectorHelper<ValueType>::VectorHelper() : doParallelize(storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
-#ifndef STORM_HAVE_INTELTBB
-            STORM_LOG_THROW(!doParallelize, storm::exceptions::InvalidSettingsException, "Cannot parallelize without TBB.");
-#endif
+            // Intentionally left empty.
         }
         
         template<typename ValueType>
@@ -30,17 +30,83 @@ namespace storm {
 
         template<typename ValueType>
         void VectorHelper<ValueType>::reduceVector(storm::solver::OptimizationDirection dir, std::vector<ValueType> const& source, std::vector<ValueType>& target, std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices) const {
-#ifdef STORM_HAVE_INTELTBB
             if (this->parallelize()) {
                 storm::utility::vector::reduceVectorMinOrMaxParallel(dir, source, target, rowGrouping, choices);
             } else {
                 storm::utility::vector::reduceVectorMinOrMax(dir, source, target, rowGrouping, choices);
             }
-#else
-            storm::utility::vector::reduceVectorMinOrMax(dir, source, target, rowGrouping, choices);
-#endif
         }
 
+        namespace detail {
+            // The number of entries that are processed by a single task in the parallel comparisons.
+            static const uint64_t comparisonGrainSize = 4096;
+            
+            template<typename RangeType, typename Function>
+            void forEachPosition(RangeType const& range, storm::storage::BitVector const* positions, Function const& function) {
+                if (positions) {
+                    for (uint64_t index = positions->getNextSetIndex(range.begin()); index < range.end(); index = positions->getNextSetIndex(index + 1)) {
+                        if (!function(index)) {
+                            return;
+                        }
+                    }
+                } else {
+                    for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                        if (!function(index)) {
+                            return;
+                        }
+                    }
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        bool VectorHelper<ValueType>::equalModuloPrecision(std::vector<ValueType> const& vectorLeft, std::vector<ValueType> const& vectorRight, ValueType const& precision, bool relativeError, storm::storage::BitVector const* positions) const {
+            STORM_LOG_ASSERT(vectorLeft.size() == vectorRight.size(), "Lengths of vectors does not match.");
+            if (!this->parallelize() || vectorLeft.size() < 2 * detail::comparisonGrainSize) {
+                if (positions) {
+                    return storm::utility::vector::equalModuloPrecision(vectorLeft, vectorRight, *positions, precision, relativeError);
+                } else {
+                    return storm::utility::vector::equalModuloPrecision(vectorLeft, vectorRight, precision, relativeError);
+                }
+            }
+            
+            return storm::utility::parallel::parallelReduce(0, vectorLeft.size(), detail::comparisonGrainSize, true, [&] (auto const& range, bool equal) {
+                if (equal) {
+                    detail::forEachPosition(range, positions, [&] (uint64_t index) {
+                        equal = storm::utility::vector::equalModuloPrecision(vectorLeft[index], vectorRight[index], precision, relativeError);
+                        return equal;
+                    });
+                }
+                return equal;
+            }, [] (bool left, bool right) { return left && right; });
+        }
+        
+        template<typename ValueType>
+        ValueType VectorHelper<ValueType>::computeMaxAbsDiff(std::vector<ValueType> const& vectorLeft, std::vector<ValueType> const& vectorRight, storm::storage::BitVector const* positions) const {
+            STORM_LOG_ASSERT(vectorLeft.size() == vectorRight.size(), "Lengths of vectors does not match.");
+            auto body = [&] (auto const& range, ValueType result) {
+                detail::forEachPosition(range, positions, [&] (uint64_t index) {
+                    result = storm::utility::max<ValueType>(result, storm::utility::abs<ValueType>(vectorLeft[index] - vectorRight[index]));
+                    return true;
+                });
+                return result;
+            };
+            if (!this->parallelize() || vectorLeft.size() < 2 * detail::comparisonGrainSize) {
+                return body(storm::utility::parallel::Range(0, vectorLeft.size()), storm::utility::zero<ValueType>());
+            }
+            return storm::utility::parallel::parallelReduce(0, vectorLeft.size(), detail::comparisonGrainSize, storm::utility::zero<ValueType>(), body, [] (ValueType const& left, ValueType const& right) { return storm::utility::max<ValueType>(left, right); });
+        }
+        
+        template<>
+        bool VectorHelper<storm::RationalFunction>::equalModuloPrecision(std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const&, storm::RationalFunction const&, bool, storm::storage::BitVector const*) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+        
+        template<>
+        storm::RationalFunction VectorHelper<storm::RationalFunction>::computeMaxAbsDiff(std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const&, storm::storage::BitVector const*) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+        
         template<>
         void VectorHelper<storm::RationalFunction>::reduceVector(storm::solver::OptimizationDirection, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction>&, std::vector<uint_fast64_t> const&, std::vector<uint_fast64_t>*) const {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
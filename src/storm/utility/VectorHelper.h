@@ -6,6 +6,10 @@
 #include "storm/solver/OptimizationDirection.h"
 
 namespace storm {
+    namespace storage {
+        class BitVector;
+    }
+    
     namespace utility {
         
         template<typename ValueType>
@@ -15,6 +19,19 @@ namespace storm {
 
             void reduceVector(storm::solver::OptimizationDirection dir, std::vector<ValueType> const& source, std::vector<ValueType>& target, std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices = nullptr) const;
             
+            /*!
+             * Checks whether the given vectors are equal modulo the given precision. If positions are given, only these
+             * positions are compared. If the parallelization is enabled, chunks of the vectors are compared concurrently.
+             */
+            bool equalModuloPrecision(std::vector<ValueType> const& vectorLeft, std::vector<ValueType> const& vectorRight, ValueType const& precision, bool relativeError, storm::storage::BitVector const* positions = nullptr) const;
+            
+            /*!
+             * Computes the maximal absolute difference between the entries of the given vectors. If positions are given,
+             * only these positions are considered. If the parallelization is enabled, chunks of the vectors are processed
+             * concurrently.
+             */
+            ValueType computeMaxAbsDiff(std::vector<ValueType> const& vectorLeft, std::vector<ValueType> const& vectorRight, storm::storage::BitVector const* positions = nullptr) const;
+            
             bool parallelize() const;
             
         private:
@@ -127,6 +127,16 @@ namespace storm {
             return static_cast<double>(number);
         }
 
+        template<>
+        float convertNumber(double const& number){
+            return static_cast<float>(number);
+        }
+
+        template<>
+        double convertNumber(float const& number){
+            return static_cast<double>(number);
+        }
+
         template<>
         storm::storage::sparse::state_type convertNumber(long long const& number){
             return static_cast<storm::storage::sparse::state_type>(number);
@@ -22,6 +22,11 @@
 
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
+
 #include "storm/exceptions/InvalidArgumentException.h"
 
 #include <queue>
@@ -30,6 +35,109 @@ namespace storm {
     namespace utility {
         namespace graph {
             
+            namespace detail {
+                // The minimal number of frontier states (or bit vector words) that are processed by one task.
+                uint64_t const frontierSearchGrainSize = 256;
+                
+                // A level is computed by checking all open candidates (rather than the predecessors of the frontier)
+                // once the frontier exceeds this fraction of the open candidates.
+                uint64_t const frontierSearchPullFactor = 16;
+                
+                bool isFrontierSearchEnabled() {
+                    return storm::settings::hasModule<storm::settings::modules::ModelCheckerSettings>() && storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isFrontierSearchSet();
+                }
+                
+                /*!
+                 * Performs a backward search from the initial states that proceeds level by level. A candidate state is
+                 * added to the next level if it is a predecessor of a state of the current level and the given condition
+                 * is satisfied for the states that have been reached so far. As all states of a level are computed from
+                 * the same set of reached states, the states of a level can be computed in parallel.
+                 *
+                 * If the condition itself requires a reached successor, large levels are computed by checking all open
+                 * candidates, where whole words of the bit vectors are processed at once and words without open
+                 * candidates are skipped.
+                 *
+                 * @param backwardTransitions The reversed transition relation.
+                 * @param candidateStates The states that may be reached.
+                 * @param initialStates The states at which the search starts.
+                 * @param condition A function that gets a candidate state and the reached states and returns true iff
+                 * the candidate is reached.
+                 * @param conditionRequiresReachedSuccessor If true, the condition only holds for states that have a
+                 * successor among the reached states.
+                 * @param maximalSteps If given, the number of levels is bounded by this number.
+                 * @return The reached states (including the initial states).
+                 */
+                template <typename T, typename ConditionType>
+                storm::storage::BitVector performFrontierSearch(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& candidateStates, storm::storage::BitVector const& initialStates, ConditionType const& condition, bool conditionRequiresReachedSuccessor, boost::optional<uint_fast64_t> const& maximalSteps = boost::none) {
+                    uint_fast64_t const numberOfStates = initialStates.size();
+                    storm::storage::BitVector reachedStates(initialStates);
+                    std::vector<uint_fast64_t> frontier = initialStates.getSetIndices();
+                    uint_fast64_t numberOfOpenCandidates = candidateStates.getNumberOfSetBits() - candidateStates.getNumberOfSetBitsInIntersection(initialStates);
+                    
+                    for (uint_fast64_t level = 0; !frontier.empty() && numberOfOpenCandidates > 0 && (!maximalSteps || level < maximalSteps.get()); ++level) {
+                        if (conditionRequiresReachedSuccessor && frontier.size() * frontierSearchPullFactor > numberOfOpenCandidates) {
+                            // Check all open candidates. Each task writes whole words of the new level.
+                            storm::storage::BitVector newStates(numberOfStates);
+                            storm::utility::parallel::parallelFor(0, (numberOfStates + 63) / 64, frontierSearchGrainSize, [&] (auto const& range) {
+                                for (uint_fast64_t word = range.begin(); word < range.end(); ++word) {
+                                    uint_fast64_t firstState = word * 64;
+                                    uint_fast64_t numberOfBits = std::min<uint_fast64_t>(64, numberOfStates - firstState);
+                                    uint64_t openStates = candidateStates.getAsInt(firstState, numberOfBits) & ~reachedStates.getAsInt(firstState, numberOfBits);
+                                    uint64_t newStatesOfWord = 0;
+                                    while (openStates != 0) {
+                                        // The first state of the word corresponds to the most significant bit.
+                                        uint64_t bit = 63 - __builtin_clzll(openStates);
+                                        openStates &= ~(1ull << bit);
+                                        if (condition(firstState + numberOfBits - 1 - bit, reachedStates)) {
+                                            newStatesOfWord |= 1ull << bit;
+                                        }
+                                    }
+                                    if (newStatesOfWord != 0) {
+                                        newStates.setFromInt(firstState, numberOfBits, newStatesOfWord);
+                                    }
+                                }
+                            });
+                            reachedStates |= newStates;
+                            frontier.assign(newStates.begin(), newStates.end());
+                        } else {
+                            // Explore the predecessors of the frontier. A state may be found several times, so the new
+                            // level is made unique afterwards.
+                            std::vector<uint_fast64_t> foundStates = storm::utility::parallel::parallelReduce(0, frontier.size(), frontierSearchGrainSize, std::vector<uint_fast64_t>(), [&] (auto const& range, std::vector<uint_fast64_t> result) {
+                                for (uint_fast64_t index = range.begin(); index < range.end(); ++index) {
+                                    for (auto const& predecessorEntry : backwardTransitions.getRow(frontier[index])) {
+                                        uint_fast64_t predecessor = predecessorEntry.getColumn();
+                                        if (candidateStates.get(predecessor) && !reachedStates.get(predecessor) && condition(predecessor, reachedStates)) {
+                                            result.push_back(predecessor);
+                                        }
+                                    }
+                                }
+                                return result;
+                            }, [] (std::vector<uint_fast64_t> first, std::vector<uint_fast64_t> const& second) {
+                                first.insert(first.end(), second.begin(), second.end());
+                                return first;
+                            });
+                            frontier.clear();
+                            for (auto state : foundStates) {
+                                if (!reachedStates.get(state)) {
+                                    reachedStates.set(state, true);
+                                    frontier.push_back(state);
+                                }
+                            }
+                        }
+                        numberOfOpenCandidates -= frontier.size();
+                    }
+                    return reachedStates;
+                }
+                
+                /*!
+                 * Computes the states that reach the target states via the given states by a frontier search.
+                 */
+                template <typename T>
+                storm::storage::BitVector performFrontierReachability(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, boost::optional<uint_fast64_t> const& maximalSteps) {
+                    return performFrontierSearch(backwardTransitions, phiStates, psiStates, [] (uint_fast64_t, storm::storage::BitVector const&) { return true; }, false, maximalSteps);
+                }
+            }
+            
             template<typename T>
             storm::storage::BitVector getReachableStates(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& constraintStates, storm::storage::BitVector const& targetStates, bool useStepBound, uint_fast64_t maximalSteps, boost::optional<storm::storage::BitVector> const& choiceFilter) {
                 storm::storage::BitVector reachableStates(initialStates);
@@ -297,6 +405,14 @@ namespace storm {
             
             template <typename T>
             storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+                if (detail::isFrontierSearchEnabled()) {
+                    boost::optional<uint_fast64_t> stepBound;
+                    if (useStepBound) {
+                        stepBound = maximalSteps;
+                    }
+                    return detail::performFrontierReachability(backwardTransitions, phiStates, psiStates, stepBound);
+                }
+                
                 // Prepare the resulting bit vector.
                 uint_fast64_t numberOfStates = phiStates.size();
                 storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
@@ -305,7 +421,7 @@ namespace storm {
                 statesWithProbabilityGreater0 |= psiStates;
                 
                 // Initialize the stack used for the DFS with the states.
-                std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
+                std::vector<uint_fast64_t> stack = psiStates.getSetIndices();
                 
                 // Initialize the stack for the step bound, if the number of steps is bounded.
                 std::vector<uint_fast64_t> stepStack;
@@ -607,6 +723,14 @@ namespace storm {
             
             template <typename T>
             storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+                if (detail::isFrontierSearchEnabled()) {
+                    boost::optional<uint_fast64_t> stepBound;
+                    if (useStepBound) {
+                        stepBound = maximalSteps;
+                    }
+                    return detail::performFrontierReachability(backwardTransitions, phiStates, psiStates, stepBound);
+                }
+                
                 size_t numberOfStates = phiStates.size();
                 
                 // Prepare resulting bit vector.
@@ -616,7 +740,7 @@ namespace storm {
                 statesWithProbabilityGreater0 |= psiStates;
                 
                 // Initialize the stack used for the DFS with the states
-                std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
+                std::vector<uint_fast64_t> stack = psiStates.getSetIndices();
                 
                 // Initialize the stack for the step bound, if the number of steps is bounded.
                 std::vector<uint_fast64_t> stepStack;
@@ -679,11 +803,36 @@ namespace storm {
                 
                 // Perform the loop as long as the set of states gets larger.
                 bool done = false;
+                bool useFrontierSearch = detail::isFrontierSearchEnabled();
                 uint_fast64_t currentState;
                 while (!done) {
                     stack.clear();
                     storm::storage::BitVector nextStates(psiStates);
-                    stack.insert(stack.end(), psiStates.begin(), psiStates.end());
+                    if (useFrontierSearch) {
+                        // A state is added if one of its choices only leads to current states and to at least one next state.
+                        nextStates = detail::performFrontierSearch(backwardTransitions, phiStates, psiStates, [&] (uint_fast64_t state, storm::storage::BitVector const& reachedStates) {
+                            for (uint_fast64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+                                if (!choiceConstraint || choiceConstraint.get().get(row)) {
+                                    bool allSuccessorsInCurrentStates = true;
+                                    bool hasNextStateSuccessor = false;
+                                    for (auto const& successorEntry : transitionMatrix.getRow(row)) {
+                                        if (!currentStates.get(successorEntry.getColumn())) {
+                                            allSuccessorsInCurrentStates = false;
+                                            break;
+                                        } else if (reachedStates.get(successorEntry.getColumn())) {
+                                            hasNextStateSuccessor = true;
+                                        }
+                                    }
+                                    if (allSuccessorsInCurrentStates && hasNextStateSuccessor) {
+                                        return true;
+                                    }
+                                }
+                            }
+                            return false;
+                        }, true);
+                    } else {
+                        stack.insert(stack.end(), psiStates.begin(), psiStates.end());
+                    }
                     
                     while (!stack.empty()) {
                         currentState = stack.back();
@@ -753,6 +902,30 @@ namespace storm {
             
             template <typename T>
             storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+                if (!useStepBound && detail::isFrontierSearchEnabled()) {
+                    // A state is added if it has an (enabled) choice and all of its enabled choices lead to at least one
+                    // reached state.
+                    return detail::performFrontierSearch(backwardTransitions, phiStates, psiStates, [&] (uint_fast64_t state, storm::storage::BitVector const& reachedStates) {
+                        bool hasEnabledChoice = false;
+                        for (uint_fast64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+                            if (!choiceConstraint || choiceConstraint->get(row)) {
+                                hasEnabledChoice = true;
+                                bool hasAtLeastOneSuccessorWithProbabilityGreater0 = false;
+                                for (auto const& successorEntry : transitionMatrix.getRow(row)) {
+                                    if (reachedStates.get(successorEntry.getColumn())) {
+                                        hasAtLeastOneSuccessorWithProbabilityGreater0 = true;
+                                        break;
+                                    }
+                                }
+                                if (!hasAtLeastOneSuccessorWithProbabilityGreater0) {
+                                    return false;
+                                }
+                            }
+                        }
+                        return hasEnabledChoice;
+                    }, true);
+                }
+                
                 size_t numberOfStates = phiStates.size();
                 
                 // Prepare resulting bit vector.
@@ -762,7 +935,7 @@ namespace storm {
                 statesWithProbabilityGreater0 |= psiStates;
                 
                 // Initialize the stack used for the DFS with the states
-                std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
+                std::vector<uint_fast64_t> stack = psiStates.getSetIndices();
                 
                 // Initialize the stack for the step bound, if the number of steps is bounded.
                 std::vector<uint_fast64_t> stepStack;
@@ -893,11 +1066,36 @@ namespace storm {
                 
                 // Perform the loop as long as the set of states gets smaller.
                 bool done = false;
+                bool useFrontierSearch = detail::isFrontierSearchEnabled();
                 uint_fast64_t currentState;
                 while (!done) {
                     stack.clear();
                     storm::storage::BitVector nextStates(psiStates);
-                    stack.insert(stack.end(), psiStates.begin(), psiStates.end());
+                    if (useFrontierSearch) {
+                        // A state is added if all of its choices only lead to current states and to at least one next state.
+                        nextStates = detail::performFrontierSearch(backwardTransitions, phiStates, psiStates, [&] (uint_fast64_t state, storm::storage::BitVector const& reachedStates) {
+                            if (nondeterministicChoiceIndices[state] == nondeterministicChoiceIndices[state + 1]) {
+                                return false;
+                            }
+                            for (uint_fast64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+                                bool hasAtLeastOneSuccessorWithProbability1 = false;
+                                for (auto const& successorEntry : transitionMatrix.getRow(row)) {
+                                    if (!currentStates.get(successorEntry.getColumn())) {
+                                        return false;
+                                    }
+                                    if (reachedStates.get(successorEntry.getColumn())) {
+                                        hasAtLeastOneSuccessorWithProbability1 = true;
+                                    }
+                                }
+                                if (!hasAtLeastOneSuccessorWithProbability1) {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        }, true);
+                    } else {
+                        stack.insert(stack.end(), psiStates.begin(), psiStates.end());
+                    }
                     
                     while (!stack.empty()) {
                         currentState = stack.back();
@@ -1165,7 +1363,7 @@ namespace storm {
                 ExplicitGameProb01Result result(psiStates, storm::storage::BitVector(transitionMatrix.getRowGroupCount()));
                 
                 // Initialize the stack used for the DFS with the states
-                std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
+                std::vector<uint_fast64_t> stack = psiStates.getSetIndices();
 
                 // Perform the actual DFS.
                 uint_fast64_t currentState;
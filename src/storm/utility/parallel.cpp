@@ -0,0 +1,226 @@
+#include "storm/utility/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace utility {
+        namespace parallel {
+
+            uint64_t getNumberOfThreads() {
+                if (storm::settings::hasModule<storm::settings::modules::CoreSettings>()) {
+                    auto const& coreSettings = storm::settings::getModule<storm::settings::modules::CoreSettings>();
+                    if (coreSettings.isThreadCountSet() && coreSettings.getThreadCount() > 0) {
+                        return coreSettings.getThreadCount();
+                    }
+                }
+                return std::max<uint64_t>(1, std::thread::hardware_concurrency());
+            }
+
+            bool isIntelTbbBackend() {
+#ifdef STORM_HAVE_INTELTBB
+                return true;
+#else
+                return false;
+#endif
+            }
+
+            namespace detail {
+
+                /*!
+                 * A fixed set of worker threads that execute the tasks of one job at a time. The tasks of a job are
+                 * handed out dynamically (via an atomic counter), so idle threads pick up the remaining work.
+                 */
+                class ThreadPool {
+                public:
+                    ThreadPool(uint64_t numberOfThreads) : stop(false), generation(0) {
+                        // The calling thread participates in each job, so we only need to spawn the remaining threads.
+                        for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+                            workers.emplace_back([this] () { this->work(); });
+                        }
+                    }
+
+                    ~ThreadPool() {
+                        {
+                            std::unique_lock<std::mutex> lock(mutex);
+                            stop = true;
+                        }
+                        wakeUp.notify_all();
+                        for (auto& worker : workers) {
+                            worker.join();
+                        }
+                    }
+
+                    uint64_t getNumberOfWorkers() const {
+                        return workers.size();
+                    }
+
+                    void execute(uint64_t numberOfTasks, std::function<void(uint64_t)> const& task) {
+                        // Only one job is executed at a time.
+                        std::unique_lock<std::mutex> submitLock(submitMutex);
+
+                        auto job = std::make_shared<Job>(numberOfTasks, task);
+                        {
+                            std::unique_lock<std::mutex> lock(mutex);
+                            currentJob = job;
+                            ++generation;
+                        }
+                        wakeUp.notify_all();
+
+                        processTasks(*job);
+
+                        {
+                            std::unique_lock<std::mutex> lock(job->mutex);
+                            job->done.wait(lock, [&job] () { return job->finishedTasks == job->numberOfTasks; });
+                        }
+                        {
+                            std::unique_lock<std::mutex> lock(mutex);
+                            currentJob.reset();
+                        }
+                        if (job->exception) {
+                            std::rethrow_exception(job->exception);
+                        }
+                    }
+
+                    static thread_local bool isInsideTask;
+
+                private:
+                    struct Job {
+                        Job(uint64_t numberOfTasks, std::function<void(uint64_t)> const& task) : numberOfTasks(numberOfTasks), task(task), nextTask(0), finishedTasks(0) {
+                            // Intentionally left empty.
+                        }
+
+                        uint64_t const numberOfTasks;
+                        std::function<void(uint64_t)> const& task;
+                        std::atomic<uint64_t> nextTask;
+
+                        // Guarded by the mutex of the job.
+                        uint64_t finishedTasks;
+                        std::exception_ptr exception;
+                        std::mutex mutex;
+                        std::condition_variable done;
+                    };
+
+                    void processTasks(Job& job) {
+                        isInsideTask = true;
+                        uint64_t finished = 0;
+                        std::exception_ptr exception;
+                        for (uint64_t taskIndex = job.nextTask++; taskIndex < job.numberOfTasks; taskIndex = job.nextTask++) {
+                            try {
+                                job.task(taskIndex);
+                            } catch (...) {
+                                if (!exception) {
+                                    exception = std::current_exception();
+                                }
+                            }
+                            ++finished;
+                        }
+                        isInsideTask = false;
+
+                        if (finished > 0) {
+                            std::unique_lock<std::mutex> lock(job.mutex);
+                            if (exception && !job.exception) {
+                                job.exception = exception;
+                            }
+                            job.finishedTasks += finished;
+                            if (job.finishedTasks == job.numberOfTasks) {
+                                job.done.notify_all();
+                            }
+                        }
+                    }
+
+                    void work() {
+                        uint64_t seenGeneration = 0;
+                        while (true) {
+                            std::shared_ptr<Job> job;
+                            {
+                                std::unique_lock<std::mutex> lock(mutex);
+                                wakeUp.wait(lock, [&] () { return stop || generation != seenGeneration; });
+                                if (stop) {
+                                    return;
+                                }
+                                seenGeneration = generation;
+                                job = currentJob;
+                            }
+                            if (job) {
+                                processTasks(*job);
+                            }
+                        }
+                    }
+
+                    std::vector<std::thread> workers;
+
+                    // Serializes the jobs of different submitting threads.
+                    std::mutex submitMutex;
+
+                    // Guards the fields below.
+                    std::mutex mutex;
+                    std::condition_variable wakeUp;
+                    bool stop;
+                    uint64_t generation;
+                    std::shared_ptr<Job> currentJob;
+                };
+
+                thread_local bool ThreadPool::isInsideTask = false;
+
+                ThreadPool& getThreadPool() {
+                    static ThreadPool threadPool(getNumberOfThreads());
+                    return threadPool;
+                }
+
+                void executeOnThreadPool(uint64_t numberOfTasks, std::function<void(uint64_t)> const& task) {
+                    if (numberOfTasks == 0) {
+                        return;
+                    }
+                    // Nested parallelism is executed sequentially to avoid that the workers wait for each other.
+                    if (numberOfTasks == 1 || ThreadPool::isInsideTask) {
+                        for (uint64_t taskIndex = 0; taskIndex < numberOfTasks; ++taskIndex) {
+                            task(taskIndex);
+                        }
+                        return;
+                    }
+                    ThreadPool& threadPool = getThreadPool();
+                    if (threadPool.getNumberOfWorkers() == 0) {
+                        for (uint64_t taskIndex = 0; taskIndex < numberOfTasks; ++taskIndex) {
+                            task(taskIndex);
+                        }
+                        return;
+                    }
+                    threadPool.execute(numberOfTasks, task);
+                }
+
+                std::vector<Range> splitIntoChunks(uint64_t begin, uint64_t end, uint64_t grainSize) {
+                    STORM_LOG_ASSERT(begin <= end, "Invalid range.");
+                    // Aim for a few chunks per thread so that the dynamic scheduling can balance the load.
+                    uint64_t const chunksPerThread = 4;
+                    uint64_t size = end - begin;
+                    uint64_t numberOfThreads = getThreadPool().getNumberOfWorkers() + 1;
+                    uint64_t chunkSize = std::max<uint64_t>(std::max<uint64_t>(grainSize, 1), size / (numberOfThreads * chunksPerThread));
+                    std::vector<Range> chunks;
+                    chunks.reserve(size / chunkSize + 1);
+                    for (uint64_t chunkStart = begin; chunkStart < end; chunkStart += chunkSize) {
+                        chunks.emplace_back(chunkStart, std::min(end, chunkStart + chunkSize));
+                    }
+                    return chunks;
+                }
+
+#ifdef STORM_HAVE_INTELTBB
+                void executeInTbbArena(std::function<void()> const& function) {
+                    static tbb::task_arena arena(static_cast<int>(getNumberOfThreads()));
+                    arena.execute(function);
+                }
+#endif
+            }
+        }
+    }
+}
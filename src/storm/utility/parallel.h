@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+
+namespace storm {
+    namespace utility {
+        namespace parallel {
+
+            /*!
+             * A half-open range [begin, end) of indices. This mirrors the interface of tbb::blocked_range so that the
+             * same loop bodies can be used with both parallel backends.
+             */
+            class Range {
+            public:
+                Range(uint64_t begin, uint64_t end) : first(begin), last(end) {
+                    // Intentionally left empty.
+                }
+
+                uint64_t begin() const {
+                    return first;
+                }
+
+                uint64_t end() const {
+                    return last;
+                }
+
+                uint64_t size() const {
+                    return last - first;
+                }
+
+                bool empty() const {
+                    return first == last;
+                }
+
+            private:
+                uint64_t first;
+                uint64_t last;
+            };
+
+            /*!
+             * Retrieves the number of threads used for parallel computations. This is the thread count given in the
+             * core settings or (if none is given) the number of hardware threads.
+             */
+            uint64_t getNumberOfThreads();
+
+            /*!
+             * Retrieves whether parallel computations are backed by Intel TBB (as opposed to the built-in thread pool).
+             */
+            bool isIntelTbbBackend();
+
+            namespace detail {
+                /*!
+                 * Executes the given number of tasks on the built-in thread pool (where the calling thread participates)
+                 * and returns once all tasks have been executed. If one of the tasks throws, the first exception is
+                 * rethrown after all tasks have finished. Calls issued from within a task are executed sequentially.
+                 */
+                void executeOnThreadPool(uint64_t numberOfTasks, std::function<void(uint64_t)> const& task);
+
+                /*!
+                 * Splits the given range into chunks of at least the given size such that there are enough chunks to
+                 * balance the load between the threads.
+                 */
+                std::vector<Range> splitIntoChunks(uint64_t begin, uint64_t end, uint64_t grainSize);
+
+#ifdef STORM_HAVE_INTELTBB
+                /*!
+                 * Executes the given function in a TBB task arena whose concurrency is the configured number of threads.
+                 */
+                void executeInTbbArena(std::function<void()> const& function);
+#endif
+            }
+
+            /*!
+             * Applies the given body to chunks of the range [begin, end) in parallel. The body is called with objects
+             * that provide begin() and end() (either a Range or a tbb::blocked_range<uint64_t>), so it should be a
+             * generic lambda or a functor with a templated call operator.
+             *
+             * @param grainSize The minimal number of indices per chunk.
+             */
+            template<typename Body>
+            void parallelFor(uint64_t begin, uint64_t end, uint64_t grainSize, Body const& body) {
+                if (begin >= end) {
+                    return;
+                }
+#ifdef STORM_HAVE_INTELTBB
+                detail::executeInTbbArena([&] () {
+                    tbb::parallel_for(tbb::blocked_range<uint64_t>(begin, end, grainSize), body);
+                });
+#else
+                std::vector<Range> chunks = detail::splitIntoChunks(begin, end, grainSize);
+                detail::executeOnThreadPool(chunks.size(), [&] (uint64_t chunk) {
+                    body(chunks[chunk]);
+                });
+#endif
+            }
+
+            /*!
+             * Reduces the range [begin, end) in parallel. The body is called with a range (see parallelFor) and the
+             * identity and returns the partial result for the range. The partial results are combined with the given
+             * (associative) join operation. With the built-in thread pool, the partial results are joined in the order
+             * of the ranges, so the result does not depend on the scheduling.
+             *
+             * @param grainSize The minimal number of indices per chunk.
+             */
+            template<typename ValueType, typename Body, typename Join>
+            ValueType parallelReduce(uint64_t begin, uint64_t end, uint64_t grainSize, ValueType const& identity, Body const& body, Join const& join) {
+                if (begin >= end) {
+                    return identity;
+                }
+#ifdef STORM_HAVE_INTELTBB
+                ValueType result = identity;
+                detail::executeInTbbArena([&] () {
+                    result = tbb::parallel_reduce(tbb::blocked_range<uint64_t>(begin, end, grainSize), identity, body, join);
+                });
+                return result;
+#else
+                std::vector<Range> chunks = detail::splitIntoChunks(begin, end, grainSize);
+                // Wrap the partial results to avoid that different threads write to the same word (e.g. for bools).
+                struct PartialResult {
+                    ValueType value;
+                };
+                std::vector<PartialResult> partialResults(chunks.size(), PartialResult{identity});
+                detail::executeOnThreadPool(chunks.size(), [&] (uint64_t chunk) {
+                    partialResults[chunk].value = body(chunks[chunk], identity);
+                });
+                ValueType result = identity;
+                for (auto const& partialResult : partialResults) {
+                    result = join(result, partialResult.value);
+                }
+                return result;
+#endif
+            }
+
+        }
+    }
+}
@@ -0,0 +1,40 @@
+#include "storm/utility/simd.h"
+
+namespace storm {
+    namespace utility {
+        namespace simd {
+            
+            namespace detail {
+                SimdLevel detectSimdLevel() {
+#ifdef STORM_HAVE_X86_SIMD_DISPATCH
+                    __builtin_cpu_init();
+                    if (__builtin_cpu_supports("avx512f")) {
+                        return SimdLevel::Avx512;
+                    }
+                    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+                        return SimdLevel::Avx2;
+                    }
+#endif
+                    return SimdLevel::Scalar;
+                }
+            }
+            
+            SimdLevel getSupportedSimdLevel() {
+                static const SimdLevel level = detail::detectSimdLevel();
+                return level;
+            }
+            
+            std::string toString(SimdLevel level) {
+                switch (level) {
+                    case SimdLevel::Scalar:
+                        return "scalar";
+                    case SimdLevel::Avx2:
+                        return "AVX2";
+                    case SimdLevel::Avx512:
+                        return "AVX-512";
+                }
+                return "invalid";
+            }
+        }
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <string>
+
+// Kernels using instruction set extensions are only compiled on x86-64 with compilers that support function-level target
+// attributes. The extensions are then selected at runtime, depending on the capabilities of the executing CPU.
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__))
+#define STORM_HAVE_X86_SIMD_DISPATCH
+
+// Marks a kernel to be compiled for the respective instruction set extension. Such kernels may only be called after
+// getSupportedSimdLevel() reported the extension to be available.
+#define STORM_SIMD_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define STORM_SIMD_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma")))
+#endif
+
+namespace storm {
+    namespace utility {
+        namespace simd {
+            
+            /*!
+             * The instruction set extensions that can be used by kernels with runtime dispatch (in increasing order).
+             */
+            enum class SimdLevel { Scalar, Avx2, Avx512 };
+            
+            /*!
+             * Retrieves the most powerful instruction set extension that is supported by the executing CPU. The result is
+             * determined once and cached afterwards.
+             */
+            SimdLevel getSupportedSimdLevel();
+            
+            std::string toString(SimdLevel level);
+        }
+    }
+}
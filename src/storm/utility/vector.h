@@ -6,13 +6,13 @@
 #include <functional>
 #include <numeric>
 #include "storm/adapters/RationalFunctionAdapter.h"
-#include "storm/adapters/IntelTbbAdapter.h"
 
 #include <boost/optional.hpp>
 
 #include "storm/storage/BitVector.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/solver/OptimizationDirection.h"
 
 #include "storm/exceptions/NotImplementedException.h"
@@ -337,11 +337,10 @@ namespace storm {
                 }
             }
             
-#ifdef STORM_HAVE_INTELTBB
             template<class InValueType1, class InValueType2, class OutValueType, class Operation>
             void applyPointwiseTernaryParallel(std::vector<InValueType1> const& firstOperand, std::vector<InValueType2> const& secondOperand, std::vector<OutValueType>& target, Operation f = Operation()) {
-                tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, target.size()),
-                                  [&](tbb::blocked_range<uint_fast64_t> const& range) {
+                storm::utility::parallel::parallelFor(0, target.size(), 1,
+                                  [&](auto const& range) {
                                       auto firstIt = firstOperand.begin() + range.begin();
                                       auto firstIte = firstOperand.begin() + range.end();
                                       auto secondIt = secondOperand.begin() + range.begin();
@@ -354,7 +353,6 @@ namespace storm {
                                       }
                                   });
             }
-#endif
             
             /*!
              * Applies the given operation pointwise on the two given vectors and writes the result to the third vector.
@@ -369,15 +367,13 @@ namespace storm {
                 std::transform(firstOperand.begin(), firstOperand.end(), secondOperand.begin(), target.begin(), f);
             }
             
-#ifdef STORM_HAVE_INTELTBB
             template<class InValueType1, class InValueType2, class OutValueType, class Operation>
             void applyPointwiseParallel(std::vector<InValueType1> const& firstOperand, std::vector<InValueType2> const& secondOperand, std::vector<OutValueType>& target, Operation f = Operation()) {
-                tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, target.size()),
-                                  [&](tbb::blocked_range<uint_fast64_t> const& range) {
+                storm::utility::parallel::parallelFor(0, target.size(), 1,
+                                  [&](auto const& range) {
                                       std::transform(firstOperand.begin() + range.begin(), firstOperand.begin() + range.end(), secondOperand.begin() + range.begin(), target.begin() + range.begin(), f);
                                   });
             }
-#endif
 
             
             /*!
@@ -392,15 +388,13 @@ namespace storm {
                 std::transform(operand.begin(), operand.end(), target.begin(), f);
             }
             
-#ifdef STORM_HAVE_INTELTBB
             template<class InValueType, class OutValueType, class Operation>
             void applyPointwiseParallel(std::vector<InValueType> const& operand, std::vector<OutValueType>& target, Operation f = Operation()) {
-                tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, target.size()),
-                                  [&](tbb::blocked_range<uint_fast64_t> const& range) {
+                storm::utility::parallel::parallelFor(0, target.size(), 1,
+                                  [&](auto const& range) {
                                       std::transform(operand.begin() + range.begin(), operand.begin() + range.end(), target.begin() + range.begin(), f);
                                   });
             }
-#endif
             
             /*!
              * Adds the two given vectors and writes the result to the target vector.
@@ -615,15 +609,15 @@ namespace storm {
                 return current;
             }
 
-#ifdef STORM_HAVE_INTELTBB
             template<class T, class Filter>
-            class TbbReduceVectorFunctor {
+            class ParallelReduceVectorFunctor {
             public:
-                TbbReduceVectorFunctor(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices, Filter const& f) : source(source), target(target), rowGrouping(rowGrouping), choices(choices), f(f) {
+                ParallelReduceVectorFunctor(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices, Filter const& f) : source(source), target(target), rowGrouping(rowGrouping), choices(choices), f(f) {
                     // Intentionally left empty.
                 }
                 
-                void operator()(tbb::blocked_range<uint64_t> const& range) const {
+                template<typename Range>
+                void operator()(Range const& range) const {
                     uint_fast64_t startRow = range.begin();
                     uint_fast64_t endRow = range.end();
                     
@@ -641,7 +635,7 @@ namespace storm {
                     T oldSelectedChoiceValue;
                     uint64_t selectedChoice;
 
-                    uint64_t currentRow = 0;
+                    uint64_t currentRow = *rowGroupingIt;
                     for (; targetIt != targetIte; ++targetIt, ++rowGroupingIt, ++choiceIt) {
                         // Only traverse elements if the row group is non-empty.
                         if (*rowGroupingIt != *(rowGroupingIt + 1)) {
@@ -684,7 +678,6 @@ namespace storm {
                 std::vector<uint_fast64_t>* choices;
                 Filter const& f;
             };
-#endif
             
             /*!
              * Reduces the given source vector by selecting an element according to the given filter out of each row group.
@@ -752,12 +745,10 @@ namespace storm {
                 }
             }
             
-#ifdef STORM_HAVE_INTELTBB
             template<class T, class Filter>
             void reduceVectorParallel(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices) {
-                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, target.size()), TbbReduceVectorFunctor<T, Filter>(source, target, rowGrouping, choices, Filter()));
+                storm::utility::parallel::parallelFor(0, target.size(), 1, ParallelReduceVectorFunctor<T, Filter>(source, target, rowGrouping, choices, Filter()));
             }
-#endif
                         
             /*!
              * Reduces the given source vector by selecting the smallest element out of each row group.
@@ -772,12 +763,10 @@ namespace storm {
                 reduceVector<T, storm::utility::ElementLess<T>>(source, target, rowGrouping, choices);
             }
             
-#ifdef STORM_HAVE_INTELTBB
             template<class T>
             void reduceVectorMinParallel(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices = nullptr) {
-                reduceVector<T, storm::utility::ElementLess<T>>(source, target, rowGrouping, choices);
+                reduceVectorParallel<T, storm::utility::ElementLess<T>>(source, target, rowGrouping, choices);
             }
-#endif
             
             /*!
              * Reduces the given source vector by selecting the largest element out of each row group.
@@ -792,12 +781,10 @@ namespace storm {
                 reduceVector<T, storm::utility::ElementGreater<T>>(source, target, rowGrouping, choices);
             }
             
-#ifdef STORM_HAVE_INTELTBB
             template<class T>
             void reduceVectorMaxParallel(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices = nullptr) {
-                reduceVector<T, storm::utility::ElementGreater<T>>(source, target, rowGrouping, choices);
+                reduceVectorParallel<T, storm::utility::ElementGreater<T>>(source, target, rowGrouping, choices);
             }
-#endif
             
             /*!
              * Reduces the given source vector by selecting either the smallest or the largest out of each row group.
@@ -817,7 +804,6 @@ namespace storm {
                 }
             }
             
-#ifdef STORM_HAVE_INTELTBB
             template<class T>
             void reduceVectorMinOrMaxParallel(storm::solver::OptimizationDirection dir, std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices = nullptr) {
                 if(dir == storm::solver::OptimizationDirection::Minimize) {
@@ -826,7 +812,6 @@ namespace storm {
                     reduceVectorMaxParallel(source, target, rowGrouping, choices);
                 }
             }
-#endif
             
             /*!
              * Compares the given elements and determines whether they are equal modulo the given precision. The provided flag
@@ -8,6 +8,11 @@
 #include "storm/storage/jani/Model.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/JitBuilderSettings.h"
+
+#include <map>
+
+#include <boost/filesystem.hpp>
 
 TEST(ExplicitJitJaniModelBuilderTest, Dtmc) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
@@ -148,3 +153,46 @@ TEST(ExplicitJitJaniModelBuilderTest, FailComposition) {
     
     STORM_SILENT_ASSERT_THROW(storm::builder::jit::ExplicitJitJaniModelBuilder<double>(janiModel).build();, storm::exceptions::WrongFormatException);
 }
+
+TEST(ExplicitJitJaniModelBuilderTest, Cache) {
+    boost::filesystem::path cacheDirectory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-jit-cache-%%%%-%%%%-%%%%");
+    storm::settings::mutableManager().setFromString("--" + storm::settings::modules::JitBuilderSettings::moduleName + ":cache " + cacheDirectory.string());
+    storm::settings::SettingMemento cacheMemento(storm::settings::mutableManager().getModule(storm::settings::modules::JitBuilderSettings::moduleName), "cache", false);
+    
+    auto buildModel = [] (std::string const& probability) {
+        std::string input = "dtmc\nconst double p = " + probability + ";\nmodule m\n  s : [0..2] init 0;\n  [] s=0 -> p : (s'=1) + (1-p) : (s'=2);\n  [] s>0 -> 1 : (s'=s);\nendmodule\n";
+        storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "cache.pm");
+        // The constants are not substituted beforehand, such that the builder can keep them as runtime constants.
+        return storm::builder::jit::ExplicitJitJaniModelBuilder<double>(program.toJani()).build();
+    };
+    auto getCachedLibraries = [&cacheDirectory] () {
+        std::map<boost::filesystem::path, std::time_t> result;
+        for (auto const& entry : boost::filesystem::directory_iterator(cacheDirectory)) {
+            if (entry.path().extension() != ".cpp") {
+                result.emplace(entry.path(), boost::filesystem::last_write_time(entry.path()));
+            }
+        }
+        return result;
+    };
+    
+    std::shared_ptr<storm::models::sparse::Model<double>> model = buildModel("0.3");
+    EXPECT_EQ(3ul, model->getNumberOfStates());
+    EXPECT_EQ(0.3, model->getTransitionMatrix().getRow(0).begin()->getValue());
+    auto cachedLibraries = getCachedLibraries();
+    EXPECT_EQ(1ul, cachedLibraries.size());
+    
+    // Building the same model again has to reuse the cached library.
+    model = buildModel("0.3");
+    EXPECT_EQ(3ul, model->getNumberOfStates());
+    EXPECT_EQ(0.3, model->getTransitionMatrix().getRow(0).begin()->getValue());
+    EXPECT_EQ(cachedLibraries, getCachedLibraries());
+    
+    // Different values of the constant yield a different model, but still reuse the library.
+    model = buildModel("0.6");
+    EXPECT_EQ(3ul, model->getNumberOfStates());
+    EXPECT_EQ(0.6, model->getTransitionMatrix().getRow(0).begin()->getValue());
+    EXPECT_EQ(0.4, (model->getTransitionMatrix().getRow(0).begin() + 1)->getValue());
+    EXPECT_EQ(cachedLibraries, getCachedLibraries());
+    
+    boost::filesystem::remove_all(cacheDirectory);
+}
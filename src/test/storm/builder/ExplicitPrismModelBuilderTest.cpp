@@ -125,3 +125,73 @@ TEST(ExplicitPrismModelBuilderTest, FailComposition) {
 
     STORM_SILENT_ASSERT_THROW(storm::builder::ExplicitModelBuilder<double>(program).build(), storm::exceptions::WrongFormatException);
 }
+
+TEST(ExplicitPrismModelBuilderTest, ParallelExploration) {
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions;
+    parallelOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    parallelOptions.parallelExploration = true;
+    storm::builder::ExplicitModelBuilder<double>::Options sequentialOptions = parallelOptions;
+    sequentialOptions.parallelExploration = false;
+
+    for (std::string const& file : {STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", STORM_TEST_RESOURCES_DIR "/mdp/firewire3-0.5.nm", STORM_TEST_RESOURCES_DIR "/ma/stream2.ma"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(file);
+        storm::generator::NextStateGeneratorOptions generatorOptions;
+        generatorOptions.setBuildAllLabels().setBuildAllRewardModels();
+
+        std::shared_ptr<storm::models::sparse::Model<double>> sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, sequentialOptions).build();
+        std::shared_ptr<storm::models::sparse::Model<double>> parallelModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, parallelOptions).build();
+
+        // The parallel exploration has to yield exactly the same state numbering as the sequential one.
+        EXPECT_EQ(sequentialModel->getType(), parallelModel->getType());
+        EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix()) << file;
+        EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling()) << file;
+        ASSERT_EQ(sequentialModel->getNumberOfRewardModels(), parallelModel->getNumberOfRewardModels());
+        for (auto const& rewardModel : sequentialModel->getRewardModels()) {
+            ASSERT_TRUE(parallelModel->hasRewardModel(rewardModel.first));
+            EXPECT_EQ(rewardModel.second.hasStateRewards(), parallelModel->getRewardModel(rewardModel.first).hasStateRewards());
+            if (rewardModel.second.hasStateRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateRewardVector(), parallelModel->getRewardModel(rewardModel.first).getStateRewardVector());
+            }
+            if (rewardModel.second.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), parallelModel->getRewardModel(rewardModel.first).getStateActionRewardVector());
+            }
+        }
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, MemoryBudget) {
+    storm::builder::ExplicitModelBuilder<double>::Options referenceOptions;
+    referenceOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    referenceOptions.parallelExploration = false;
+
+    // The budget is chosen small enough to move states to temporary files several times.
+    storm::builder::ExplicitModelBuilder<double>::Options budgetOptions = referenceOptions;
+    budgetOptions.memoryBudget = 64 * 1024;
+    storm::builder::ExplicitModelBuilder<double>::Options parallelBudgetOptions = budgetOptions;
+    parallelBudgetOptions.parallelExploration = true;
+
+    for (std::string const& file : {STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", STORM_TEST_RESOURCES_DIR "/mdp/firewire3-0.5.nm", STORM_TEST_RESOURCES_DIR "/ma/stream2.ma"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(file);
+        storm::generator::NextStateGeneratorOptions generatorOptions;
+        generatorOptions.setBuildAllLabels().setBuildAllRewardModels();
+
+        std::shared_ptr<storm::models::sparse::Model<double>> referenceModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, referenceOptions).build();
+        for (auto const& options : {budgetOptions, parallelBudgetOptions}) {
+            std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, options).build();
+
+            EXPECT_EQ(referenceModel->getType(), model->getType());
+            EXPECT_TRUE(referenceModel->getTransitionMatrix() == model->getTransitionMatrix()) << file;
+            EXPECT_TRUE(referenceModel->getStateLabeling() == model->getStateLabeling()) << file;
+            ASSERT_EQ(referenceModel->getNumberOfRewardModels(), model->getNumberOfRewardModels());
+            for (auto const& rewardModel : referenceModel->getRewardModels()) {
+                ASSERT_TRUE(model->hasRewardModel(rewardModel.first));
+                if (rewardModel.second.hasStateRewards()) {
+                    EXPECT_EQ(rewardModel.second.getStateRewardVector(), model->getRewardModel(rewardModel.first).getStateRewardVector());
+                }
+                if (rewardModel.second.hasStateActionRewards()) {
+                    EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), model->getRewardModel(rewardModel.first).getStateActionRewardVector());
+                }
+            }
+        }
+    }
+}
@@ -7,6 +7,8 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpSolverSession.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
@@ -197,3 +199,79 @@ TEST(ExplicitMdpPrctlModelCheckerTest, AsynchronousLeader) {
     EXPECT_NEAR(30.0/7.0, quantitativeResult6[0], precision);
 }
 
+
+TEST(ExplicitMdpPrctlModelCheckerTest, SolverSession) {
+    storm::Environment env;
+    double const precision = 1e-6;
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/leader4.tra", STORM_TEST_RESOURCES_DIR "/lab/leader4.lab", "", STORM_TEST_RESOURCES_DIR "/rew/leader4.trans.rew");
+    ASSERT_EQ(storm::models::ModelType::Mdp, abstractModel->getType());
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    storm::parser::FormulaParser formulaParser;
+
+    // All queries share one session.
+    auto session = std::make_shared<storm::modelchecker::helper::SparseMdpSolverSession<double>>();
+    auto hint = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<double>>();
+    hint->setSolverSession(session);
+
+    std::vector<std::string> formulas = {"Rmax=? [F \"elected\"]", "Rmin=? [F \"elected\"]", "Rmax=? [F \"elected\"]", "Pmin=? [F<=25 \"elected\"]"};
+    for (auto const& formulaString : formulas) {
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaString);
+
+        std::unique_ptr<storm::modelchecker::CheckResult> expectedResult = checker.check(env, *formula);
+
+        storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula);
+        task.setHint(hint);
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, task);
+
+        auto const& expectedValues = expectedResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        auto const& values = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        ASSERT_EQ(expectedValues.size(), values.size());
+        for (uint64_t state = 0; state < values.size(); ++state) {
+            EXPECT_NEAR(expectedValues[state], values[state], precision) << "for formula " << formulaString << " in state " << state;
+        }
+    }
+
+    // The second maximal reward query has to find the equation system of the first one.
+    EXPECT_LE(1ull, session->getNumberOfReusedEquationSystems());
+}
+
+TEST(ExplicitMdpPrctlModelCheckerTest, SolverSessionDistinguishesMatrices) {
+    storm::storage::SparseMatrixBuilder<double> firstBuilder(0, 0, 0, false, true);
+    firstBuilder.newRowGroup(0);
+    firstBuilder.addNextValue(0, 1, 0.5);
+    firstBuilder.addNextValue(1, 0, 0.25);
+    firstBuilder.newRowGroup(2);
+    firstBuilder.addNextValue(2, 0, 0.5);
+    storm::storage::SparseMatrix<double> first = firstBuilder.build();
+
+    // Same structure, different values.
+    storm::storage::SparseMatrixBuilder<double> secondBuilder(0, 0, 0, false, true);
+    secondBuilder.newRowGroup(0);
+    secondBuilder.addNextValue(0, 1, 0.5);
+    secondBuilder.addNextValue(1, 0, 0.75);
+    secondBuilder.newRowGroup(2);
+    secondBuilder.addNextValue(2, 0, 0.5);
+    storm::storage::SparseMatrix<double> second = secondBuilder.build();
+
+    storm::modelchecker::helper::SparseMdpSolverSession<double> session;
+    auto& firstData = session.getEquationSystemData(first, storm::solver::MinMaxMethod::ValueIteration);
+    firstData.values = std::vector<double>({0.1, 0.2});
+    auto& secondData = session.getEquationSystemData(second, storm::solver::MinMaxMethod::ValueIteration);
+    EXPECT_FALSE(static_cast<bool>(secondData.values));
+    EXPECT_EQ(0ull, session.getNumberOfReusedEquationSystems());
+
+    // A copy of the first matrix has to find the data of the first system.
+    storm::storage::SparseMatrix<double> firstCopy = first;
+    auto& reusedData = session.getEquationSystemData(firstCopy, storm::solver::MinMaxMethod::ValueIteration);
+    ASSERT_TRUE(static_cast<bool>(reusedData.values));
+    EXPECT_EQ(0.2, reusedData.values.get()[1]);
+    EXPECT_EQ(1ull, session.getNumberOfReusedEquationSystems());
+
+    // Another method is a different system.
+    session.getEquationSystemData(first, storm::solver::MinMaxMethod::PolicyIteration);
+    EXPECT_EQ(1ull, session.getNumberOfReusedEquationSystems());
+}
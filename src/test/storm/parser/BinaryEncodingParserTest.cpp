@@ -0,0 +1,78 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "storm-parsers/parser/BinaryEncodingParser.h"
+#include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/io/BinaryEncodingExporter.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+TEST(BinaryEncodingParserTest, MdpRoundTrip) {
+    std::shared_ptr<storm::models::sparse::Model<double>> original = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    std::string filename = ::testing::TempDir() + "two_dice.bin";
+    {
+        std::ofstream stream(filename, std::ios::out | std::ios::binary);
+        storm::exporter::binaryExportSparseModel(stream, original);
+    }
+    std::shared_ptr<storm::models::sparse::Model<double>> modelPtr = storm::parser::BinaryEncodingParser::parseModel(filename);
+    std::remove(filename.c_str());
+
+    ASSERT_EQ(storm::models::ModelType::Mdp, modelPtr->getType());
+    ASSERT_EQ(169ul, modelPtr->getNumberOfStates());
+    ASSERT_EQ(436ul, modelPtr->getNumberOfTransitions());
+    ASSERT_EQ(254ul, modelPtr->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
+    EXPECT_TRUE(original->getTransitionMatrix() == modelPtr->getTransitionMatrix());
+    EXPECT_TRUE(original->getStateLabeling() == modelPtr->getStateLabeling());
+    ASSERT_EQ(1ul, modelPtr->getNumberOfRewardModels());
+    ASSERT_TRUE(modelPtr->hasRewardModel("coinflips"));
+    EXPECT_EQ(original->getRewardModel("coinflips").getStateActionRewardVector(), modelPtr->getRewardModel("coinflips").getStateActionRewardVector());
+}
+
+TEST(BinaryEncodingParserTest, CtmcRoundTrip) {
+    std::shared_ptr<storm::models::sparse::Model<double>> original = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn");
+    std::string filename = ::testing::TempDir() + "cluster2.bin";
+    {
+        std::ofstream stream(filename, std::ios::out | std::ios::binary);
+        storm::exporter::binaryExportSparseModel(stream, original);
+    }
+    std::shared_ptr<storm::models::sparse::Model<double>> modelPtr = storm::parser::BinaryEncodingParser::parseModel(filename);
+    std::remove(filename.c_str());
+
+    ASSERT_EQ(storm::models::ModelType::Ctmc, modelPtr->getType());
+    ASSERT_EQ(276ul, modelPtr->getNumberOfStates());
+    ASSERT_EQ(1120ul, modelPtr->getNumberOfTransitions());
+    EXPECT_TRUE(original->getTransitionMatrix() == modelPtr->getTransitionMatrix());
+    EXPECT_EQ(original->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector(), modelPtr->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+    EXPECT_TRUE(original->getStateLabeling() == modelPtr->getStateLabeling());
+    EXPECT_EQ(64ul, modelPtr->getStates("premium").getNumberOfSetBits());
+    ASSERT_TRUE(modelPtr->hasRewardModel("num_repairs"));
+    EXPECT_EQ(original->getRewardModel("num_repairs").getStateActionRewardVector(), modelPtr->getRewardModel("num_repairs").getStateActionRewardVector());
+}
+
+TEST(BinaryEncodingParserTest, WrongFormat) {
+    STORM_SILENT_ASSERT_THROW(storm::parser::BinaryEncodingParser::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn"), storm::exceptions::WrongFormatException);
+}
+
+TEST(BinaryEncodingParserTest, TruncatedFile) {
+    std::shared_ptr<storm::models::sparse::Model<double>> original = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    std::stringstream exported(std::ios::in | std::ios::out | std::ios::binary);
+    storm::exporter::binaryExportSparseModel(exported, original);
+    std::string content = exported.str();
+
+    // Cut the file within the header, within the transition matrix and right before the end.
+    std::string filename = ::testing::TempDir() + "two_dice_truncated.bin";
+    for (uint64_t size : {sizeof(storm::exporter::BinaryEncodingHeader) / 2, sizeof(storm::exporter::BinaryEncodingHeader) + 8, content.size() / 2, content.size() - 1}) {
+        {
+            std::ofstream stream(filename, std::ios::out | std::ios::binary);
+            stream.write(content.data(), size);
+        }
+        STORM_SILENT_EXPECT_THROW(storm::parser::BinaryEncodingParser::parseModel(filename), storm::exceptions::WrongFormatException);
+    }
+    std::remove(filename.c_str());
+}
@@ -50,6 +50,33 @@ namespace {
         }
     };
 
+    class DoubleMixedPrecisionViEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setMixedPrecision(true);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            return env;
+        }
+    };
+    
+    class DoubleMixedPrecisionIntervalIterationEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::IntervalIteration);
+            env.solver().minMax().setMixedPrecision(true);
+            env.solver().setForceSoundness(true);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+            return env;
+        }
+    };
+
     class DoubleOptimisticViEnvironment {
     public:
         typedef double ValueType;
@@ -138,6 +165,8 @@ namespace {
             DoubleViEnvironment,
             DoubleSoundViEnvironment,
             DoubleIntervalIterationEnvironment,
+            DoubleMixedPrecisionViEnvironment,
+            DoubleMixedPrecisionIntervalIterationEnvironment,
             DoubleOptimisticViEnvironment,
             DoubleTopologicalViEnvironment,
             DoubleTopologicalCudaViEnvironment,
@@ -175,6 +204,116 @@ namespace {
         ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
         EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
     }
+    
+    TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquationsBlock) {
+        typedef typename TestFixture::ValueType ValueType;
+        
+        storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.3")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.4")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("0.8")));
+        ASSERT_NO_THROW(builder.newRowGroup(2));
+        ASSERT_NO_THROW(builder.addNextValue(2, 0, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.newRowGroup(3));
+        ASSERT_NO_THROW(builder.addNextValue(3, 1, this->parseNumber("0.2")));
+        ASSERT_NO_THROW(builder.addNextValue(3, 2, this->parseNumber("0.3")));
+        ASSERT_NO_THROW(builder.addNextValue(4, 0, this->parseNumber("0.6")));
+        
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build());
+        
+        // Three right-hand sides, stored as a row-major block.
+        uint64_t const numberOfVectors = 3;
+        std::vector<ValueType> b = {this->parseNumber("0.1"), this->parseNumber("0.5"), this->parseNumber("0"),
+                                    this->parseNumber("0.2"), this->parseNumber("0"), this->parseNumber("1"),
+                                    this->parseNumber("0.3"), this->parseNumber("0.5"), this->parseNumber("0.2"),
+                                    this->parseNumber("0"), this->parseNumber("0.1"), this->parseNumber("0.4"),
+                                    this->parseNumber("0.4"), this->parseNumber("0.3"), this->parseNumber("0.1")};
+        
+        auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType>();
+        auto solver = factory.create(this->env(), A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(this->parseNumber("0"), this->parseNumber("10"));
+        solver->setRequirementsChecked();
+        
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            std::vector<ValueType> x(A.getRowGroupCount() * numberOfVectors);
+            ASSERT_NO_THROW(solver->solveEquationsBlock(this->env(), dir, x, b, numberOfVectors));
+            
+            for (uint64_t vector = 0; vector < numberOfVectors; ++vector) {
+                std::vector<ValueType> singleB(A.getRowCount());
+                for (uint64_t row = 0; row < A.getRowCount(); ++row) {
+                    singleB[row] = b[row * numberOfVectors + vector];
+                }
+                std::vector<ValueType> singleX(A.getRowGroupCount());
+                ASSERT_NO_THROW(solver->solveEquations(this->env(), dir, singleX, singleB));
+                for (uint64_t rowGroup = 0; rowGroup < A.getRowGroupCount(); ++rowGroup) {
+                    EXPECT_NEAR(singleX[rowGroup], x[rowGroup * numberOfVectors + vector], this->precision());
+                }
+            }
+        }
+    }
+    
+    TEST(MinMaxLinearEquationSolverTest, MixedPrecisionMatchesDoublePrecision) {
+        // A slowly converging random walk, so that the bulk of the iterations is done in single precision.
+        uint64_t const numberOfStates = 50;
+        storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+        uint64_t row = 0;
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            builder.newRowGroup(row);
+            if (state > 0) {
+                builder.addNextValue(row, state - 1, 0.5);
+            }
+            if (state + 1 < numberOfStates) {
+                builder.addNextValue(row, state + 1, 0.49);
+            }
+            ++row;
+            builder.addNextValue(row, state, 0.98);
+            ++row;
+        }
+        storm::storage::SparseMatrix<double> A = builder.build(row, numberOfStates, numberOfStates);
+        std::vector<double> b(A.getRowCount());
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            b[2 * state] = state + 1 < numberOfStates ? 0.01 : 0.5;
+            b[2 * state + 1] = 0.01 * static_cast<double>(state) / numberOfStates;
+        }
+        
+        EXPECT_EQ(0.5f, (storm::utility::convertNumber<float, double>(0.5)));
+        EXPECT_EQ(0.5, (storm::utility::convertNumber<double, float>(0.5f)));
+        
+        for (auto method : {storm::solver::MinMaxMethod::ValueIteration, storm::solver::MinMaxMethod::IntervalIteration}) {
+            for (auto style : {storm::solver::MultiplicationStyle::Regular, storm::solver::MultiplicationStyle::GaussSeidel}) {
+                storm::Environment env;
+                env.solver().minMax().setMethod(method);
+                env.solver().minMax().setMultiplicationStyle(style);
+                env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-9));
+                if (method == storm::solver::MinMaxMethod::IntervalIteration) {
+                    env.solver().setForceSoundness(true);
+                }
+                storm::Environment mixedEnv = env;
+                mixedEnv.solver().minMax().setMixedPrecision(true);
+                
+                auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>();
+                for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+                    std::vector<double> x(numberOfStates);
+                    std::vector<double> mixedX(numberOfStates);
+                    for (auto const* currentEnv : {&env, &mixedEnv}) {
+                        auto solver = factory.create(*currentEnv, A);
+                        solver->setHasUniqueSolution(true);
+                        solver->setHasNoEndComponents(true);
+                        solver->setBounds(0.0, 1.0);
+                        solver->setRequirementsChecked();
+                        ASSERT_NO_THROW(solver->solveEquations(*currentEnv, dir, currentEnv == &env ? x : mixedX, b));
+                    }
+                    for (uint64_t state = 0; state < numberOfStates; ++state) {
+                        EXPECT_NEAR(x[state], mixedX[state], 1e-7);
+                    }
+                }
+            }
+        }
+    }
 }
 
 
@@ -4,7 +4,11 @@
 
 #include "storm/storage/SparseMatrix.h"
 #include "storm/solver/Multiplier.h"
+#include "storm/solver/helper/ParallelGaussSeidelHelper.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/utility/vector.h"
 namespace {
@@ -20,6 +24,41 @@ namespace {
         }
     };
     
+    class NativeSoaEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+            env.solver().multiplier().setStructureOfArrays(true);
+            return env;
+        }
+    };
+    
+    class NativeCompressedEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+            env.solver().multiplier().setCompressedMatrix(true);
+            return env;
+        }
+    };
+    
+    class SimdEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().multiplier().setType(storm::solver::MultiplierType::Simd);
+            return env;
+        }
+    };
+    
     class GmmxxEnvironment {
     public:
         typedef double ValueType;
@@ -45,6 +84,9 @@ namespace {
   
     typedef ::testing::Types<
             NativeEnvironment,
+            NativeSoaEnvironment,
+            NativeCompressedEnvironment,
+            SimdEnvironment,
             GmmxxEnvironment
     > TestingTypes;
     
@@ -120,4 +162,248 @@ namespace {
         EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
     }
     
+    TYPED_TEST(MultiplierTest, emptyRowGroupTest) {
+        typedef typename TestFixture::ValueType ValueType;
+    
+        // The first and the third row group are empty.
+        storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 3, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 3, this->parseNumber("1")));
+        ASSERT_NO_THROW(builder.newRowGroup(2));
+        ASSERT_NO_THROW(builder.newRowGroup(2));
+        ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("1")));
+        
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build(3, 4, 4));
+        ASSERT_EQ(4ul, A.getRowGroupCount());
+        
+        std::vector<ValueType> b = {this->parseNumber("0.1"), this->parseNumber("0.2"), this->parseNumber("0.3")};
+        std::vector<ValueType> initialX = {this->parseNumber("1"), this->parseNumber("1"), this->parseNumber("1"), this->parseNumber("1")};
+        
+        auto factory = storm::solver::MultiplierFactory<ValueType>();
+        auto multiplier = factory.create(this->env(), A);
+        
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            // Empty row groups are skipped, i.e. the result keeps its previous content there.
+            std::vector<ValueType> result(4, this->parseNumber("42"));
+            ASSERT_NO_THROW(multiplier->multiplyAndReduce(this->env(), dir, A.getRowGroupIndices(), initialX, &b, result));
+            EXPECT_NEAR(result[0], this->parseNumber("42"), this->precision());
+            EXPECT_NEAR(result[1], dir == storm::OptimizationDirection::Minimize ? this->parseNumber("1.1") : this->parseNumber("1.2"), this->precision());
+            EXPECT_NEAR(result[2], this->parseNumber("42"), this->precision());
+            EXPECT_NEAR(result[3], this->parseNumber("1.3"), this->precision());
+            
+            for (bool backwards : {false, true}) {
+                std::vector<ValueType> x = initialX;
+                ASSERT_NO_THROW(multiplier->multiplyAndReduceGaussSeidel(this->env(), dir, A.getRowGroupIndices(), x, &b, nullptr, backwards));
+                EXPECT_NEAR(x[0], this->parseNumber("1"), this->precision());
+                EXPECT_NEAR(x[2], this->parseNumber("1"), this->precision());
+            }
+        }
+    }
+    
+    TYPED_TEST(MultiplierTest, multiplyAndReduceBlockTest) {
+        typedef typename TestFixture::ValueType ValueType;
+    
+        // The first and the third row group are empty.
+        storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 3, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 3, this->parseNumber("1")));
+        ASSERT_NO_THROW(builder.newRowGroup(2));
+        ASSERT_NO_THROW(builder.newRowGroup(2));
+        ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("1")));
+        
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build(3, 4, 4));
+        
+        // Two vectors and right-hand sides, stored as row-major blocks.
+        uint64_t const numberOfVectors = 2;
+        std::vector<std::vector<ValueType>> b = {{this->parseNumber("0.1"), this->parseNumber("0.2"), this->parseNumber("0.3")}, {this->parseNumber("0.3"), this->parseNumber("0"), this->parseNumber("0.6")}};
+        std::vector<std::vector<ValueType>> x = {{this->parseNumber("1"), this->parseNumber("0.5"), this->parseNumber("1"), this->parseNumber("0.25")}, {this->parseNumber("0"), this->parseNumber("1"), this->parseNumber("0.5"), this->parseNumber("1")}};
+        std::vector<ValueType> bBlock(A.getRowCount() * numberOfVectors);
+        std::vector<ValueType> xBlock(A.getColumnCount() * numberOfVectors);
+        for (uint64_t vector = 0; vector < numberOfVectors; ++vector) {
+            for (uint64_t row = 0; row < A.getRowCount(); ++row) {
+                bBlock[row * numberOfVectors + vector] = b[vector][row];
+            }
+            for (uint64_t column = 0; column < A.getColumnCount(); ++column) {
+                xBlock[column * numberOfVectors + vector] = x[vector][column];
+            }
+        }
+        
+        auto factory = storm::solver::MultiplierFactory<ValueType>();
+        auto multiplier = factory.create(this->env(), A);
+        
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            // The block multiplication has to coincide with separate multiplications (that skip empty row groups).
+            std::vector<ValueType> resultBlock(A.getRowGroupCount() * numberOfVectors, this->parseNumber("42"));
+            ASSERT_NO_THROW(multiplier->multiplyAndReduceBlock(this->env(), dir, xBlock, &bBlock, resultBlock, numberOfVectors));
+            for (uint64_t vector = 0; vector < numberOfVectors; ++vector) {
+                std::vector<ValueType> expected(A.getRowGroupCount(), this->parseNumber("42"));
+                ASSERT_NO_THROW(multiplier->multiplyAndReduce(this->env(), dir, x[vector], &b[vector], expected));
+                for (uint64_t group = 0; group < A.getRowGroupCount(); ++group) {
+                    EXPECT_NEAR(expected[group], resultBlock[group * numberOfVectors + vector], this->precision()) << "in group " << group;
+                }
+            }
+        }
+    }
+    
+    TYPED_TEST(MultiplierTest, multiplyAndReduce2Test) {
+        typedef typename TestFixture::ValueType ValueType;
+    
+        storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.9")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.099")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("0.001")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.newRowGroup(2));
+        ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("1")));
+        ASSERT_NO_THROW(builder.newRowGroup(3));
+        ASSERT_NO_THROW(builder.addNextValue(3, 2, this->parseNumber("1")));
+        
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build());
+        
+        std::vector<ValueType> b = {this->parseNumber("0.1"), this->parseNumber("0"), this->parseNumber("0.2"), this->parseNumber("0")};
+        std::vector<ValueType> lower = {this->parseNumber("0"), this->parseNumber("0"), this->parseNumber("0")};
+        std::vector<ValueType> upper = {this->parseNumber("1"), this->parseNumber("1"), this->parseNumber("1")};
+        
+        auto factory = storm::solver::MultiplierFactory<ValueType>();
+        auto multiplier = factory.create(this->env(), A);
+        
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            // The fused multiplication has to coincide with two separate multiplications.
+            std::vector<ValueType> expectedLower(3), expectedUpper(3), resultLower(3), resultUpper(3);
+            ASSERT_NO_THROW(multiplier->multiplyAndReduce(this->env(), dir, lower, &b, expectedLower));
+            ASSERT_NO_THROW(multiplier->multiplyAndReduce(this->env(), dir, upper, &b, expectedUpper));
+            ASSERT_NO_THROW(multiplier->multiplyAndReduce2(this->env(), dir, lower, resultLower, upper, resultUpper, &b));
+            for (uint64_t state = 0; state < 3; ++state) {
+                EXPECT_NEAR(expectedLower[state], resultLower[state], this->precision());
+                EXPECT_NEAR(expectedUpper[state], resultUpper[state], this->precision());
+            }
+            
+            expectedLower = lower;
+            expectedUpper = upper;
+            resultLower = lower;
+            resultUpper = upper;
+            ASSERT_NO_THROW(multiplier->multiplyAndReduceGaussSeidel(this->env(), dir, expectedLower, &b));
+            ASSERT_NO_THROW(multiplier->multiplyAndReduceGaussSeidel(this->env(), dir, expectedUpper, &b));
+            ASSERT_NO_THROW(multiplier->multiplyAndReduceGaussSeidel2(this->env(), dir, resultLower, resultUpper, &b));
+            for (uint64_t state = 0; state < 3; ++state) {
+                EXPECT_NEAR(expectedLower[state], resultLower[state], this->precision());
+                EXPECT_NEAR(expectedUpper[state], resultUpper[state], this->precision());
+            }
+        }
+    }
+    
+    TYPED_TEST(MultiplierTest, parallelMultiplyAndReduce2Test) {
+        typedef typename TestFixture::ValueType ValueType;
+        
+        // Use enough row groups to split them into several chunks (of varying sizes and with a few empty groups).
+        uint64_t const numberOfGroups = 5000;
+        storm::storage::SparseMatrixBuilder<ValueType> builder(0, numberOfGroups, 0, false, true);
+        uint64_t row = 0;
+        for (uint64_t group = 0; group < numberOfGroups; ++group) {
+            builder.newRowGroup(row);
+            if (group % 97 == 13) {
+                continue;
+            }
+            for (uint64_t choice = 0; choice < 1 + group % 3; ++choice, ++row) {
+                builder.addNextValue(row, (group * 7 + choice) % numberOfGroups, this->parseNumber("1/4"));
+                builder.addNextValue(row, (group * 13 + 5 * choice + 1) % numberOfGroups, this->parseNumber("3/4"));
+            }
+        }
+        storm::storage::SparseMatrix<ValueType> A = builder.build(row, numberOfGroups, numberOfGroups);
+        
+        std::vector<ValueType> b(A.getRowCount());
+        for (uint64_t index = 0; index < b.size(); ++index) {
+            b[index] = this->parseNumber(std::to_string(index % 10) + "/10");
+        }
+        std::vector<ValueType> x1(numberOfGroups);
+        std::vector<ValueType> x2(numberOfGroups);
+        for (uint64_t index = 0; index < numberOfGroups; ++index) {
+            x1[index] = this->parseNumber(std::to_string(index % 17) + "/17");
+            x2[index] = this->parseNumber(std::to_string(index % 5) + "/5");
+        }
+        
+        // The parallel path is only taken if more than one thread is available.
+        storm::settings::mutableManager().setFromString("--" + storm::settings::modules::CoreSettings::moduleName + ":threads 4");
+        storm::settings::SettingMemento threadsMemento(storm::settings::mutableManager().getModule(storm::settings::modules::CoreSettings::moduleName), "threads", false);
+        storm::Environment sequentialEnv = this->env();
+        sequentialEnv.solver().multiplier().setParallel(false);
+        storm::Environment parallelEnv = this->env();
+        parallelEnv.solver().multiplier().setParallel(true);
+        
+        auto factory = storm::solver::MultiplierFactory<ValueType>();
+        auto multiplier = factory.create(sequentialEnv, A);
+        
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            // Empty row groups are skipped, so they keep the initial value.
+            ValueType initialValue = this->parseNumber("42");
+            std::vector<ValueType> expected1(numberOfGroups, initialValue), expected2(numberOfGroups, initialValue), result1(numberOfGroups, initialValue), result2(numberOfGroups, initialValue);
+            ASSERT_NO_THROW(multiplier->multiplyAndReduce2(sequentialEnv, dir, x1, expected1, x2, expected2, &b));
+            ASSERT_NO_THROW(multiplier->multiplyAndReduce2(parallelEnv, dir, x1, result1, x2, result2, &b));
+            for (uint64_t group = 0; group < numberOfGroups; ++group) {
+                EXPECT_EQ(expected1[group], result1[group]) << "in group " << group;
+                EXPECT_EQ(expected2[group], result2[group]) << "in group " << group;
+                if (group % 97 == 13) {
+                    EXPECT_EQ(initialValue, result1[group]) << "in empty group " << group;
+                    EXPECT_EQ(initialValue, result2[group]) << "in empty group " << group;
+                }
+            }
+        }
+    }
+    
+    TEST(ParallelGaussSeidelHelperTest, multiplyAndReduceGaussSeidelTest) {
+        storm::storage::SparseMatrixBuilder<double> builder(6, 5, 8, true, true, 5);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.5));
+        ASSERT_NO_THROW(builder.addNextValue(0, 4, 0.5));
+        ASSERT_NO_THROW(builder.addNextValue(1, 2, 0.5));
+        ASSERT_NO_THROW(builder.addNextValue(1, 3, 0.5));
+        ASSERT_NO_THROW(builder.newRowGroup(2));
+        ASSERT_NO_THROW(builder.addNextValue(2, 0, 0.5));
+        ASSERT_NO_THROW(builder.addNextValue(2, 3, 0.5));
+        ASSERT_NO_THROW(builder.newRowGroup(3));
+        ASSERT_NO_THROW(builder.addNextValue(3, 0, 0.5));
+        ASSERT_NO_THROW(builder.addNextValue(3, 4, 0.5));
+        ASSERT_NO_THROW(builder.newRowGroup(4));
+        ASSERT_NO_THROW(builder.newRowGroup(5));
+        
+        storm::storage::SparseMatrix<double> A;
+        ASSERT_NO_THROW(A = builder.build());
+        std::vector<double> b = {0.0, 0.0, 0.0, 0.0, 1.0, 0.0};
+        
+        // A block size of one splits the SCC {0, 1, 2} into several blocks.
+        for (uint64_t blockSize : {1ull, 1024ull}) {
+            storm::solver::helper::ParallelGaussSeidelHelper<double> helper(A, blockSize);
+            EXPECT_EQ(2ull, helper.getNumberOfLevels());
+            
+            std::vector<double> x(5, 0.0);
+            std::vector<uint64_t> choices(5, 0);
+            for (uint64_t iteration = 0; iteration < 100; ++iteration) {
+                helper.multiplyAndReduceGaussSeidel(storm::OptimizationDirection::Maximize, x, &b, &choices, true);
+            }
+            EXPECT_NEAR(2.0 / 3.0, x[0], 1e-12);
+            EXPECT_NEAR(5.0 / 6.0, x[1], 1e-12);
+            EXPECT_NEAR(1.0 / 3.0, x[2], 1e-12);
+            EXPECT_NEAR(1.0, x[3], 1e-12);
+            EXPECT_EQ(1ull, choices[0]);
+            
+            x.assign(5, 0.0);
+            for (uint64_t iteration = 0; iteration < 100; ++iteration) {
+                helper.multiplyAndReduceGaussSeidel(storm::OptimizationDirection::Minimize, x, &b, &choices, true);
+            }
+            EXPECT_NEAR(1.0 / 3.0, x[0], 1e-12);
+            EXPECT_EQ(0ull, choices[0]);
+        }
+    }
+    
 }
\ No newline at end of file
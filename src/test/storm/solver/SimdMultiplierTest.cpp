@@ -0,0 +1,124 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <set>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/solver/NativeMultiplier.h"
+#include "storm/solver/SimdMultiplier.h"
+#include "storm/environment/Environment.h"
+
+namespace {
+
+    /*!
+     * Builds a random matrix whose row groups have between one and maxGroupSize rows with between 17 and 40 entries
+     * each, such that the vectorized kernels process full vectors as well as remainders.
+     */
+    storm::storage::SparseMatrix<double> buildRandomMatrix(std::mt19937& generator, uint64_t numberOfGroups, uint64_t maxGroupSize) {
+        std::uniform_real_distribution<double> valueDistribution(0.0, 1.0);
+        storm::storage::SparseMatrixBuilder<double> builder(0, numberOfGroups, 0, false, true);
+        uint64_t row = 0;
+        for (uint64_t group = 0; group < numberOfGroups; ++group) {
+            builder.newRowGroup(row);
+            uint64_t groupSize = 1 + generator() % maxGroupSize;
+            for (uint64_t choice = 0; choice < groupSize; ++choice, ++row) {
+                uint64_t rowWidth = 17 + generator() % 24;
+                std::set<uint64_t> columns;
+                while (columns.size() < rowWidth) {
+                    columns.insert(generator() % numberOfGroups);
+                }
+                for (auto const& column : columns) {
+                    builder.addNextValue(row, column, valueDistribution(generator) / rowWidth);
+                }
+            }
+        }
+        return builder.build(row, numberOfGroups, numberOfGroups);
+    }
+
+    std::vector<double> randomVector(std::mt19937& generator, uint64_t size) {
+        std::uniform_real_distribution<double> valueDistribution(0.0, 1.0);
+        std::vector<double> result(size);
+        for (auto& value : result) {
+            value = valueDistribution(generator);
+        }
+        return result;
+    }
+
+}
+
+TEST(SimdMultiplierTest, RandomWideRowsMatchNativeMultiplier) {
+    std::mt19937 generator(42);
+    double const precision = 1e-12;
+    storm::Environment env;
+
+    storm::storage::SparseMatrix<double> matrix = buildRandomMatrix(generator, 300, 20);
+    std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+    std::vector<double> x = randomVector(generator, matrix.getColumnCount());
+    std::vector<double> b = randomVector(generator, matrix.getRowCount());
+
+    storm::solver::NativeMultiplier<double> nativeMultiplier(matrix);
+    storm::solver::SimdMultiplier<double> simdMultiplier(matrix);
+
+    // Plain multiplication, with and without offset.
+    std::vector<std::vector<double> const*> offsets = {nullptr, &b};
+    for (auto const* offset : offsets) {
+        std::vector<double> expected(matrix.getRowCount());
+        std::vector<double> result(matrix.getRowCount());
+        nativeMultiplier.multiply(env, x, offset, expected);
+        simdMultiplier.multiply(env, x, offset, result);
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            EXPECT_NEAR(expected[row], result[row], precision) << "in row " << row;
+        }
+    }
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        // Multiplication and reduction with choices.
+        std::vector<double> expected(matrix.getRowGroupCount());
+        std::vector<double> result(matrix.getRowGroupCount());
+        std::vector<uint64_t> expectedChoices(matrix.getRowGroupCount(), 0);
+        std::vector<uint64_t> choices(matrix.getRowGroupCount(), 0);
+        nativeMultiplier.multiplyAndReduce(env, dir, rowGroupIndices, x, &b, expected, &expectedChoices);
+        simdMultiplier.multiplyAndReduce(env, dir, rowGroupIndices, x, &b, result, &choices);
+        for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+            EXPECT_NEAR(expected[group], result[group], precision) << "in group " << group;
+            EXPECT_EQ(expectedChoices[group], choices[group]) << "in group " << group;
+        }
+
+        // Gauss-Seidel style multiplication and reduction in both directions.
+        for (bool backwards : {false, true}) {
+            std::vector<double> expectedX = x;
+            std::vector<double> resultX = x;
+            std::fill(expectedChoices.begin(), expectedChoices.end(), 0);
+            std::fill(choices.begin(), choices.end(), 0);
+            nativeMultiplier.multiplyAndReduceGaussSeidel(env, dir, rowGroupIndices, expectedX, &b, &expectedChoices, backwards);
+            simdMultiplier.multiplyAndReduceGaussSeidel(env, dir, rowGroupIndices, resultX, &b, &choices, backwards);
+            for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+                EXPECT_NEAR(expectedX[group], resultX[group], precision) << "in group " << group;
+                EXPECT_EQ(expectedChoices[group], choices[group]) << "in group " << group;
+            }
+        }
+    }
+}
+
+TEST(SimdMultiplierTest, NaNKeepsChoicesInRowGroup) {
+    std::mt19937 generator(7);
+    storm::Environment env;
+
+    storm::storage::SparseMatrix<double> matrix = buildRandomMatrix(generator, 100, 20);
+    std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+    std::vector<double> x = randomVector(generator, matrix.getColumnCount());
+    x[generator() % x.size()] = std::numeric_limits<double>::quiet_NaN();
+
+    storm::solver::SimdMultiplier<double> simdMultiplier(matrix);
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> result(matrix.getRowGroupCount());
+        std::vector<uint64_t> choices(matrix.getRowGroupCount(), 0);
+        ASSERT_NO_THROW(simdMultiplier.multiplyAndReduce(env, dir, rowGroupIndices, x, nullptr, result, &choices));
+        for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+            EXPECT_LT(choices[group], rowGroupIndices[group + 1] - rowGroupIndices[group]) << "in group " << group;
+        }
+    }
+}
@@ -560,6 +560,134 @@ TEST(BitVectorTest, Iterator) {
     }
 }
 
+TEST(BitVectorTest, IteratorAdvance) {
+    storm::storage::BitVector vector(1000);
+    
+    for (uint_fast64_t i = 0; i < 1000; ++i) {
+        vector.set(i, i % 3 == 0 || i % 7 == 0);
+    }
+    std::vector<uint_fast64_t> setIndices(vector.begin(), vector.end());
+    
+    for (size_t step : {0ul, 1ul, 2ul, 17ul, 100ul}) {
+        auto it = vector.begin();
+        for (size_t position = 0; position < setIndices.size(); position += step) {
+            ASSERT_EQ(setIndices[position], *it);
+            if (step == 0) {
+                break;
+            }
+            it += step;
+        }
+        ASSERT_TRUE(step == 0 || it == vector.end());
+    }
+}
+
+TEST(BitVectorTest, AndNot) {
+    storm::storage::BitVector vector1(32);
+    storm::storage::BitVector vector2(32);
+    
+    for (uint_fast64_t i = 0; i < 32; ++i) {
+        vector1.set(i, i % 2 == 0);
+        vector2.set(i, i % 4 == 0);
+    }
+    
+    storm::storage::BitVector andNotResult = vector1.andNot(vector2);
+    vector1.andNotAssign(vector2);
+    
+    for (uint_fast64_t i = 0; i < 32; ++i) {
+        ASSERT_EQ(i % 4 == 2, andNotResult.get(i));
+        ASSERT_EQ(i % 4 == 2, vector1.get(i));
+    }
+}
+
+TEST(BitVectorTest, NumberOfSetBitsInIntersection) {
+    storm::storage::BitVector vector1(32);
+    storm::storage::BitVector vector2(32);
+    
+    for (uint_fast64_t i = 0; i < 32; ++i) {
+        vector1.set(i, i % 2 == 0);
+        vector2.set(i, i % 3 == 0);
+    }
+    
+    ASSERT_EQ(6ul, vector1.getNumberOfSetBitsInIntersection(vector2));
+}
+
+TEST(BitVectorTest, SetIndices) {
+    storm::storage::BitVector vector(200);
+    std::vector<uint_fast64_t> expected;
+    
+    for (uint_fast64_t i = 0; i < 200; ++i) {
+        if (i % 5 == 1 || i == 63 || i == 64) {
+            vector.set(i);
+            expected.push_back(i);
+        }
+    }
+    
+    ASSERT_EQ(expected, vector.getSetIndices());
+    
+    // Retrieve the indices in chunks.
+    std::vector<uint_fast64_t> chunked;
+    uint_fast64_t buffer[7];
+    uint_fast64_t startingIndex = 0;
+    while (uint_fast64_t numberOfIndices = vector.getSetIndices(startingIndex, buffer, 7)) {
+        chunked.insert(chunked.end(), buffer, buffer + numberOfIndices);
+        startingIndex = buffer[numberOfIndices - 1] + 1;
+    }
+    ASSERT_EQ(expected, chunked);
+    
+    ASSERT_TRUE(storm::storage::BitVector(100).getSetIndices().empty());
+}
+
+TEST(BitVectorTest, BulkOperations) {
+    // Use bit vectors that are long enough to be processed by the vectorized kernels (if available).
+    uint_fast64_t const size = 1234;
+    storm::storage::BitVector vector1(size);
+    storm::storage::BitVector vector2(size);
+    
+    for (uint_fast64_t i = 0; i < size; ++i) {
+        vector1.set(i, (i * 7) % 11 < 5);
+        vector2.set(i, (i * 5) % 13 < 7);
+    }
+    
+    storm::storage::BitVector andResult = vector1 & vector2;
+    storm::storage::BitVector orResult = vector1 | vector2;
+    storm::storage::BitVector xorResult = vector1 ^ vector2;
+    storm::storage::BitVector andNotResult = vector1.andNot(vector2);
+    storm::storage::BitVector impliesResult = vector1.implies(vector2);
+    storm::storage::BitVector notResult = ~vector1;
+    
+    uint_fast64_t numberOfSetBits = 0;
+    uint_fast64_t numberOfSetBitsInIntersection = 0;
+    for (uint_fast64_t i = 0; i < size; ++i) {
+        ASSERT_EQ(vector1.get(i) && vector2.get(i), andResult.get(i));
+        ASSERT_EQ(vector1.get(i) || vector2.get(i), orResult.get(i));
+        ASSERT_EQ(vector1.get(i) != vector2.get(i), xorResult.get(i));
+        ASSERT_EQ(vector1.get(i) && !vector2.get(i), andNotResult.get(i));
+        ASSERT_EQ(!vector1.get(i) || vector2.get(i), impliesResult.get(i));
+        ASSERT_EQ(!vector1.get(i), notResult.get(i));
+        numberOfSetBits += vector1.get(i) ? 1 : 0;
+        numberOfSetBitsInIntersection += andResult.get(i) ? 1 : 0;
+    }
+    ASSERT_EQ(size, (notResult | vector1).getNumberOfSetBits());
+    ASSERT_EQ(numberOfSetBits, vector1.getNumberOfSetBits());
+    ASSERT_EQ(numberOfSetBitsInIntersection, vector1.getNumberOfSetBitsInIntersection(vector2));
+    
+    ASSERT_TRUE(andResult.isSubsetOf(vector1));
+    ASSERT_TRUE(vector1.isSubsetOf(orResult));
+    ASSERT_FALSE(vector1.isSubsetOf(vector2));
+    ASSERT_TRUE(andNotResult.isDisjointFrom(vector2));
+    ASSERT_FALSE(vector1.isDisjointFrom(vector2));
+    
+    // A difference in the very last bit has to be detected as well.
+    storm::storage::BitVector vector3(size);
+    storm::storage::BitVector vector4(size);
+    vector3.set(size - 1);
+    ASSERT_FALSE(vector3.isSubsetOf(vector4));
+    ASSERT_TRUE(vector3.isDisjointFrom(vector4));
+    vector4.set(size - 1);
+    ASSERT_TRUE(vector3.isSubsetOf(vector4));
+    ASSERT_FALSE(vector3.isDisjointFrom(vector4));
+}
+
 TEST(BitVectorTest, CompareAndSwap) {
     storm::storage::BitVector vector(140);
     vector.setFromInt(0, 64, 2377830234574424100);
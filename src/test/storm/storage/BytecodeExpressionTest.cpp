@@ -0,0 +1,77 @@
+#include "test/storm_gtest.h"
+
+#include "storm/generator/BytecodeExpression.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+
+namespace {
+    class BytecodeExpressionTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            manager = std::make_shared<storm::expressions::ExpressionManager>();
+            b = manager->declareBooleanVariable("b");
+            x = manager->declareIntegerVariable("x");
+            y = manager->declareIntegerVariable("y");
+
+            // Layout: b at bit 0, x in [-3, 12] at bits 1-4, y in [0, 7] at bits 5-7.
+            variableInformation.booleanVariables.emplace_back(b, 0, true, true);
+            variableInformation.integerVariables.emplace_back(x, -3, 12, 1, 4, true, true);
+            variableInformation.integerVariables.emplace_back(y, 0, 7, 5, 3, true, true);
+        }
+
+        // Compares the compiled expression with the evaluator on all states.
+        void checkAllStates(storm::expressions::Expression const& expression) {
+            auto compiled = storm::generator::BytecodeExpression::compile(expression, variableInformation);
+            ASSERT_TRUE(static_cast<bool>(compiled)) << expression;
+
+            storm::expressions::ExpressionEvaluator<double> evaluator(*manager);
+            for (uint64_t bits = 0; bits < 256; ++bits) {
+                storm::generator::CompressedState state(8);
+                state.setFromInt(0, 8, bits);
+                if (state.getAsInt(1, 4) > 15) {
+                    continue;
+                }
+                storm::generator::unpackStateIntoEvaluator(state, variableInformation, evaluator);
+                if (expression.hasBooleanType()) {
+                    EXPECT_EQ(evaluator.asBool(expression), compiled->evaluateAsBool(state)) << expression << " in state " << bits;
+                } else if (expression.hasIntegerType()) {
+                    EXPECT_EQ(evaluator.asInt(expression), compiled->evaluateAsInt(state)) << expression << " in state " << bits;
+                } else {
+                    EXPECT_NEAR(evaluator.asRational(expression), compiled->evaluateAsDouble(state), 1e-12) << expression << " in state " << bits;
+                }
+            }
+        }
+
+        std::shared_ptr<storm::expressions::ExpressionManager> manager;
+        storm::expressions::Variable b;
+        storm::expressions::Variable x;
+        storm::expressions::Variable y;
+        storm::generator::VariableInformation variableInformation;
+    };
+
+    TEST_F(BytecodeExpressionTest, BooleanExpressions) {
+        checkAllStates(b.getExpression() && x.getExpression() > manager->integer(2));
+        checkAllStates(!b.getExpression() || x.getExpression() + y.getExpression() * manager->integer(2) <= manager->integer(7));
+        checkAllStates(storm::expressions::implies(x.getExpression() % manager->integer(3) == manager->integer(1), b.getExpression()));
+        checkAllStates(storm::expressions::xclusiveor(b.getExpression(), y.getExpression() != manager->integer(3)));
+        checkAllStates(storm::expressions::iff(b.getExpression(), x.getExpression() >= y.getExpression()));
+        checkAllStates(storm::expressions::ite(b.getExpression(), x.getExpression() / manager->integer(2), y.getExpression() * manager->rational(0.25)) >= manager->rational(0.5));
+        checkAllStates(storm::expressions::floor(x.getExpression() / manager->integer(3)) >= y.getExpression() - manager->integer(4));
+    }
+
+    TEST_F(BytecodeExpressionTest, NumericalExpressions) {
+        checkAllStates(x.getExpression() + manager->integer(1));
+        checkAllStates(storm::expressions::maximum(x.getExpression(), -y.getExpression()) * manager->integer(2));
+        checkAllStates(storm::expressions::ite(b.getExpression(), manager->rational(0.3), manager->rational(0.7)));
+        checkAllStates(manager->rational(1) / (manager->integer(1) + y.getExpression()));
+        checkAllStates(storm::expressions::ite(b.getExpression(), x.getExpression(), y.getExpression() * manager->rational(0.5)));
+    }
+
+    TEST_F(BytecodeExpressionTest, Unsupported) {
+        // Variables that are not part of the state cannot be compiled.
+        storm::expressions::Variable p = manager->declareRationalVariable("p");
+        EXPECT_FALSE(static_cast<bool>(storm::generator::BytecodeExpression::compile(p.getExpression() * x.getExpression(), variableInformation)));
+    }
+}
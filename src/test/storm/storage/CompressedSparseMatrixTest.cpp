@@ -0,0 +1,125 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <random>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/CompressedSparseMatrix.h"
+
+namespace {
+
+    /*!
+     * Builds a random matrix whose columns are (in this order) close to each other, more than 127 apart or more than
+     * 16383 apart (to require one, two or three bytes per encoded column) and whose values are taken round robin from
+     * the given number of distinct values. Every tenth row group is empty.
+     */
+    storm::storage::SparseMatrix<double> buildMatrix(std::mt19937& generator, uint64_t numberOfGroups, uint64_t numberOfColumns, uint64_t numberOfDistinctValues) {
+        storm::storage::SparseMatrixBuilder<double> builder(0, numberOfColumns, 0, false, true);
+        uint64_t row = 0;
+        uint64_t entry = 0;
+        for (uint64_t group = 0; group < numberOfGroups; ++group) {
+            builder.newRowGroup(row);
+            if (group % 10 == 5) {
+                continue;
+            }
+            uint64_t groupSize = 1 + generator() % 3;
+            for (uint64_t choice = 0; choice < groupSize; ++choice, ++row) {
+                uint64_t column = generator() % 100;
+                while (column < numberOfColumns) {
+                    builder.addNextValue(row, column, static_cast<double>(entry % numberOfDistinctValues + 1) / (numberOfDistinctValues + 1));
+                    ++entry;
+                    switch (generator() % 3) {
+                        case 0: column += 1 + generator() % 100; break;
+                        case 1: column += 128 + generator() % 1000; break;
+                        default: column += 16384 + generator() % 20000; break;
+                    }
+                }
+            }
+        }
+        return builder.build(row, numberOfColumns, numberOfGroups);
+    }
+
+    void checkAgainstSparseMatrix(storm::storage::SparseMatrix<double> const& matrix, storm::storage::CompressedSparseMatrix<double> const& compressedMatrix, std::mt19937& generator) {
+        std::uniform_real_distribution<double> valueDistribution(0.0, 1.0);
+        std::vector<double> x(matrix.getColumnCount());
+        for (auto& value : x) {
+            value = valueDistribution(generator);
+        }
+        std::vector<double> b(matrix.getRowCount());
+        for (auto& value : b) {
+            value = valueDistribution(generator);
+        }
+
+        ASSERT_EQ(matrix.getRowCount(), compressedMatrix.getRowCount());
+        ASSERT_EQ(matrix.getColumnCount(), compressedMatrix.getColumnCount());
+        ASSERT_EQ(matrix.getEntryCount(), compressedMatrix.getEntryCount());
+
+        std::vector<double> expected(matrix.getRowCount());
+        std::vector<double> result(matrix.getRowCount());
+        matrix.multiplyWithVector(x, expected, &b);
+        compressedMatrix.multiplyWithVector(x, result, &b);
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            EXPECT_NEAR(expected[row], result[row], 1e-12) << "in row " << row;
+        }
+
+        std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            for (bool backward : {false, true}) {
+                // Fill the results with garbage to check that empty row groups are left untouched (as by the sparse matrix).
+                std::vector<double> expectedGroups(matrix.getRowGroupCount(), 42.0);
+                std::vector<double> resultGroups(matrix.getRowGroupCount(), 42.0);
+                std::vector<uint64_t> expectedChoices(matrix.getRowGroupCount(), 0);
+                std::vector<uint64_t> choices(matrix.getRowGroupCount(), 0);
+                if (backward) {
+                    matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, &b, expectedGroups, &expectedChoices);
+                    compressedMatrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, &b, resultGroups, &choices);
+                } else {
+                    matrix.multiplyAndReduceForward(dir, rowGroupIndices, x, &b, expectedGroups, &expectedChoices);
+                    compressedMatrix.multiplyAndReduceForward(dir, rowGroupIndices, x, &b, resultGroups, &choices);
+                }
+                for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+                    EXPECT_NEAR(expectedGroups[group], resultGroups[group], 1e-12) << "in group " << group;
+                    EXPECT_EQ(expectedChoices[group], choices[group]) << "in group " << group;
+                    if (rowGroupIndices[group] == rowGroupIndices[group + 1]) {
+                        EXPECT_EQ(42.0, resultGroups[group]) << "in empty group " << group;
+                    }
+                }
+            }
+        }
+    }
+
+}
+
+TEST(CompressedSparseMatrixTest, NarrowValueIndices) {
+    std::mt19937 generator(42);
+    storm::storage::SparseMatrix<double> matrix = buildMatrix(generator, 200, 100000, 200);
+    storm::storage::CompressedSparseMatrix<double> compressedMatrix(matrix);
+    EXPECT_TRUE(compressedMatrix.hasValueDictionary());
+    EXPECT_EQ(200ul, compressedMatrix.getValueDictionarySize());
+    checkAgainstSparseMatrix(matrix, compressedMatrix, generator);
+}
+
+TEST(CompressedSparseMatrixTest, WideValueIndices) {
+    std::mt19937 generator(43);
+    storm::storage::SparseMatrix<double> matrix = buildMatrix(generator, 200, 100000, 1000);
+    storm::storage::CompressedSparseMatrix<double> compressedMatrix(matrix);
+    EXPECT_TRUE(compressedMatrix.hasValueDictionary());
+    EXPECT_EQ(1000ul, compressedMatrix.getValueDictionarySize());
+    checkAgainstSparseMatrix(matrix, compressedMatrix, generator);
+}
+
+TEST(CompressedSparseMatrixTest, PlainValues) {
+    // More than 65536 distinct values do not fit into a dictionary with 16 bit indices.
+    std::mt19937 generator(44);
+    storm::storage::SparseMatrix<double> matrix = buildMatrix(generator, 5000, 100000, 70000);
+    ASSERT_LT(70000ul, matrix.getEntryCount());
+    storm::storage::CompressedSparseMatrix<double> compressedMatrix(matrix);
+    EXPECT_FALSE(compressedMatrix.hasValueDictionary());
+    checkAgainstSparseMatrix(matrix, compressedMatrix, generator);
+
+    // Disabling the dictionary also yields plain values.
+    storm::storage::SparseMatrix<double> smallMatrix = buildMatrix(generator, 200, 100000, 10);
+    storm::storage::CompressedSparseMatrix<double> plainMatrix(smallMatrix, false);
+    EXPECT_FALSE(plainMatrix.hasValueDictionary());
+    checkAgainstSparseMatrix(smallMatrix, plainMatrix, generator);
+}
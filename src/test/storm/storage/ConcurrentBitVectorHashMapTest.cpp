@@ -0,0 +1,81 @@
+#include "test/storm_gtest.h"
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(64, 3);
+
+    std::vector<storm::storage::BitVector> keys;
+    for (uint64_t i = 0; i < 6; ++i) {
+        storm::storage::BitVector key(64);
+        key.set(i);
+        key.set(63 - 2 * i);
+        keys.push_back(key);
+        ASSERT_NO_THROW(map.findOrAdd(key, i + 1));
+        for (uint64_t j = 0; j <= i; ++j) {
+            EXPECT_EQ(j + 1, map.findOrAdd(keys[j], 0));
+        }
+    }
+    EXPECT_EQ(6ul, map.size());
+    EXPECT_TRUE(map.contains(keys[3]));
+    EXPECT_EQ(4ul, map.getValue(keys[3]));
+
+    storm::storage::BitVector unknown(64);
+    unknown.set(17);
+    EXPECT_FALSE(map.contains(unknown));
+
+    uint64_t numberOfElements = 0;
+    for (auto const& keyValuePair : map) {
+        EXPECT_EQ(keyValuePair.second, map.getValue(keyValuePair.first));
+        ++numberOfElements;
+    }
+    EXPECT_EQ(6ul, numberOfElements);
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentInsertion) {
+    uint64_t const numberOfKeys = 50000;
+    uint64_t const numberOfThreads = 4;
+
+    // Keys that span two words.
+    std::vector<storm::storage::BitVector> keys;
+    for (uint64_t i = 0; i < numberOfKeys; ++i) {
+        storm::storage::BitVector key(128);
+        key.setFromInt(0, 64, i);
+        key.setFromInt(64, 64, i * 7919);
+        keys.push_back(key);
+    }
+
+    // All threads insert all keys (in different orders given by strides that are coprime to the number of keys), so
+    // that many insertions of the same key race each other and the map is resized while it is accessed concurrently.
+    uint64_t const strides[numberOfThreads] = {1, 3, 7, 11};
+    storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(128, 16);
+    std::vector<std::vector<uint64_t>> buckets(numberOfThreads, std::vector<uint64_t>(numberOfKeys));
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&, thread] () {
+            for (uint64_t j = 0; j < numberOfKeys; ++j) {
+                uint64_t i = (j * strides[thread]) % numberOfKeys;
+                auto valueBucketPair = map.findOrAddAndGetBucket(keys[i], static_cast<uint32_t>(i));
+                EXPECT_EQ(i, valueBucketPair.first);
+                buckets[thread][i] = valueBucketPair.second;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(numberOfKeys, map.size());
+    for (uint64_t i = 0; i < numberOfKeys; ++i) {
+        EXPECT_EQ(i, map.getValue(keys[i]));
+        for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+            EXPECT_EQ(buckets[0][i], buckets[thread][i]);
+        }
+        EXPECT_EQ(keys[i], map.getBucketAndValue(buckets[0][i]).first);
+    }
+}
@@ -0,0 +1,79 @@
+#include "test/storm_gtest.h"
+
+#include <cstdint>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/ExternalBitVectorMap.h"
+#include "storm/storage/ExternalBitVectorQueue.h"
+
+namespace {
+    storm::storage::BitVector createKey(uint64_t index) {
+        // Spread the keys over both words and make sure that they are not added in sorted order.
+        storm::storage::BitVector key(128);
+        key.setFromInt(0, 64, (index * 7919) % 1000);
+        key.setFromInt(64, 64, index);
+        return key;
+    }
+}
+
+TEST(ExternalBitVectorMapTest, AddAndFind) {
+    storm::storage::ExternalBitVectorMap<uint64_t> externalMap(128, 1024);
+
+    // Add the keys in several bulks of different sizes.
+    uint64_t const numberOfKeys = 5000;
+    uint64_t nextKey = 0;
+    for (uint64_t bulkSize : {1000, 100, 2000, 300, 1600}) {
+        storm::storage::BitVectorHashMap<uint64_t> map(128, 10);
+        for (uint64_t index = 0; index < bulkSize; ++index, ++nextKey) {
+            map.findOrAdd(createKey(nextKey), nextKey + 1);
+        }
+        externalMap.add(map);
+    }
+    ASSERT_EQ(numberOfKeys, nextKey);
+    EXPECT_EQ(numberOfKeys, externalMap.size());
+    EXPECT_LT(externalMap.getNumberOfRuns(), 5ul);
+
+    for (uint64_t index = 0; index < numberOfKeys; ++index) {
+        auto flagAndValue = externalMap.find(createKey(index));
+        ASSERT_TRUE(flagAndValue.first);
+        EXPECT_EQ(index + 1, flagAndValue.second);
+    }
+    for (uint64_t index = numberOfKeys; index < 2 * numberOfKeys; ++index) {
+        EXPECT_FALSE(externalMap.contains(createKey(index)));
+    }
+
+    storm::storage::BitVector found(numberOfKeys + 1);
+    externalMap.forEach([&] (storm::storage::BitVector const& key, uint64_t const& value) {
+        EXPECT_EQ(createKey(value - 1), key);
+        EXPECT_FALSE(found.get(value));
+        found.set(value);
+    });
+    EXPECT_EQ(numberOfKeys, found.getNumberOfSetBits());
+}
+
+TEST(ExternalBitVectorMapTest, Queue) {
+    storm::storage::ExternalBitVectorQueue<uint32_t> queue(128, 16);
+    uint64_t nextPushed = 0;
+    uint64_t nextPopped = 0;
+
+    // Interleave pushing and popping such that elements pass through the file as well as the buffers only.
+    for (uint64_t round = 0; round < 20; ++round) {
+        for (uint64_t index = 0; index < 3 * round; ++index, ++nextPushed) {
+            queue.push(createKey(nextPushed), static_cast<uint32_t>(nextPushed));
+        }
+        for (uint64_t index = 0; index < 2 * round && !queue.empty(); ++index, ++nextPopped) {
+            auto element = queue.pop();
+            EXPECT_EQ(createKey(nextPopped), element.first);
+            EXPECT_EQ(nextPopped, element.second);
+        }
+        EXPECT_EQ(nextPushed - nextPopped, queue.size());
+    }
+    while (!queue.empty()) {
+        auto element = queue.pop();
+        EXPECT_EQ(createKey(nextPopped), element.first);
+        EXPECT_EQ(nextPopped, element.second);
+        ++nextPopped;
+    }
+    EXPECT_EQ(nextPushed, nextPopped);
+}
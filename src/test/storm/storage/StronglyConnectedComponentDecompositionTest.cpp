@@ -1,5 +1,9 @@
 #include "test/storm_gtest.h"
 #include "storm-config.h"
+
+#include <random>
+#include <set>
+
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
@@ -86,3 +90,69 @@ TEST(StronglyConnectedComponentDecomposition, FullSystem2) {
 
     markovAutomaton = nullptr;
 }
+
+TEST(StronglyConnectedComponentDecomposition, ParallelDecomposition) {
+    // Build a system with many SCCs of different sizes, some transient states, and states with selfloops.
+    uint64_t const numberOfStates = 20000;
+    std::mt19937 generator(42);
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(numberOfStates, numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        std::set<uint64_t> successors;
+        successors.insert(generator() % 3 == 0 ? (state + 1) % numberOfStates : state - state % 50);
+        successors.insert(std::min(numberOfStates - 1, state + generator() % 100));
+        if (generator() % 5 == 0) {
+            successors.insert(generator() % numberOfStates);
+        }
+        for (auto const& successor : successors) {
+            ASSERT_NO_THROW(matrixBuilder.addNextValue(state, successor, 1.0 / successors.size()));
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    storm::storage::BitVector subsystem(numberOfStates, true);
+    for (uint64_t state = 0; state < numberOfStates; state += 7) {
+        subsystem.set(state, false);
+    }
+
+    auto getSccs = [] (storm::storage::StronglyConnectedComponentDecomposition<double> const& decomposition) {
+        std::set<std::vector<uint64_t>> result;
+        for (auto const& scc : decomposition) {
+            result.insert(std::vector<uint64_t>(scc.begin(), scc.end()));
+        }
+        return result;
+    };
+
+    for (uint64_t optionIndex = 0; optionIndex < 4; ++optionIndex) {
+        storm::storage::StronglyConnectedComponentDecompositionOptions options;
+        options.computeSccDepths();
+        if (optionIndex == 1) {
+            options.subsystem(&subsystem);
+        } else if (optionIndex == 2) {
+            options.dropNaiveSccs();
+        } else if (optionIndex == 3) {
+            options.onlyBottomSccs();
+        }
+        storm::storage::StronglyConnectedComponentDecomposition<double> sequentialDecomposition(matrix, options.parallel(false));
+        storm::storage::StronglyConnectedComponentDecomposition<double> parallelDecomposition(matrix, options.parallel(true));
+        ASSERT_EQ(sequentialDecomposition.size(), parallelDecomposition.size());
+        EXPECT_EQ(getSccs(sequentialDecomposition), getSccs(parallelDecomposition));
+        EXPECT_EQ(sequentialDecomposition.getMaxSccDepth(), parallelDecomposition.getMaxSccDepth());
+
+        // The SCCs need to be sorted topologically.
+        std::vector<uint64_t> stateToScc(numberOfStates, parallelDecomposition.size());
+        for (uint64_t sccIndex = 0; sccIndex < parallelDecomposition.size(); ++sccIndex) {
+            for (auto const& state : parallelDecomposition.getBlock(sccIndex)) {
+                stateToScc[state] = sccIndex;
+            }
+        }
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (stateToScc[state] < parallelDecomposition.size()) {
+                for (auto const& entry : matrix.getRow(state)) {
+                    if (stateToScc[entry.getColumn()] < parallelDecomposition.size()) {
+                        EXPECT_LE(stateToScc[entry.getColumn()], stateToScc[state]);
+                    }
+                }
+            }
+        }
+    }
+}
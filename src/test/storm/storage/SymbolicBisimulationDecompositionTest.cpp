@@ -28,6 +28,15 @@
 #include "storm/models/symbolic/Mdp.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
 
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/environment/Environment.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/modules/SylvanSettings.h"
+#include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
+
 TEST(SymbolicModelBisimulationDecomposition, Die_Cudd) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
     
@@ -467,3 +476,62 @@ TEST(SymbolicModelBisimulationDecomposition, AsynchronousLeader_Sylvan) {
     EXPECT_TRUE(quotient->isSymbolicModel());
     EXPECT_EQ(2152ul, (quotient->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan, double>>()->getNumberOfChoices()));
 }
+
+namespace {
+    
+    struct SylvanQuotientSummary {
+        uint64_t numberOfWorkers;
+        uint64_t numberOfStates;
+        uint64_t numberOfTransitions;
+        uint64_t numberOfChoices;
+        double value;
+    };
+    
+    // Computes the sparse quotient of the leader election model with the given number of Sylvan workers. This only has an
+    // effect if no other Sylvan manager is alive, because Sylvan is initialized with the first manager.
+    SylvanQuotientSummary computeLeaderQuotientWithSylvanWorkers(uint64_t numberOfWorkers) {
+        storm::settings::mutableManager().setFromString("--" + storm::settings::modules::SylvanSettings::moduleName + ":threads " + std::to_string(numberOfWorkers));
+        storm::settings::SettingMemento threadsMemento(storm::settings::mutableManager().getModule(storm::settings::modules::SylvanSettings::moduleName), "threads", false);
+        
+        storm::storage::SymbolicModelDescription smd = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm");
+        smd = smd.preprocess();
+        
+        storm::parser::FormulaParser formulaParser;
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("Rmax=? [F \"elected\"]");
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+        formulas.push_back(formula);
+        
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan, double>().build(smd.asPrismProgram(), *formula);
+        
+        SylvanQuotientSummary result;
+        result.numberOfWorkers = storm::dd::InternalDdManager<storm::dd::DdType::Sylvan>::getNumberOfWorkers();
+        
+        storm::dd::BisimulationDecomposition<storm::dd::DdType::Sylvan, double> decomposition(*model, formulas, storm::storage::BisimulationType::Strong);
+        decomposition.compute();
+        std::shared_ptr<storm::models::sparse::Mdp<double>> quotient = decomposition.getQuotient(storm::dd::bisimulation::QuotientFormat::Sparse)->as<storm::models::sparse::Mdp<double>>();
+        result.numberOfStates = quotient->getNumberOfStates();
+        result.numberOfTransitions = quotient->getNumberOfTransitions();
+        result.numberOfChoices = quotient->getNumberOfChoices();
+        
+        storm::Environment env;
+        storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*quotient);
+        std::unique_ptr<storm::modelchecker::CheckResult> checkResult = checker.check(env, *formula);
+        result.value = checkResult->asExplicitQuantitativeCheckResult<double>()[*quotient->getInitialStates().begin()];
+        return result;
+    }
+    
+}
+
+TEST(SymbolicModelBisimulationDecomposition, AsynchronousLeaderMultipleWorkers_Sylvan) {
+    SylvanQuotientSummary single = computeLeaderQuotientWithSylvanWorkers(1);
+    SylvanQuotientSummary multiple = computeLeaderQuotientWithSylvanWorkers(4);
+    
+    EXPECT_EQ(1ul, single.numberOfWorkers);
+    EXPECT_EQ(4ul, multiple.numberOfWorkers);
+    
+    EXPECT_EQ(1107ul, single.numberOfStates);
+    EXPECT_EQ(single.numberOfStates, multiple.numberOfStates);
+    EXPECT_EQ(single.numberOfTransitions, multiple.numberOfTransitions);
+    EXPECT_EQ(single.numberOfChoices, multiple.numberOfChoices);
+    EXPECT_NEAR(single.value, multiple.value, 1e-6);
+}
@@ -12,6 +12,9 @@
 #include "storm/builder/DdPrismModelBuilder.h"
 #include "storm/builder/ExplicitModelBuilder.h"
 #include "storm/utility/graph.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
@@ -668,3 +671,61 @@ TEST(GraphTest, ExplicitProb01MinMax) {
     EXPECT_EQ(993ull, statesWithProbability01.first.getNumberOfSetBits());
     EXPECT_EQ(16ull, statesWithProbability01.second.getNumberOfSetBits());
 }
+
+TEST(GraphTest, ExplicitProb01FrontierSearch) {
+    std::unique_ptr<storm::settings::SettingMemento> frontierSearch = storm::settings::mutableModelCheckerSettings().overrideFrontierSearchSet(true);
+    
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Dtmc);
+    
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
+    
+    ASSERT_NO_THROW(statesWithProbability01 = storm::utility::graph::performProb01(*model->as<storm::models::sparse::Dtmc<double>>(), storm::storage::BitVector(model->getNumberOfStates(), true), model->getStates("observe0Greater1")));
+    EXPECT_EQ(4409ull, statesWithProbability01.first.getNumberOfSetBits());
+    EXPECT_EQ(1316ull, statesWithProbability01.second.getNumberOfSetBits());
+    
+    ASSERT_NO_THROW(statesWithProbability01 = storm::utility::graph::performProb01(*model->as<storm::models::sparse::Dtmc<double>>(), storm::storage::BitVector(model->getNumberOfStates(), true), model->getStates("observeOnlyTrueSender")));
+    EXPECT_EQ(5829ull, statesWithProbability01.first.getNumberOfSetBits());
+    EXPECT_EQ(1032ull, statesWithProbability01.second.getNumberOfSetBits());
+    
+    // The step bounded search needs to yield the same states as the depth-first search.
+    storm::storage::BitVector allStates(model->getNumberOfStates(), true);
+    storm::storage::BitVector boundedStates = storm::utility::graph::performProbGreater0(model->getBackwardTransitions(), allStates, model->getStates("observe0Greater1"), true, 10);
+    frontierSearch.reset();
+    EXPECT_EQ(storm::utility::graph::performProbGreater0(model->getBackwardTransitions(), allStates, model->getStates("observe0Greater1"), true, 10), boundedStates);
+}
+
+TEST(GraphTest, ExplicitProb01MinMaxFrontierSearch) {
+    std::unique_ptr<storm::settings::SettingMemento> frontierSearch = storm::settings::mutableModelCheckerSettings().overrideFrontierSearchSet(true);
+    
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+    
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
+    
+    ASSERT_NO_THROW(statesWithProbability01 = storm::utility::graph::performProb01Min(*model->as<storm::models::sparse::Mdp<double>>(), storm::storage::BitVector(model->getNumberOfStates(), true), model->getStates("all_coins_equal_0")));
+    EXPECT_EQ(77ull, statesWithProbability01.first.getNumberOfSetBits());
+    EXPECT_EQ(149ull, statesWithProbability01.second.getNumberOfSetBits());
+    
+    ASSERT_NO_THROW(statesWithProbability01 = storm::utility::graph::performProb01Max(*model->as<storm::models::sparse::Mdp<double>>(), storm::storage::BitVector(model->getNumberOfStates(), true), model->getStates("all_coins_equal_0")));
+    EXPECT_EQ(74ull, statesWithProbability01.first.getNumberOfSetBits());
+    EXPECT_EQ(198ull, statesWithProbability01.second.getNumberOfSetBits());
+    
+    ASSERT_NO_THROW(statesWithProbability01 = storm::utility::graph::performProb01Min(*model->as<storm::models::sparse::Mdp<double>>(), storm::storage::BitVector(model->getNumberOfStates(), true), model->getStates("all_coins_equal_1")));
+    EXPECT_EQ(94ull, statesWithProbability01.first.getNumberOfSetBits());
+    EXPECT_EQ(33ull, statesWithProbability01.second.getNumberOfSetBits());
+    
+    ASSERT_NO_THROW(statesWithProbability01 = storm::utility::graph::performProb01Max(*model->as<storm::models::sparse::Mdp<double>>(), storm::storage::BitVector(model->getNumberOfStates(), true), model->getStates("all_coins_equal_1")));
+    EXPECT_EQ(83ull, statesWithProbability01.first.getNumberOfSetBits());
+    EXPECT_EQ(35ull, statesWithProbability01.second.getNumberOfSetBits());
+    
+    storm::storage::BitVector statesWithProbability1A = storm::utility::graph::performProb1A(*model->as<storm::models::sparse::Mdp<double>>(), model->getBackwardTransitions(), storm::storage::BitVector(model->getNumberOfStates(), true), model->getStates("all_coins_equal_1"));
+    frontierSearch.reset();
+    EXPECT_EQ(storm::utility::graph::performProb1A(*model->as<storm::models::sparse::Mdp<double>>(), model->getBackwardTransitions(), storm::storage::BitVector(model->getNumberOfStates(), true), model->getStates("all_coins_equal_1")), statesWithProbability1A);
+}
@@ -0,0 +1,52 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+TEST(ParallelTest, parallelFor) {
+    std::vector<uint64_t> values(100003, 0);
+    storm::utility::parallel::parallelFor(0, values.size(), 10, [&values] (auto const& range) {
+        for (uint64_t index = range.begin(); index < range.end(); ++index) {
+            values[index] += index;
+        }
+    });
+    for (uint64_t index = 0; index < values.size(); ++index) {
+        ASSERT_EQ(index, values[index]);
+    }
+}
+
+TEST(ParallelTest, parallelReduce) {
+    uint64_t sum = storm::utility::parallel::parallelReduce<uint64_t>(0, 100001, 10, 0, [] (auto const& range, uint64_t partialSum) {
+        for (uint64_t index = range.begin(); index < range.end(); ++index) {
+            partialSum += index;
+        }
+        return partialSum;
+    }, std::plus<uint64_t>());
+    EXPECT_EQ(100001ull * 100000ull / 2, sum);
+    
+    EXPECT_EQ(42ull, storm::utility::parallel::parallelReduce<uint64_t>(5, 5, 1, 42, [] (auto const&, uint64_t value) { return value; }, std::plus<uint64_t>()));
+}
+
+TEST(ParallelTest, exception) {
+    EXPECT_THROW(storm::utility::parallel::parallelFor(0, 1000, 1, [] (auto const& range) {
+        if (range.begin() <= 500 && 500 < range.end()) {
+            throw storm::exceptions::InvalidArgumentException() << "Test.";
+        }
+    }), storm::exceptions::InvalidArgumentException);
+}
+
+TEST(ParallelTest, reduceVectorParallel) {
+    std::vector<double> source = {0.5, 0.25, 0.75, 1.0, 0.0, 0.125, 0.5};
+    std::vector<uint_fast64_t> rowGrouping = {0, 3, 4, 6, 7};
+    std::vector<double> sequentialResult(4), parallelResult(4);
+    std::vector<uint_fast64_t> sequentialChoices(4, 0), parallelChoices(4, 0);
+    
+    storm::utility::vector::reduceVectorMinOrMax(storm::OptimizationDirection::Maximize, source, sequentialResult, rowGrouping, &sequentialChoices);
+    storm::utility::vector::reduceVectorMinOrMaxParallel(storm::OptimizationDirection::Maximize, source, parallelResult, rowGrouping, &parallelChoices);
+    EXPECT_EQ(sequentialResult, parallelResult);
+    EXPECT_EQ(sequentialChoices, parallelChoices);
+    EXPECT_EQ(2ull, parallelChoices[0]);
+    EXPECT_EQ(1ull, parallelChoices[2]);
+}
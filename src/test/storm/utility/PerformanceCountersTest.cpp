@@ -0,0 +1,94 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <sstream>
+
+#include "storm/utility/PerformanceCounters.h"
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/storage/SparseMatrix.h"
+
+TEST(PerformanceCountersTest, ScopesAndCounters) {
+    storm::utility::PerformanceCounters counters;
+    {
+        storm::utility::PerformanceCounters::Scope outer(&counters, "outer");
+        for (uint64_t i = 0; i < 3; ++i) {
+            storm::utility::PerformanceCounters::Scope inner(&counters, "inner");
+            counters.addToCounter("iterations", 2);
+        }
+        counters.addToCounter("iterations");
+        counters.updateHighWaterMark("queue size", 5);
+        counters.updateHighWaterMark("queue size", 3);
+    }
+    // Scopes without counters have no effect.
+    storm::utility::PerformanceCounters::Scope noop(nullptr, "unused");
+
+    EXPECT_EQ(7ull, counters.getCounterValue("iterations"));
+    EXPECT_EQ(0ull, counters.getCounterValue("multiplications"));
+    EXPECT_EQ(1ull, counters.getNumberOfScopeEntries("outer"));
+    EXPECT_EQ(3ull, counters.getNumberOfScopeEntries("inner"));
+    EXPECT_EQ(0ull, counters.getNumberOfScopeEntries("unused"));
+
+    std::stringstream jsonStream;
+    counters.exportJson(jsonStream);
+    auto json = storm::json<double>::parse(jsonStream.str());
+    auto const& outer = json["scopes"][0];
+    EXPECT_EQ("outer", outer["name"].get<std::string>());
+    EXPECT_EQ(1ull, outer["counters"]["iterations"].get<uint64_t>());
+    EXPECT_EQ(5ull, outer["high-water marks"]["queue size"].get<uint64_t>());
+    EXPECT_TRUE(outer["high-water marks"]["peak memory (bytes)"].get<uint64_t>() > 0);
+    auto const& inner = outer["scopes"][0];
+    EXPECT_EQ("inner", inner["name"].get<std::string>());
+    EXPECT_EQ(3ull, inner["entries"].get<uint64_t>());
+    EXPECT_EQ(6ull, inner["counters"]["iterations"].get<uint64_t>());
+    EXPECT_EQ(7ull, json["counter totals"]["iterations"].get<uint64_t>());
+
+    std::stringstream traceStream;
+    counters.exportChromeTrace(traceStream);
+    auto trace = storm::json<double>::parse(traceStream.str());
+    uint64_t numberOfCompleteEvents = 0;
+    uint64_t numberOfCounterEvents = 0;
+    for (auto const& event : trace["traceEvents"]) {
+        if (event["ph"].get<std::string>() == "X") {
+            ++numberOfCompleteEvents;
+        } else {
+            EXPECT_EQ("C", event["ph"].get<std::string>());
+            ++numberOfCounterEvents;
+        }
+    }
+    EXPECT_EQ(4ull, numberOfCompleteEvents);
+    EXPECT_EQ(4ull, numberOfCounterEvents);
+}
+
+TEST(PerformanceCountersTest, Solver) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 0.9));
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build(2));
+    std::vector<double> x(1);
+    std::vector<double> b = {0.099, 0.5};
+
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+    auto counters = std::make_shared<storm::utility::PerformanceCounters>();
+    env.setPerformanceCounters(counters);
+    // Copies of the environment report into the same counters.
+    storm::Environment envCopy = env;
+    EXPECT_EQ(counters.get(), envCopy.getPerformanceCounters());
+
+    auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>();
+    auto solver = factory.create(envCopy, A);
+    solver->setHasUniqueSolution(true);
+    solver->setHasNoEndComponents(true);
+    solver->setRequirementsChecked();
+    ASSERT_NO_THROW(solver->solveEquations(envCopy, storm::OptimizationDirection::Maximize, x, b));
+    EXPECT_NEAR(0.99, x[0], 1e-6);
+
+    EXPECT_EQ(1ull, counters->getNumberOfScopeEntries("min-max equation solving"));
+    EXPECT_TRUE(counters->getCounterValue("iterations") > 0);
+    EXPECT_EQ(counters->getCounterValue("iterations"), counters->getCounterValue("multiplications"));
+    EXPECT_TRUE(counters->getCounterValue("streamed bytes") > 0);
+}